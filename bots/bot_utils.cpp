@@ -9,6 +9,35 @@
 
 constexpr int Team_Coop_Monster = 0;
 
+/*
+================
+State export tracking
+
+Monsters, items and the rest only get their sv block rebuilt when one of the
+fields it's built from changed since the last export (or sv.init was
+cleared). With no bots on the server nothing reads those blocks, so they
+aren't exported at all until one joins. Players and traps are few and always
+refreshed.
+================
+*/
+struct state_source_t {
+	int32_t		spawn_count;
+	uint32_t	bits;
+	int32_t		values[4];
+	const void* refs[2];
+	vec3_t		vectors[3];
+
+	bool operator==(const state_source_t&) const = default;
+};
+
+static std::vector<state_source_t> state_sources;
+static bool state_bots_present;
+
+// refreshed/unchanged/skipped this frame, last frame, and in total
+static uint32_t state_refreshed, state_unchanged, state_skipped;
+static uint32_t state_last_refreshed, state_last_unchanged, state_last_skipped;
+static uint64_t state_total_refreshed, state_total_unchanged, state_total_skipped, state_frames;
+
 /*
 ================
 Player_UpdateState
@@ -400,29 +429,175 @@ void Edict_UpdateState(edict_t* edict) {
 	}
 }
 
+/*
+================
+Monster_StateSource
+================
+*/
+static state_source_t Monster_StateSource(const edict_t* monster) {
+	state_source_t source{};
+	source.spawn_count = monster->spawn_count;
+	source.bits = (monster->takedamage ? 1 : 0) |
+		(monster->solid == SOLID_NOT ? 2 : 0) |
+		(monster->movetype == MOVETYPE_NONE ? 4 : 0) |
+		((monster->flags & FL_INWATER) ? 8 : 0) |
+		((G_IsCooperative() || g_horde->integer) ? 16 : 0) |
+		(monster->monsterinfo.isfriendlyspawn ? 32 : 0) |
+		(monster->deadflag ? 64 : 0) |
+		((monster->monsterinfo.aiflags & AI_DUCKED) ? 128 : 0) |
+		(static_cast<uint32_t>(monster->monsterinfo.monster_type_id) << 8);
+	source.values[0] = monster->health;
+	source.values[1] = monster->waterlevel;
+	source.values[2] = monster->viewheight;
+	source.values[3] = monster->monsterinfo.team;
+	source.refs[0] = monster->groundentity;
+	source.refs[1] = monster->enemy;
+	source.vectors[0] = monster->s.angles;
+	source.vectors[1] = monster->velocity;
+	source.vectors[2] = monster->maxs;
+	return source;
+}
+
+/*
+================
+Item_StateSource
+================
+*/
+static state_source_t Item_StateSource(const edict_t* item) {
+	state_source_t source{};
+	source.spawn_count = item->spawn_count;
+	source.bits = (item->team != nullptr ? 1 : 0) |
+		(item->solid == SOLID_NOT ? 2 : 0) |
+		((item->svflags & SVF_RESPAWNING) ? 4 : 0);
+	// the respawn countdown only shows while hidden
+	if (item->solid == SOLID_NOT)
+		source.values[0] = static_cast<int32_t>((item->nextthink - level.time).milliseconds());
+	source.values[1] = static_cast<int32_t>(item->nextthink.milliseconds() > 0);
+	source.refs[0] = item->classname;
+	source.refs[1] = item->item;
+	return source;
+}
+
+/*
+================
+Edict_StateSource
+================
+*/
+static state_source_t Edict_StateSource(const edict_t* edict) {
+	state_source_t source{};
+	source.spawn_count = edict->spawn_count;
+	source.bits = (edict->takedamage ? 1 : 0) |
+		((edict->svflags & SVF_DOOR) ? 2 : 0) |
+		(edict->spawnflags.has(SPAWNFLAG_DOOR_REVERSE) ? 4 : 0) |
+		((edict->flags & FL_LOCKED) ? 8 : 0);
+	source.values[0] = edict->health;
+	source.values[1] = edict->moveinfo.state;
+	source.vectors[0] = edict->moveinfo.start_origin;
+	source.vectors[1] = edict->moveinfo.end_origin;
+	return source;
+}
+
+/*
+================
+Entity_RefreshIfChanged
+
+Runs `update` unless the fields the sv block is built from are the ones
+it was last built from.
+================
+*/
+static void Entity_RefreshIfChanged(edict_t* edict, const state_source_t& source, void (*update)(edict_t*)) {
+	const size_t index = edict - g_edicts;
+	if (state_sources.size() <= index)
+		state_sources.resize(std::max<size_t>(game.maxentities, index + 1));
+
+	state_source_t& last = state_sources[index];
+
+	if (edict->sv.init && g_bot_state_cache->integer && source == last) {
+		state_unchanged++;
+		return;
+	}
+
+	last = source;
+	update(edict);
+	state_refreshed++;
+}
+
+/*
+================
+Entity_BeginStateFrame
+================
+*/
+void Entity_BeginStateFrame() {
+	if (state_frames++) {
+		state_last_refreshed = state_refreshed;
+		state_last_unchanged = state_unchanged;
+		state_last_skipped = state_skipped;
+		state_total_refreshed += state_refreshed;
+		state_total_unchanged += state_unchanged;
+		state_total_skipped += state_skipped;
+	}
+	state_refreshed = state_unchanged = state_skipped = 0;
+
+	state_bots_present = false;
+	for (auto player : active_players()) {
+		if (player->svflags & SVF_BOT) {
+			state_bots_present = true;
+			break;
+		}
+	}
+}
+
 /*
 ================
 Entity_UpdateState
 ================
 */
 void Entity_UpdateState(edict_t* edict) {
-	if (edict->svflags & SVF_MONSTER) {
-		Monster_UpdateState(edict);
+	const bool is_trap = (edict->flags & FL_TRAP) || (edict->flags & FL_TRAP_LASER_FIELD);
+
+	// players and traps are few; everything else waits for a bot to read it
+	if (!(edict->svflags & SVF_MONSTER) && (is_trap || (edict->item == nullptr && edict->client != nullptr))) {
+		if (is_trap)
+			Trap_UpdateState(edict);
+		else
+			Player_UpdateState(edict);
+		state_refreshed++;
+		return;
 	}
-	else if (edict->flags & FL_TRAP || edict->flags & FL_TRAP_LASER_FIELD) {
-		Trap_UpdateState(edict);
+
+	if (!state_bots_present && g_bot_state_cache->integer) {
+		state_skipped++;
+		return;
 	}
-	else if (edict->item != nullptr) {
-		Item_UpdateState(edict);
+
+	if (edict->svflags & SVF_MONSTER) {
+		Entity_RefreshIfChanged(edict, Monster_StateSource(edict), Monster_UpdateState);
 	}
-	else if (edict->client != nullptr) {
-		Player_UpdateState(edict);
+	else if (edict->item != nullptr) {
+		Entity_RefreshIfChanged(edict, Item_StateSource(edict), Item_UpdateState);
 	}
 	else {
-		Edict_UpdateState(edict);
+		Entity_RefreshIfChanged(edict, Edict_StateSource(edict), Edict_UpdateState);
 	}
 }
 
+/*
+================
+Entity_PrintStateStats
+================
+*/
+void Entity_PrintStateStats() {
+	const uint64_t frames = state_frames > 1 ? state_frames - 1 : 1;
+
+	gi.Com_PrintFmt("=== Bot State Export ({}, {}) ===\n", g_bot_state_cache->integer ? "change-tracked" : "every frame, g_bot_state_cache 0",
+		state_bots_present ? "bots present" : "no bots");
+	gi.Com_PrintFmt("last frame: {} refreshed, {} unchanged, {} skipped (no bots)\n",
+		state_last_refreshed, state_last_unchanged, state_last_skipped);
+	gi.Com_PrintFmt("per frame over {} frames: {:.1f} refreshed, {:.1f} unchanged, {:.1f} skipped\n", frames,
+		static_cast<double>(state_total_refreshed) / frames, static_cast<double>(state_total_unchanged) / frames,
+		static_cast<double>(state_total_skipped) / frames);
+}
+
 USE(info_nav_lock_use) (edict_t* self, edict_t* other, edict_t* activator) -> void {
 	edict_t* n = nullptr;
 
@@ -3,7 +3,9 @@
 
 #pragma once
 
+void Entity_BeginStateFrame();
 void Entity_UpdateState( edict_t * edict );
+void Entity_PrintStateStats();
 const edict_t * FindLocalPlayer();
 const edict_t * FindFirstBot();
 const edict_t * FindFirstMonster();
@@ -159,6 +159,7 @@ static bool loc_CanSee(edict_t* targ, edict_t* inflictor)
 void CTFSpawn()
 {
 	ctfgame = {};
+	G_InvalidateStats(STATS_VOTE);
 	CTFSetupTechSpawn();
 
 	if (competition->integer > 1)
@@ -436,7 +437,7 @@ edict_t* SelectCTFSpawnPoint(edict_t* ent, bool force_spawn)
 		return result.spot;
 	}
 
-	std::shuffle(spawn_points.begin(), spawn_points.end(), mt_rand);
+	std::shuffle(spawn_points.begin(), spawn_points.end(), rng_stream(rng_stream_t::spawn));
 	for (auto& point : spawn_points)
 		if (SpawnPointClear(point))
 			return point;
@@ -2438,6 +2439,7 @@ bool CTFBeginElection(edict_t* ent, elect_t type, const char* msg) {
 	// For time extension votes, don't set etarget since nobody is the target
 	ctfgame.etarget = is_time_vote ? nullptr : ent;
 	ctfgame.election = type;
+	G_InvalidateStats(STATS_VOTE);
 	ctfgame.needvotes = static_cast<int>((count * electpercentage->value) / 100);
 	ctfgame.electtime = level.time + (is_time_vote ? 30_sec : VoteConstants::VOTE_DURATION);
 
@@ -2458,6 +2460,7 @@ bool CTFBeginElection(edict_t* ent, elect_t type, const char* msg) {
 		gi.cvar_set("timelimit", G_Fmt("{}", timelimit->value + 20).data());
 		gi.LocBroadcast_Print(PRINT_HIGH, "Time extended by 20 minutes.\n");
 		ctfgame.election = ELECT_NONE; // Reset election state
+		G_InvalidateStats(STATS_VOTE);
 		ctfgame.time_extension_voted = true; // Mark as voted
 		return false;
 	}
@@ -2875,6 +2878,7 @@ void CTFWinElection() {
 	}
 	// Resetear el estado de la elección
 	ctfgame.election = ELECT_NONE;
+	G_InvalidateStats(STATS_VOTE);
 	ctfgame.electtime = 0_sec;
 	ctfgame.automatic_vote = false;  // Reset the automatic flag
 	// Note: ctfgame.elevel will be cleared by ExitLevel() after the map change
@@ -2968,6 +2972,7 @@ void CTFVoteNo(edict_t* ent)
 		{
 			gi.LocBroadcast_Print(PRINT_HIGH, "Time extension vote cancelled - majority voted NO.\n");
 			ctfgame.election = ELECT_NONE;
+			G_InvalidateStats(STATS_VOTE);
 			ctfgame.time_extension_voted = true;  // Prevent future votes
 			ctfgame.automatic_vote = false;  // Reset the automatic flag
 			UpdateVoteHUD();  // Clear the vote HUD
@@ -3435,6 +3440,7 @@ bool CTFCheckRules()
 		}
 
 		ctfgame.election = ELECT_NONE;
+		G_InvalidateStats(STATS_VOTE);
 		ctfgame.automatic_vote = false;  // Reset the flag
 
 		// Resetear el estado de votación de todos los jugadores
@@ -1,12 +1,13 @@
 // Copyright (c) ZeniMax Media Inc.
 // Licensed under the GNU General Public License 2.0.
 #include "../g_local.h"
+#include "../horde/g_metrics.h"
 
 // Note that the pmenu entries are duplicated
 // this is so that a static set of pmenu entries can be used
 // for multiple clients and changed without interference
 // note that arg will be freed when the menu is closed, it must be allocated memory
-pmenuhnd_t* PMenu_Open(edict_t* ent, const pmenu_t* entries, int cur, int num, void* arg, UpdateFunc_t UpdateFunc)
+pmenuhnd_t* PMenu_Open(edict_t* ent, const pmenu_t* entries, int cur, int num, void* arg, UpdateFunc_t UpdateFunc, menu_id_t id)
 {
 	pmenuhnd_t* hnd;
 	const pmenu_t* p;
@@ -31,6 +32,10 @@ pmenuhnd_t* PMenu_Open(edict_t* ent, const pmenu_t* entries, int cur, int num, v
 		return nullptr;
 	}
 	hnd->UpdateFunc = UpdateFunc;
+	hnd->id = id;
+	hnd->dirty_entries = ~0ull;
+	hnd->sent_cur = -1;
+	hnd->sent_hash = 0;
 
 	hnd->arg = arg;
 	hnd->entries = (pmenu_t*)gi.TagMalloc(sizeof(pmenu_t) * num, TAG_LEVEL);
@@ -121,31 +126,37 @@ void PMenu_Close(edict_t* ent)
 }
 
 
-// only use on pmenu's that have been called with PMenu_Open
-void PMenu_UpdateEntry(pmenu_t* entry, const char* text, int align, SelectFunc_t SelectFunc)
+// only use on pmenu's that have been called with PMenu_Open;
+// returns true if the entry actually changed
+bool PMenu_UpdateEntry(pmenu_t* entry, const char* text, int align, SelectFunc_t SelectFunc)
 {
+	if (entry->align == align && entry->SelectFunc == SelectFunc && !strncmp(entry->text, text, sizeof(entry->text) - 1))
+		return false;
+
 	Q_strlcpy(entry->text, text, sizeof(entry->text));
 	entry->align = align;
 	entry->SelectFunc = SelectFunc;
+	return true;
 }
 
-#include "../g_statusbar.h"
-
-void PMenu_Do_Update(edict_t* ent)
+// same, but also flags the entry so the next refresh knows to re-render
+bool PMenu_UpdateEntry(pmenuhnd_t* hnd, int index, const char* text, int align, SelectFunc_t SelectFunc)
 {
-	if (!ent->client->menu)
-	{
-		gi.Com_Print("warning: ent has no menu\n");
-		return;
-	}
+	if (index < 0 || index >= hnd->num)
+		return false;
 
-	pmenuhnd_t* hnd = ent->client->menu;
+	if (!PMenu_UpdateEntry(hnd->entries + index, text, align, SelectFunc))
+		return false;
 
-	if (hnd->UpdateFunc)
-		hnd->UpdateFunc(ent);
+	hnd->dirty_entries |= 1ull << std::min(index, 63);
+	return true;
+}
 
-	statusbar_t sb;
+#include "../g_statusbar.h"
 
+// renders the menu into `sb`; false if the layout can't be sent
+static bool PMenu_BuildLayout(const pmenuhnd_t* hnd, layout_t& sb)
+{
 	// Posiciones base y espaciado usando vec3_t
 	const vec3_t menu_base = { 32, 8, 0 };  // Posición base del menú
 	const vec3_t title_offset = { 0, 24, 0 };  // Offset para el título
@@ -169,6 +180,8 @@ void PMenu_Do_Update(edict_t* ent)
 			t++;
 		}
 
+		const bool highlight = hnd->cur == i || alt;
+
 		// Calcular posición del item actual
 		const vec3_t item_pos = menu_base + title_offset + (item_spacing * static_cast<float>(i));
 		sb.yv(item_pos.y);
@@ -181,33 +194,16 @@ void PMenu_Do_Update(edict_t* ent)
 			// Two-column layout: split at tab and render each part at fixed X positions
 			// Left part: skill name at standard left position
 			// Right part: progress indicator at fixed right column
-
-			// Extract left part (before tab)
-			char left_part[64];
-			size_t left_len = tab_pos - t;
-			if (left_len >= sizeof(left_part))
-				left_len = sizeof(left_part) - 1;
-			strncpy(left_part, t, left_len);
-			left_part[left_len] = '\0';
-
-			// Extract right part (after tab)
+			const std::string_view left_part(t, tab_pos - t);
 			const char* right_part = tab_pos + 1;
 
 			// Render left part at standard left position
 			const float left_x = menu_base.x + 12;
-			sb.xv(left_x);
-			sb.sb << "loc_string";
-			if (hnd->cur == i || alt)
-				sb.sb << '2';
-			sb.sb << " 1 \"" << left_part << "\" \"" << p->text_arg1 << "\" ";
+			sb.xv(left_x).loc_text("loc_string", highlight, left_part, p->text_arg1);
 
 			// Render right part at fixed right column position
 			const float right_x = menu_base.x + 180; // Adjust this value to move the column left/right
-			sb.xv(right_x);
-			sb.sb << "loc_string";
-			if (hnd->cur == i || alt)
-				sb.sb << '2';
-			sb.sb << " 1 \"" << right_part << "\" \"\" ";
+			sb.xv(right_x).loc_text("loc_string", highlight, right_part, "");
 		}
 		else
 		{
@@ -229,13 +225,7 @@ void PMenu_Do_Update(edict_t* ent)
 				break;
 			}
 
-			sb.xv(x_pos);
-			sb.sb << loc_func;
-
-			if (hnd->cur == i || alt)
-				sb.sb << '2';
-
-			sb.sb << " 1 \"" << t << "\" \"" << p->text_arg1 << "\" ";
+			sb.xv(x_pos).loc_text(loc_func, highlight, t, p->text_arg1);
 		}
 
 		// Draw cursor for selected item
@@ -248,20 +238,103 @@ void PMenu_Do_Update(edict_t* ent)
 		}
 	}
 
-	// Validate layout before sending to client
-	std::string menu_layout = sb.sb.str();
-	if (!ValidateLayoutString(menu_layout, "PMenu_Do_Update"))
+	// the writer tracks if/endif balance and never splits a block on overflow
+	if (!sb.balanced())
 	{
 		// If validation fails, don't send corrupted layout
 		if (developer && developer->integer)
 			gi.Com_Print("ERROR: PMenu_Do_Update layout failed validation, not sending\n");
+		return false;
+	}
+
+	if (sb.truncated() && developer && developer->integer)
+		gi.Com_PrintFmt("WARNING: PMenu_Do_Update layout truncated at {} bytes\n", sb.size());
+
+	return true;
+}
+
+// FNV-1a; only used to tell whether a layout changed since it was last sent
+static uint32_t PMenu_LayoutHash(std::string_view layout)
+{
+	uint32_t hash = 2166136261u;
+
+	for (unsigned char c : layout)
+		hash = (hash ^ c) * 16777619u;
+
+	return hash ? hash : 1;
+}
+
+// writes the svc_layout for the menu unconditionally; caller unicasts
+void PMenu_Do_Update(edict_t* ent)
+{
+	if (!ent->client->menu)
+	{
+		gi.Com_Print("warning: ent has no menu\n");
 		return;
 	}
 
+	pmenuhnd_t* hnd = ent->client->menu;
+
+	if (hnd->UpdateFunc)
+		hnd->UpdateFunc(ent);
+
+	layout_t sb;
+
+	if (!PMenu_BuildLayout(hnd, sb))
+		return;
+
+	hnd->dirty_entries = 0;
+	hnd->sent_cur = hnd->cur;
+	hnd->sent_hash = PMenu_LayoutHash(sb.str());
+
 	gi.WriteByte(svc_layout);
-	gi.WriteString(menu_layout.c_str());
+	gi.WriteString(sb.c_str());
+	Metrics::Count(Metrics::MENU_UPDATES);
 }
 
+// re-sends the menu only if something visible changed (or `full`). without `full`,
+// a menu with no update func, no dirty entries and an unmoved cursor
+// isn't even rendered; otherwise it is rendered and only sent if the
+// result differs from the last layout the client got.
+// returns true if a layout was sent.
+bool PMenu_Refresh(edict_t* ent, bool reliable, bool full)
+{
+	pmenuhnd_t* hnd = ent->client->menu;
+
+	if (!hnd)
+		return false;
+
+	if (hnd->UpdateFunc)
+		hnd->UpdateFunc(ent);
+	else if (!full && !hnd->dirty_entries && hnd->cur == hnd->sent_cur)
+		return false;
+
+	layout_t sb;
+
+	if (!PMenu_BuildLayout(hnd, sb))
+		return false;
+
+	const uint32_t hash = PMenu_LayoutHash(sb.str());
+
+	hnd->dirty_entries = 0;
+	hnd->sent_cur = hnd->cur;
+
+	// a full refresh always goes out, and since it may be lost it
+	// doesn't count as sent; the next dirty refresh resends for real
+	if (!full && hash == hnd->sent_hash)
+		return false;
+
+	hnd->sent_hash = full ? 0 : hash;
+
+	gi.WriteByte(svc_layout);
+	gi.WriteString(sb.c_str());
+	gi.unicast(ent, reliable);
+	Metrics::Count(Metrics::MENU_UPDATES);
+	return true;
+}
+
+// flags the whole menu for a refresh; ClientEndServerFrame sends it,
+// at most once every MENU_MIN_REFRESH per client
 void PMenu_Update(edict_t* ent)
 {
 	if (!ent->client->menu)
@@ -270,15 +343,7 @@ void PMenu_Update(edict_t* ent)
 		return;
 	}
 
-	if (level.time - ent->client->menutime >= 1_sec)
-	{
-		// been a second or more since last update, update now
-		PMenu_Do_Update(ent);
-		gi.unicast(ent, true);
-		ent->client->menutime = level.time + 1_sec;
-		ent->client->menudirty = false;
-	}
-	ent->client->menutime = level.time;
+	ent->client->menu->dirty_entries = ~0ull;
 	ent->client->menudirty = true;
 }
 
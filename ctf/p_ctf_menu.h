@@ -9,6 +9,17 @@ enum
 	PMENU_ALIGN_RIGHT
 };
 
+// identifies menus that are refreshed from outside their own handlers,
+// so they can be found without comparing title strings
+enum class menu_id_t : uint8_t
+{
+	generic,
+	hud_options
+};
+
+// minimum time between two layout sends to the same client
+constexpr gtime_t MENU_MIN_REFRESH = 100_ms;
+
 struct pmenu_t;
 
 using UpdateFunc_t = void (*)(edict_t *ent);
@@ -20,6 +31,10 @@ struct pmenuhnd_t
 	int		     num;
 	void	    *arg;
 	UpdateFunc_t UpdateFunc;
+	menu_id_t    id;
+	uint64_t     dirty_entries; // one bit per entry, entries past 63 share the top bit
+	int          sent_cur;      // cursor of the last layout sent
+	uint32_t     sent_hash;     // hash of the last layout sent; 0 = nothing sent
 };
 
 using SelectFunc_t = void (*)(edict_t *ent, pmenuhnd_t *hnd);
@@ -32,10 +47,12 @@ struct pmenu_t
 	char         text_arg1[64] = {};  // Optional argument, defaults to empty string
 };
 
-pmenuhnd_t *PMenu_Open(edict_t *ent, const pmenu_t *entries, int cur, int num, void *arg, UpdateFunc_t UpdateFunc);
+pmenuhnd_t *PMenu_Open(edict_t *ent, const pmenu_t *entries, int cur, int num, void *arg, UpdateFunc_t UpdateFunc, menu_id_t id = menu_id_t::generic);
 void		PMenu_Close(edict_t *ent);
-void		PMenu_UpdateEntry(pmenu_t *entry, const char *text, int align, SelectFunc_t SelectFunc);
+bool		PMenu_UpdateEntry(pmenu_t *entry, const char *text, int align, SelectFunc_t SelectFunc);
+bool		PMenu_UpdateEntry(pmenuhnd_t *hnd, int index, const char *text, int align, SelectFunc_t SelectFunc);
 void		PMenu_Do_Update(edict_t *ent);
+bool		PMenu_Refresh(edict_t *ent, bool reliable, bool full = false);
 void		PMenu_Update(edict_t *ent);
 void		PMenu_Next(edict_t *ent);
 void		PMenu_Prev(edict_t *ent);
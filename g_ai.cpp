@@ -5,6 +5,8 @@
 #include "g_local.h"
 #include <cfloat>
 #include "horde/horde_performance.h"
+#include "horde/g_monster_table.h"
+#include "q_vec3_batch.h"
 #include "shared.h"
 bool FindTarget(edict_t* self);
 bool FindEnhancedTarget(edict_t* self);
@@ -82,20 +84,23 @@ static const int* GetPlayerAttackerCounts()
 		last_build = level.time;
 		memset(counts, 0, sizeof(counts));
 
-		for (edict_t* m : active_monsters())
+		const MonsterTable::table_t& monsters = MonsterTable::Table();
+
+		for (size_t row = 0; row < monsters.size(); row++)
 		{
 			// Friendly spawns hunt monsters, not players, so they don't
 			// contribute to player aggro pressure.
-			if (m->monsterinfo.isfriendlyspawn)
+			if (!monsters.alive(row) || (monsters.flags[row] & MonsterTable::FLAG_FRIENDLY))
 				continue;
 
-			edict_t* e = m->enemy;
-			if (e && e->inuse && e->client)
-			{
-				const int idx = e->s.number;
-				if (idx >= 1 && idx < (int)HORDE_MAX_CLIENT_SLOTS)
-					counts[idx]++;
-			}
+			// only client slots can be players; a stale number past them is ruled out unread
+			const uint32_t idx = monsters.enemy[row];
+			if (idx < 1 || idx > game.maxclients || idx >= HORDE_MAX_CLIENT_SLOTS)
+				continue;
+
+			const edict_t* e = &g_edicts[idx];
+			if (e->inuse && e->client)
+				counts[idx]++;
 		}
 	}
 
@@ -1204,17 +1209,26 @@ bool FindMTarget(edict_t* self) {
 	// Get potential targets from the grid instead of iterating all active monsters.
 	const auto potential_targets = HordePhys::g_entity_grid.QueryRadiusFiltered(self_origin, query_range, HordePhys::EntityGrid::TYPE_COMBAT);
 
+	// --- Distance Check (Batched Math - Fast) ---
+	// The grid gives us a square search area, so we still need a precise distance check.
+	boost::container::small_vector<vec3_t, 64> target_origins;
+	target_origins.reserve(potential_targets.size());
+	for (const edict_t* ent : potential_targets)
+		target_origins.push_back(ent->s.origin);
+
+	boost::container::small_vector<float, 64> target_dist_squared(potential_targets.size());
+	batch_distance_squared(std::span<const vec3_t>(target_origins.data(), target_origins.size()), self_origin, target_dist_squared.data());
+
 	// --- Iterate Through POTENTIAL Monsters to Find a Better Target ---
-	for (auto ent : potential_targets) { // <<<< KEY CHANGE HERE
-		// --- Fast Rejection Checks ---
-		if (!IsValidMonsterTargetForSummon(self, ent, current_time)) {
+	for (size_t i = 0; i < potential_targets.size(); i++) {
+		edict_t* ent = potential_targets[i];
+		const float dist_squared = target_dist_squared[i];
+		if (dist_squared > query_range_squared) {
 			continue;
 		}
 
-		// --- Distance Check (Math - Fast) ---
-		// The grid gives us a square search area, so we still need a precise distance check.
-		float dist_squared = DistanceSquared(self_origin, ent->s.origin);
-		if (dist_squared > query_range_squared) {
+		// --- Fast Rejection Checks ---
+		if (!IsValidMonsterTargetForSummon(self, ent, current_time)) {
 			continue;
 		}
 
@@ -2909,7 +2923,7 @@ void ai_run(edict_t* self, float dist)
 	edict_t* tempgoal;
 	edict_t* save;
 	bool     newEnemy;
-	edict_t* marker;
+	const player_trail_point_t* marker;
 	float    d1, d2;
 	trace_t  tr;
 	vec3_t   v_forward, v_right;
@@ -3252,9 +3266,9 @@ void ai_run(edict_t* self, float dist)
 
 		if (marker)
 		{
-			self->monsterinfo.last_sighting = marker->s.origin;
+			self->monsterinfo.last_sighting = marker->origin;
 			self->monsterinfo.trail_time = marker->timestamp;
-			self->s.angles[YAW] = self->ideal_yaw = marker->s.angles[YAW];
+			self->s.angles[YAW] = self->ideal_yaw = marker->yaw;
 
 			newEnemy = true;
 		}
@@ -1935,8 +1935,7 @@ void Cmd_Wave_f(edict_t* ent)
 		if (CheckFlood(ent))
 			return;
 
-		edict_t* targ = nullptr;
-		while ((targ = findradius(targ, ent->s.origin, 1024)) != nullptr)
+		for (edict_t* targ : radius_edicts(ent->s.origin, 1024))
 		{
 			if (ent == targ) continue;
 			if (!targ->client) continue;
@@ -5,6 +5,10 @@
 #include "g_local.h"
 #include "horde/g_horde_benefits.h"
 #include "horde/g_horde_phys.h"
+#include "horde/g_heal_registry.h"
+#include "horde/g_metrics.h"
+#include "horde/g_monster_table.h"
+#include "q_vec3_batch.h"
 #include "horde/horde_performance.h"
 #include "horde/g_upgrades.h"
 #include "g_config.h"
@@ -1071,6 +1075,8 @@ void T_Damage(edict_t* targ, edict_t* inflictor, edict_t* attacker, const vec3_t
 	int		   te_sparks;
 	bool	   sphere_notified; // PGM
 
+	Metrics::Count(Metrics::DAMAGE_EVENTS);
+
 	// Check for menu protection - players in menus cannot be damaged
 	if (targ->client && targ->client->menu_protected) {
 		return; // No damage while protected in menu
@@ -1402,6 +1408,10 @@ void T_Damage(edict_t* targ, edict_t* inflictor, edict_t* attacker, const vec3_t
 		if ((targ->flags & FL_IMMORTAL) && targ->health <= 0)
 			targ->health = 1;
 
+		MonsterTable::Refresh(targ);
+
+		HealRegistry::NoteHealth(targ);
+
 		if (client && client->owned_sphere)
 		{
 			sphere_notified = true;
@@ -1431,6 +1441,7 @@ void T_Damage(edict_t* targ, edict_t* inflictor, edict_t* attacker, const vec3_t
 			}
 
 			Killed(targ, inflictor, attacker, take, point, mod);
+			MonsterTable::Refresh(targ);
 			return;
 		}
 	}
@@ -1469,6 +1480,8 @@ void T_Damage(edict_t* targ, edict_t* inflictor, edict_t* attacker, const vec3_t
 		}
 		if (targ->monsterinfo.setskin)
 			targ->monsterinfo.setskin(targ);
+
+		MonsterTable::Refresh(targ);
 	}
 	else if (take && targ->pain)
 		targ->pain(targ, attacker, (float)knockback, take, mod);
@@ -1534,34 +1547,45 @@ void T_RadiusDamage(edict_t* inflictor, edict_t* attacker, float damage, edict_t
 	auto nearby_entities = HordePhys::g_entity_grid.QueryRadiusFiltered(inflictor_center, radius, HordePhys::EntityGrid::TYPE_ALL);
 	const float radius_sq = radius * radius;
 
+	// Determine the single point of impact on each entity up front, so the radius test
+	// runs over all of them at once. This makes all subsequent calculations consistent.
+	// The candidates are copied out too: a death below may run another grid query.
+	boost::container::small_vector<edict_t*, 64> targets;
+	boost::container::small_vector<vec3_t, 64> damage_points;
 	for (edict_t* ent : nearby_entities)
 	{
 		if (ent == ignore || !ent->takedamage)
 			continue;
 
-		// Determine the single point of impact on the entity.
-		// This makes all subsequent calculations consistent.
-		vec3_t damage_point;
 		if (ent->solid == SOLID_BSP && ent->linked) {
-			damage_point = closest_point_to_box(inflictor_center, ent->absmin, ent->absmax);
+			damage_points.push_back(closest_point_to_box(inflictor_center, ent->absmin, ent->absmax));
 		}
 		else {
 			// This logic matches the original code's method for finding the center
 			// of players/monsters, ensuring identical behavior.
 			vec3_t center = ent->mins + ent->maxs;
 			center *= 0.5f;
-			damage_point = ent->s.origin + center;
+			damage_points.push_back(ent->s.origin + center);
 		}
+		targets.push_back(ent);
+	}
 
-		// Vector from explosion center to the entity's impact point
-		vec3_t force_vec = damage_point - inflictor_center;
-		const float dist_sq = force_vec.lengthSquared();
+	// Reject entities whose actual impact point is outside the explosion radius
+	boost::container::small_vector<uint32_t, 64> in_radius(targets.size());
+	in_radius.resize(batch_in_sphere(std::span<const vec3_t>(damage_points.data(), damage_points.size()), inflictor_center, radius_sq, in_radius.data()));
+
+	for (uint32_t index : in_radius)
+	{
+		edict_t* ent = targets[index];
+		const vec3_t& damage_point = damage_points[index];
 
-		// Reject entities whose actual impact point is outside the explosion radius
-		if (dist_sq > radius_sq)
+		// an earlier target's death may have taken this one with it
+		if (!ent->inuse || !ent->takedamage)
 			continue;
 
-		const float dist = std::sqrt(dist_sq);
+		// Vector from explosion center to the entity's impact point
+		vec3_t force_vec = damage_point - inflictor_center;
+		const float dist = std::sqrt(force_vec.lengthSquared());
 
 		float points = damage - 0.5f * dist;
 
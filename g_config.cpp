@@ -6,6 +6,7 @@
 #include "horde/weapon_id.h"
 #include "horde/g_pvm.h"
 #include "horde/g_horde.h"
+#include "memory_safety.h"
 #include <json/json.h>
 #include <fstream>
 #include <cmath>
@@ -18,6 +19,11 @@
 #include <cstring>
 #include <iterator>
 #include <algorithm>
+#include <memory>
+#include <vector>
+#include <chrono>
+#include <filesystem>
+#include <type_traits>
 
 extern "C" {
 #include "lua.h"
@@ -27,6 +33,23 @@ extern "C" {
 
 // Global config instance
 GameConfig g_config;
+const ConfigSnapshot* g_config_snapshot = nullptr;
+
+namespace {
+
+// The live snapshot, plus the snapshots a reload replaced that some entity
+// still points into. Monsters cache pointers into the snapshot they spawned
+// under, so a replaced one is kept until the last of those is gone.
+std::unique_ptr<ConfigSnapshot> s_live_snapshot;
+std::vector<std::unique_ptr<ConfigSnapshot>> s_retired_snapshots;
+
+// A reload parsed and compiled off to the side, waiting for a frame boundary
+std::unique_ptr<GameConfig> s_pending_config;
+std::unique_ptr<ConfigSnapshot> s_pending_snapshot;
+
+uint32_t s_snapshot_generation = 0;
+
+} // namespace
 
 // Global variables for player levels (updated periodically in Horde_RunFrame)
 int32_t g_lowest_player_level = 0;
@@ -565,13 +588,63 @@ static int32_t GetArmorTypeFromString(const std::string& type)
 	return IT_NULL;
 }
 
+// Flattens the monster tables of cfg into a fresh snapshot. Name -> id
+// resolution happens here, once, instead of on every lookup.
+static std::unique_ptr<ConfigSnapshot> Config_Compile(const GameConfig& cfg)
+{
+	auto snapshot = std::make_unique<ConfigSnapshot>();
+
+	snapshot->global_weapon_damage = cfg.global_weapon_damage;
+	snapshot->global_weapon_speed = cfg.global_weapon_speed;
+	snapshot->global_weapon_radius = cfg.global_weapon_radius;
+
+	for (const auto& [monster_id, stats] : cfg.monsters.monsters)
+	{
+		snapshot->monster_stats[monster_id] = stats;
+		snapshot->has_monster_stats[monster_id] = true;
+	}
+
+	for (const auto& [monster_name, scaling] : cfg.monsters.level_scaling)
+	{
+		const std::string full_classname = "monster_" + monster_name;
+		const horde::MonsterTypeID type_id = horde::MonsterTypeRegistry::GetTypeID(full_classname.c_str());
+		if (type_id == horde::MonsterTypeID::UNKNOWN)
+			continue;
+
+		// several classnames can share an id; the registry's own name wins
+		const uint8_t monster_id = static_cast<uint8_t>(type_id);
+		const char* classname = horde::MonsterTypeRegistry::GetClassname(type_id);
+		if (snapshot->has_level_scaling[monster_id] && (!classname || full_classname != classname))
+			continue;
+
+		snapshot->level_scaling[monster_id] = scaling;
+		snapshot->has_level_scaling[monster_id] = true;
+	}
+
+	snapshot->generation = ++s_snapshot_generation;
+	return snapshot;
+}
+
+// Makes cfg and its snapshot the live config
+static void Config_Install(GameConfig&& cfg, std::unique_ptr<ConfigSnapshot> snapshot)
+{
+	g_config = std::move(cfg);
+
+	if (s_live_snapshot)
+		s_retired_snapshots.push_back(std::move(s_live_snapshot));
+	s_live_snapshot = std::move(snapshot);
+	g_config_snapshot = s_live_snapshot.get();
+}
+
 void Config_SetDefaults()
 {
 	// Reset to default values (already set in struct definitions)
-	g_config = GameConfig();
+	GameConfig defaults;
+	auto snapshot = Config_Compile(defaults);
+	Config_Install(std::move(defaults), std::move(snapshot));
 }
 
-void Config_LoadMonsters(const char* basedir)
+static bool Config_LoadMonsters(GameConfig& cfg, const char* basedir)
 {
 	// Build config file path
 	std::string config_path = std::string(basedir) + "config/monsters.lua";
@@ -580,7 +653,7 @@ void Config_LoadMonsters(const char* basedir)
 	if (!LoadLuaConfig(config_path, root))
 	{
 		gi.Com_PrintFmt("Config: config/monsters.lua not loaded, using default monster values\n");
-		return;
+		return false;
 	}
 
 	// Load global weapon damage - OPTIMIZED: uses array-based storage with enum indexing
@@ -593,7 +666,7 @@ void Config_LoadMonsters(const char* basedir)
 			if (gwd[weapon_name].isInt())
 			{
 				horde::WeaponID weapon_id = horde::WeaponRegistry::GetWeaponID(weapon_name.c_str());
-				g_config.global_weapon_damage.set(weapon_id, gwd[weapon_name].asInt());
+				cfg.global_weapon_damage.set(weapon_id, gwd[weapon_name].asInt());
 			}
 		}
 		gi.Com_PrintFmt("Config: Loaded global weapon damage values\n");
@@ -609,7 +682,7 @@ void Config_LoadMonsters(const char* basedir)
 			if (gws[weapon_name].isInt())
 			{
 				horde::WeaponID weapon_id = horde::WeaponRegistry::GetWeaponID(weapon_name.c_str());
-				g_config.global_weapon_speed.set(weapon_id, gws[weapon_name].asInt());
+				cfg.global_weapon_speed.set(weapon_id, gws[weapon_name].asInt());
 			}
 		}
 		gi.Com_PrintFmt("Config: Loaded global weapon speed values\n");
@@ -625,7 +698,7 @@ void Config_LoadMonsters(const char* basedir)
 			if (gwr[weapon_name].isDouble() || gwr[weapon_name].isInt())
 			{
 				horde::WeaponID weapon_id = horde::WeaponRegistry::GetWeaponID(weapon_name.c_str());
-				g_config.global_weapon_radius.set(weapon_id, static_cast<float>(gwr[weapon_name].asDouble()));
+				cfg.global_weapon_radius.set(weapon_id, static_cast<float>(gwr[weapon_name].asDouble()));
 			}
 		}
 		gi.Com_PrintFmt("Config: Loaded global weapon radius values\n");
@@ -767,7 +840,7 @@ void Config_LoadMonsters(const char* basedir)
 				}
 			}
 
-			g_config.monsters.monsters[monster_id] = config;
+			cfg.monsters.monsters[monster_id] = config;
 			loaded_count++;
 		}
 
@@ -789,8 +862,8 @@ void Config_LoadMonsters(const char* basedir)
 					continue;
 				}
 
-				auto it = g_config.monsters.monsters.find(type_id);
-				if (it == g_config.monsters.monsters.end())
+				auto it = cfg.monsters.monsters.find(type_id);
+				if (it == cfg.monsters.monsters.end())
 				{
 					missing_count++;
 					gi.Com_PrintFmt("WARNING: Monster '{}' (type_id {}) has NO config in monsters.lua!\n", classname, type_id);
@@ -835,7 +908,7 @@ void Config_LoadMonsters(const char* basedir)
 			level_scaling.initial_power_armor = GetJsonInt(scaling_data, "initial_power_armor", 0);
 			level_scaling.addon_power_armor = GetJsonInt(scaling_data, "addon_power_armor", 0);
 
-			g_config.monsters.level_scaling[monster_name] = level_scaling;
+			cfg.monsters.level_scaling[monster_name] = level_scaling;
 			loaded_count++;
 		}
 
@@ -844,9 +917,11 @@ void Config_LoadMonsters(const char* basedir)
 			gi.Com_PrintFmt("Config: Loaded {} monster level scaling configurations\n", loaded_count);
 		}
 	}
+
+	return true;
 }
 
-void Config_LoadMaps(const char* basedir)
+bool Config_LoadMaps(GameConfig& cfg, const char* basedir)
 {
 	// Build config file path
 	std::string config_path = std::string(basedir) + "config/maps_config.lua";
@@ -855,23 +930,23 @@ void Config_LoadMaps(const char* basedir)
 	if (!LoadLuaConfig(config_path, root))
 	{
 		gi.Com_PrintFmt("Config: config/maps_config.lua not loaded, using default map values\n");
-		return;
+		return false;
 	}
 
 	// Load default caps
 	if (root.isMember("default_caps") && root["default_caps"].isObject())
 	{
 		const Json::Value& caps = root["default_caps"];
-		g_config.maps.big_map_cap = GetJsonInt(caps, "big_map", 26);
-		g_config.maps.medium_map_cap = GetJsonInt(caps, "medium_map", 14);
-		g_config.maps.small_map_cap = GetJsonInt(caps, "small_map", 12);
-		g_config.maps.custom_map_cap = GetJsonInt(caps, "custom_map", 20);
+		cfg.maps.big_map_cap = GetJsonInt(caps, "big_map", 26);
+		cfg.maps.medium_map_cap = GetJsonInt(caps, "medium_map", 14);
+		cfg.maps.small_map_cap = GetJsonInt(caps, "small_map", 12);
+		cfg.maps.custom_map_cap = GetJsonInt(caps, "custom_map", 20);
 
 		gi.Com_PrintFmt("Config: Default caps - Big: {}, Medium: {}, Small: {}, Custom: {}\n",
-			g_config.maps.big_map_cap,
-			g_config.maps.medium_map_cap,
-			g_config.maps.small_map_cap,
-			g_config.maps.custom_map_cap);
+			cfg.maps.big_map_cap,
+			cfg.maps.medium_map_cap,
+			cfg.maps.small_map_cap,
+			cfg.maps.custom_map_cap);
 	}
 
 	// Load default settings
@@ -880,8 +955,8 @@ void Config_LoadMaps(const char* basedir)
 		const Json::Value& settings = root["default_settings"];
 		if (settings.isMember("enable_grid") && settings["enable_grid"].isBool())
 		{
-			g_config.maps.default_enable_grid = settings["enable_grid"].asBool();
-			gi.Com_PrintFmt("Config: Default grid enabled: {}\n", g_config.maps.default_enable_grid);
+			cfg.maps.default_enable_grid = settings["enable_grid"].asBool();
+			gi.Com_PrintFmt("Config: Default grid enabled: {}\n", cfg.maps.default_enable_grid);
 		}
 	}
 
@@ -996,7 +1071,7 @@ void Config_LoadMaps(const char* basedir)
 
 			// Store in array using MapID as index
 			const size_t index = static_cast<size_t>(mapId);
-			g_config.maps.map_overrides[index] = override_config;
+			cfg.maps.map_overrides[index] = override_config;
 			loaded_count++;
 
 			// Determine map size string for logging
@@ -1038,15 +1113,22 @@ void Config_LoadMaps(const char* basedir)
 			gi.Com_PrintFmt("Config: Loaded {} map-specific overrides from config/maps_config.lua\n", loaded_count);
 		}
 	}
+
+	return true;
 }
 
-void Config_Load(const char* basedir)
+// Player config file for the current game mode
+static const char* Config_PlayerConfigFile()
 {
-	// Set defaults first
-	Config_SetDefaults();
+	return IsPvMMode() ? "config/player_pvm_config.lua" : "config/player_horde_config.lua";
+}
 
+// Runs every Lua config file into cfg, which starts out at the compiled
+// defaults. Returns true only if all of them loaded.
+static bool Config_ParseLua(GameConfig& cfg, const char* basedir)
+{
 	// Build config file path based on game mode
-	std::string config_filename = IsPvMMode() ? "config/player_pvm_config.lua" : "config/player_horde_config.lua";
+	std::string config_filename = Config_PlayerConfigFile();
 	std::string config_path = std::string(basedir) + config_filename;
 
 	Json::Value root;
@@ -1060,13 +1142,13 @@ void Config_Load(const char* basedir)
 	if (root.isMember("entity_limits") && root["entity_limits"].isObject())
 	{
 		const Json::Value& limits = root["entity_limits"];
-		g_config.entity_limits.max_sentries = GetJsonInt(limits, "max_sentries", 3);
-		g_config.entity_limits.max_lasers = GetJsonInt(limits, "max_lasers", 6);
-		g_config.entity_limits.max_teslas = GetJsonInt(limits, "max_teslas", 11);
-		g_config.entity_limits.max_barrels = GetJsonInt(limits, "max_barrels", 4);
-		g_config.entity_limits.max_prox = GetJsonInt(limits, "max_prox", 12);
-		g_config.entity_limits.max_traps = GetJsonInt(limits, "max_traps", 8);
-		g_config.entity_limits.max_summons = GetJsonInt(limits, "max_summons", 3);
+		cfg.entity_limits.max_sentries = GetJsonInt(limits, "max_sentries", 3);
+		cfg.entity_limits.max_lasers = GetJsonInt(limits, "max_lasers", 6);
+		cfg.entity_limits.max_teslas = GetJsonInt(limits, "max_teslas", 11);
+		cfg.entity_limits.max_barrels = GetJsonInt(limits, "max_barrels", 4);
+		cfg.entity_limits.max_prox = GetJsonInt(limits, "max_prox", 12);
+		cfg.entity_limits.max_traps = GetJsonInt(limits, "max_traps", 8);
+		cfg.entity_limits.max_summons = GetJsonInt(limits, "max_summons", 3);
 	}
 
 	// Load weapon configs
@@ -1079,190 +1161,190 @@ void Config_Load(const char* basedir)
 		{
 			const Json::Value& w = weapons["blaster"];
 
-			g_config.blaster.damage_min = GetJsonInt(w, "damage_min", 12);
-			g_config.blaster.damage_max = GetJsonInt(w, "damage_max", 16);
-			g_config.blaster.speed = GetJsonInt(w, "speed", 1200);
-			g_config.blaster.bounces = GetJsonInt(w, "bounces", 5);
-			g_config.blaster.speed_addon = GetJsonInt(w, "speed_addon", 40);
+			cfg.blaster.damage_min = GetJsonInt(w, "damage_min", 12);
+			cfg.blaster.damage_max = GetJsonInt(w, "damage_max", 16);
+			cfg.blaster.speed = GetJsonInt(w, "speed", 1200);
+			cfg.blaster.bounces = GetJsonInt(w, "bounces", 5);
+			cfg.blaster.speed_addon = GetJsonInt(w, "speed_addon", 40);
 		}
 
 		// Hyperblaster
 		if (weapons.isMember("hyperblaster") && weapons["hyperblaster"].isObject())
 		{
 			const Json::Value& w = weapons["hyperblaster"];
-			g_config.hyperblaster.damage_min = GetJsonInt(w, "damage_min", 12);
-			g_config.hyperblaster.damage_max = GetJsonInt(w, "damage_max", 14);
-			g_config.hyperblaster.speed = GetJsonInt(w, "speed", 1700);
-			g_config.hyperblaster.bounces = GetJsonInt(w, "bounces", 3);
-			g_config.hyperblaster.speed_addon = GetJsonInt(w, "speed_addon", 40);
+			cfg.hyperblaster.damage_min = GetJsonInt(w, "damage_min", 12);
+			cfg.hyperblaster.damage_max = GetJsonInt(w, "damage_max", 14);
+			cfg.hyperblaster.speed = GetJsonInt(w, "speed", 1700);
+			cfg.hyperblaster.bounces = GetJsonInt(w, "bounces", 3);
+			cfg.hyperblaster.speed_addon = GetJsonInt(w, "speed_addon", 40);
 		}
 
 		// Shotgun
 		if (weapons.isMember("shotgun") && weapons["shotgun"].isObject())
 		{
 			const Json::Value& w = weapons["shotgun"];
-			g_config.shotgun.damage_min = GetJsonInt(w, "damage_min", 3);
-			g_config.shotgun.damage_max = GetJsonInt(w, "damage_max", 5);
-			g_config.shotgun.damage_energy_min = GetJsonInt(w, "damage_energy_min", 7);
-			g_config.shotgun.damage_energy_max = GetJsonInt(w, "damage_energy_max", 11);
-			g_config.shotgun.kick = GetJsonInt(w, "kick", 8);
-			g_config.shotgun.pellet_count_deathmatch = GetJsonInt(w, "pellet_count_deathmatch", 12);
-			g_config.shotgun.pellet_count_normal = GetJsonInt(w, "pellet_count_normal", 18);
+			cfg.shotgun.damage_min = GetJsonInt(w, "damage_min", 3);
+			cfg.shotgun.damage_max = GetJsonInt(w, "damage_max", 5);
+			cfg.shotgun.damage_energy_min = GetJsonInt(w, "damage_energy_min", 7);
+			cfg.shotgun.damage_energy_max = GetJsonInt(w, "damage_energy_max", 11);
+			cfg.shotgun.kick = GetJsonInt(w, "kick", 8);
+			cfg.shotgun.pellet_count_deathmatch = GetJsonInt(w, "pellet_count_deathmatch", 12);
+			cfg.shotgun.pellet_count_normal = GetJsonInt(w, "pellet_count_normal", 18);
 		}
 
 		// Super Shotgun
 		if (weapons.isMember("supershotgun") && weapons["supershotgun"].isObject())
 		{
 			const Json::Value& w = weapons["supershotgun"];
-			g_config.supershotgun.damage_min = GetJsonInt(w, "damage_min", 5);
-			g_config.supershotgun.damage_max = GetJsonInt(w, "damage_max", 9);
-			g_config.supershotgun.damage_energy_min = GetJsonInt(w, "damage_energy_min", 14);
-			g_config.supershotgun.damage_energy_max = GetJsonInt(w, "damage_energy_max", 16);
-			g_config.supershotgun.kick = GetJsonInt(w, "kick", 17);
-			g_config.supershotgun.pellet_count = GetJsonInt(w, "pellet_count", 20);
+			cfg.supershotgun.damage_min = GetJsonInt(w, "damage_min", 5);
+			cfg.supershotgun.damage_max = GetJsonInt(w, "damage_max", 9);
+			cfg.supershotgun.damage_energy_min = GetJsonInt(w, "damage_energy_min", 14);
+			cfg.supershotgun.damage_energy_max = GetJsonInt(w, "damage_energy_max", 16);
+			cfg.supershotgun.kick = GetJsonInt(w, "kick", 17);
+			cfg.supershotgun.pellet_count = GetJsonInt(w, "pellet_count", 20);
 		}
 
 		// Machinegun
 		if (weapons.isMember("machinegun") && weapons["machinegun"].isObject())
 		{
 			const Json::Value& w = weapons["machinegun"];
-			g_config.machinegun.damage_min = GetJsonInt(w, "damage_min", 4);
-			g_config.machinegun.damage_max = GetJsonInt(w, "damage_max", 8);
-			g_config.machinegun.kick = GetJsonInt(w, "kick", 2);
-			g_config.machinegun.tracer_damage = GetJsonInt(w, "tracer_damage", 12);
-			g_config.machinegun.tracer_cooldown_ms = GetJsonInt(w, "tracer_cooldown_ms", 500);
-			g_config.machinegun.tracer_damage_per_level = GetJsonInt(w, "tracer_damage_per_level", 4);
+			cfg.machinegun.damage_min = GetJsonInt(w, "damage_min", 4);
+			cfg.machinegun.damage_max = GetJsonInt(w, "damage_max", 8);
+			cfg.machinegun.kick = GetJsonInt(w, "kick", 2);
+			cfg.machinegun.tracer_damage = GetJsonInt(w, "tracer_damage", 12);
+			cfg.machinegun.tracer_cooldown_ms = GetJsonInt(w, "tracer_cooldown_ms", 500);
+			cfg.machinegun.tracer_damage_per_level = GetJsonInt(w, "tracer_damage_per_level", 4);
 		}
 
 		// Chaingun
 		if (weapons.isMember("chaingun") && weapons["chaingun"].isObject())
 		{
 			const Json::Value& w = weapons["chaingun"];
-			g_config.chaingun.damage_min = GetJsonInt(w, "damage_min", 6);
-			g_config.chaingun.damage_max = GetJsonInt(w, "damage_max", 9);
-			g_config.chaingun.kick = GetJsonInt(w, "kick", 3);
-			g_config.chaingun.tracer_damage = GetJsonInt(w, "tracer_damage", 10);
-			g_config.chaingun.tracer_cooldown_ms = GetJsonInt(w, "tracer_cooldown_ms", 300);
-			g_config.chaingun.tracer_damage_per_level = GetJsonInt(w, "tracer_damage_per_level", 2);
+			cfg.chaingun.damage_min = GetJsonInt(w, "damage_min", 6);
+			cfg.chaingun.damage_max = GetJsonInt(w, "damage_max", 9);
+			cfg.chaingun.kick = GetJsonInt(w, "kick", 3);
+			cfg.chaingun.tracer_damage = GetJsonInt(w, "tracer_damage", 10);
+			cfg.chaingun.tracer_cooldown_ms = GetJsonInt(w, "tracer_cooldown_ms", 300);
+			cfg.chaingun.tracer_damage_per_level = GetJsonInt(w, "tracer_damage_per_level", 2);
 		}
 
 		// Grenade
 		if (weapons.isMember("grenade") && weapons["grenade"].isObject())
 		{
 			const Json::Value& w = weapons["grenade"];
-			g_config.grenade.damage = GetJsonInt(w, "damage", 125);
-			g_config.grenade.radius_offset = GetJsonFloat(w, "radius_offset", 40.0f);
-			g_config.grenade.minspeed = GetJsonFloat(w, "minspeed", 600.0f);
-			g_config.grenade.maxspeed = GetJsonFloat(w, "maxspeed", 900.0f);
-			g_config.grenade.speed_addon = GetJsonFloat(w, "speed_addon", 30.0f);
+			cfg.grenade.damage = GetJsonInt(w, "damage", 125);
+			cfg.grenade.radius_offset = GetJsonFloat(w, "radius_offset", 40.0f);
+			cfg.grenade.minspeed = GetJsonFloat(w, "minspeed", 600.0f);
+			cfg.grenade.maxspeed = GetJsonFloat(w, "maxspeed", 900.0f);
+			cfg.grenade.speed_addon = GetJsonFloat(w, "speed_addon", 30.0f);
 		}
 
 		// Grenade Launcher
 		if (weapons.isMember("grenadelauncher") && weapons["grenadelauncher"].isObject())
 		{
 			const Json::Value& w = weapons["grenadelauncher"];
-			g_config.grenadelauncher.damage_normal = GetJsonInt(w, "damage_normal", 100);
-			g_config.grenadelauncher.damage_napalm = GetJsonInt(w, "damage_napalm", 95);
-			g_config.grenadelauncher.radius_normal = GetJsonFloat(w, "radius_normal", 135.0f);
-			g_config.grenadelauncher.radius_napalm = GetJsonFloat(w, "radius_napalm", 115.0f);
-			g_config.grenadelauncher.speed = GetJsonInt(w, "speed", 1200);
-			g_config.grenadelauncher.speed_addon = GetJsonInt(w, "speed_addon", 30);
+			cfg.grenadelauncher.damage_normal = GetJsonInt(w, "damage_normal", 100);
+			cfg.grenadelauncher.damage_napalm = GetJsonInt(w, "damage_napalm", 95);
+			cfg.grenadelauncher.radius_normal = GetJsonFloat(w, "radius_normal", 135.0f);
+			cfg.grenadelauncher.radius_napalm = GetJsonFloat(w, "radius_napalm", 115.0f);
+			cfg.grenadelauncher.speed = GetJsonInt(w, "speed", 1200);
+			cfg.grenadelauncher.speed_addon = GetJsonInt(w, "speed_addon", 30);
 		}
 
 		// Rocket Launcher
 		if (weapons.isMember("rocket") && weapons["rocket"].isObject())
 		{
 			const Json::Value& w = weapons["rocket"];
-			g_config.rocket.damage_min = GetJsonInt(w, "damage_min", 100);
-			g_config.rocket.damage_max = GetJsonInt(w, "damage_max", 125);
-			g_config.rocket.speed = GetJsonInt(w, "speed", 1230);
-			g_config.rocket.radius = GetJsonInt(w, "radius", 115);
-			g_config.rocket.damage_addon = GetJsonInt(w, "damage_addon", 3);
-			g_config.rocket.radius_addon = GetJsonInt(w, "radius_addon", 3);
-			g_config.rocket.speed_addon = GetJsonInt(w, "speed_addon", 28);
+			cfg.rocket.damage_min = GetJsonInt(w, "damage_min", 100);
+			cfg.rocket.damage_max = GetJsonInt(w, "damage_max", 125);
+			cfg.rocket.speed = GetJsonInt(w, "speed", 1230);
+			cfg.rocket.radius = GetJsonInt(w, "radius", 115);
+			cfg.rocket.damage_addon = GetJsonInt(w, "damage_addon", 3);
+			cfg.rocket.radius_addon = GetJsonInt(w, "radius_addon", 3);
+			cfg.rocket.speed_addon = GetJsonInt(w, "speed_addon", 28);
 		}
 
 		// Railgun
 		if (weapons.isMember("railgun") && weapons["railgun"].isObject())
 		{
 			const Json::Value& w = weapons["railgun"];
-			g_config.railgun.damage = GetJsonInt(w, "damage", 150);
-			g_config.railgun.damage_horde = GetJsonInt(w, "damage_horde", 225);
-			g_config.railgun.kick = GetJsonInt(w, "kick", 285);
-			g_config.railgun.damage_addon = GetJsonInt(w, "damage_addon", 8);
+			cfg.railgun.damage = GetJsonInt(w, "damage", 150);
+			cfg.railgun.damage_horde = GetJsonInt(w, "damage_horde", 225);
+			cfg.railgun.kick = GetJsonInt(w, "kick", 285);
+			cfg.railgun.damage_addon = GetJsonInt(w, "damage_addon", 8);
 		}
 
 		// 20mm Cannon
 		if (weapons.isMember("cannon20mm") && weapons["cannon20mm"].isObject())
 		{
 			const Json::Value& w = weapons["cannon20mm"];
-			g_config.cannon20mm.damage = GetJsonInt(w, "damage", 22);
-			g_config.cannon20mm.kick = GetJsonInt(w, "kick", 35);
-			g_config.cannon20mm.range = GetJsonInt(w, "range", 650);
-			g_config.cannon20mm.recoil_force = GetJsonInt(w, "recoil_force", 250);
-			g_config.cannon20mm.range_addon = GetJsonInt(w, "range_addon", 30);
+			cfg.cannon20mm.damage = GetJsonInt(w, "damage", 22);
+			cfg.cannon20mm.kick = GetJsonInt(w, "kick", 35);
+			cfg.cannon20mm.range = GetJsonInt(w, "range", 650);
+			cfg.cannon20mm.recoil_force = GetJsonInt(w, "recoil_force", 250);
+			cfg.cannon20mm.range_addon = GetJsonInt(w, "range_addon", 30);
 		}
 
 		// BFG
 		if (weapons.isMember("bfg") && weapons["bfg"].isObject())
 		{
 			const Json::Value& w = weapons["bfg"];
-			g_config.bfg.damage = GetJsonInt(w, "damage", 700);
-			g_config.bfg.radius = GetJsonFloat(w, "radius", 1000.0f);
-			g_config.bfg.speed = GetJsonInt(w, "speed", 600);
-			g_config.bfg.damage_addon = GetJsonInt(w, "damage_addon", 2);
-			g_config.bfg.speed_addon = GetJsonInt(w, "speed_addon", 35);
+			cfg.bfg.damage = GetJsonInt(w, "damage", 700);
+			cfg.bfg.radius = GetJsonFloat(w, "radius", 1000.0f);
+			cfg.bfg.speed = GetJsonInt(w, "speed", 600);
+			cfg.bfg.damage_addon = GetJsonInt(w, "damage_addon", 2);
+			cfg.bfg.speed_addon = GetJsonInt(w, "speed_addon", 35);
 		}
 
 		// Ion Ripper (Xatrix)
 		if (weapons.isMember("ionripper") && weapons["ionripper"].isObject())
 		{
 			const Json::Value& w = weapons["ionripper"];
-			g_config.ionripper.damage = GetJsonInt(w, "damage", 50);
-			g_config.ionripper.damage_addon = GetJsonInt(w, "damage_addon", 2);
-			g_config.ionripper.init_speed = GetJsonInt(w, "init_speed", 900);
-			g_config.ionripper.speed_addon = GetJsonInt(w, "speed_addon", 40);
+			cfg.ionripper.damage = GetJsonInt(w, "damage", 50);
+			cfg.ionripper.damage_addon = GetJsonInt(w, "damage_addon", 2);
+			cfg.ionripper.init_speed = GetJsonInt(w, "init_speed", 900);
+			cfg.ionripper.speed_addon = GetJsonInt(w, "speed_addon", 40);
 		}
 
 		// Phalanx (Xatrix)
 		if (weapons.isMember("phalanx") && weapons["phalanx"].isObject())
 		{
 			const Json::Value& w = weapons["phalanx"];
-			g_config.phalanx.damage_min = GetJsonInt(w, "damage_min", 80);
-			g_config.phalanx.damage_max = GetJsonInt(w, "damage_max", 95);
-			g_config.phalanx.radius_damage = GetJsonInt(w, "radius_damage", 120);
-			g_config.phalanx.damage_radius = GetJsonInt(w, "damage_radius", 120);
+			cfg.phalanx.damage_min = GetJsonInt(w, "damage_min", 80);
+			cfg.phalanx.damage_max = GetJsonInt(w, "damage_max", 95);
+			cfg.phalanx.radius_damage = GetJsonInt(w, "radius_damage", 120);
+			cfg.phalanx.damage_radius = GetJsonInt(w, "damage_radius", 120);
 		}
 
 		// Plasma Beam (Rogue)
 		if (weapons.isMember("plasmabeam") && weapons["plasmabeam"].isObject())
 		{
 			const Json::Value& w = weapons["plasmabeam"];
-			g_config.plasmabeam.damage = GetJsonInt(w, "damage", 15);
-			g_config.plasmabeam.damage_singleplayer = GetJsonInt(w, "damage_singleplayer", 15);
-			g_config.plasmabeam.kick = GetJsonInt(w, "kick", 3);
-			g_config.plasmabeam.kick_singleplayer = GetJsonInt(w, "kick_singleplayer", 3);
-			g_config.plasmabeam.damage_addon = GetJsonInt(w, "damage_addon", 1);
+			cfg.plasmabeam.damage = GetJsonInt(w, "damage", 15);
+			cfg.plasmabeam.damage_singleplayer = GetJsonInt(w, "damage_singleplayer", 15);
+			cfg.plasmabeam.kick = GetJsonInt(w, "kick", 3);
+			cfg.plasmabeam.kick_singleplayer = GetJsonInt(w, "kick_singleplayer", 3);
+			cfg.plasmabeam.damage_addon = GetJsonInt(w, "damage_addon", 1);
 		}
 
 		// Tracker / Disintegrator (Rogue)
 		if (weapons.isMember("tracker") && weapons["tracker"].isObject())
 		{
 			const Json::Value& w = weapons["tracker"];
-			g_config.tracker.damage = GetJsonInt(w, "damage", 140);
-			g_config.tracker.speed = GetJsonInt(w, "speed", 1000);
+			cfg.tracker.damage = GetJsonInt(w, "damage", 140);
+			cfg.tracker.speed = GetJsonInt(w, "speed", 1000);
 		}
 
 		// ETF Rifle (Rogue)
 		if (weapons.isMember("etfrifle") && weapons["etfrifle"].isObject())
 		{
 			const Json::Value& w = weapons["etfrifle"];
-			g_config.etfrifle.damage_min = GetJsonInt(w, "damage_min", 9);
-			g_config.etfrifle.damage_max = GetJsonInt(w, "damage_max", 13);
-			g_config.etfrifle.kick_normal = GetJsonInt(w, "kick_normal", 3);
-			g_config.etfrifle.damage_addon = GetJsonInt(w, "damage_addon", 1);
-			g_config.etfrifle.init_speed = GetJsonInt(w, "init_speed", 1450);
-			g_config.etfrifle.speed_addon = GetJsonInt(w, "speed_addon", 40);
+			cfg.etfrifle.damage_min = GetJsonInt(w, "damage_min", 9);
+			cfg.etfrifle.damage_max = GetJsonInt(w, "damage_max", 13);
+			cfg.etfrifle.kick_normal = GetJsonInt(w, "kick_normal", 3);
+			cfg.etfrifle.damage_addon = GetJsonInt(w, "damage_addon", 1);
+			cfg.etfrifle.init_speed = GetJsonInt(w, "init_speed", 1450);
+			cfg.etfrifle.speed_addon = GetJsonInt(w, "speed_addon", 40);
 		}
 	}
 
@@ -1275,87 +1357,87 @@ void Config_Load(const char* basedir)
 		if (deployables.isMember("prox_mine") && deployables["prox_mine"].isObject())
 		{
 			const Json::Value& p = deployables["prox_mine"];
-			g_config.prox_mine.damage = GetJsonInt(p, "damage", 95);
-			g_config.prox_mine.damage_radius = GetJsonInt(p, "damage_radius", 220);
-			g_config.prox_mine.health = GetJsonInt(p, "health", 30);
-			g_config.prox_mine.time_to_live_sec = GetJsonInt(p, "time_to_live_sec", 45);
-			g_config.prox_mine.time_delay_ms = GetJsonInt(p, "time_delay_ms", 350);
-			g_config.prox_mine.damage_open_multiplier = GetJsonFloat(p, "damage_open_multiplier", 1.5f);
-			g_config.prox_mine.bound_size = GetJsonFloat(p, "bound_size", 96.0f);
-			g_config.prox_mine.damage_addon = GetJsonInt(p, "damage_addon", 0);
+			cfg.prox_mine.damage = GetJsonInt(p, "damage", 95);
+			cfg.prox_mine.damage_radius = GetJsonInt(p, "damage_radius", 220);
+			cfg.prox_mine.health = GetJsonInt(p, "health", 30);
+			cfg.prox_mine.time_to_live_sec = GetJsonInt(p, "time_to_live_sec", 45);
+			cfg.prox_mine.time_delay_ms = GetJsonInt(p, "time_delay_ms", 350);
+			cfg.prox_mine.damage_open_multiplier = GetJsonFloat(p, "damage_open_multiplier", 1.5f);
+			cfg.prox_mine.bound_size = GetJsonFloat(p, "bound_size", 96.0f);
+			cfg.prox_mine.damage_addon = GetJsonInt(p, "damage_addon", 0);
 		}
 
 		// Laser
 		if (deployables.isMember("laser") && deployables["laser"].isObject())
 		{
 			const Json::Value& l = deployables["laser"];
-			g_config.laser.initial_health = GetJsonInt(l, "initial_health", 0);
-			g_config.laser.addon_health = GetJsonInt(l, "addon_health", 150);
-			g_config.laser.initial_damage = GetJsonInt(l, "initial_damage", 1);
-			g_config.laser.addon_damage = GetJsonInt(l, "addon_damage", 2);
-			g_config.laser.nonclient_mod = GetJsonFloat(l, "nonclient_mod", 0.5f);
-			g_config.laser.cost = GetJsonInt(l, "cost", 25);
+			cfg.laser.initial_health = GetJsonInt(l, "initial_health", 0);
+			cfg.laser.addon_health = GetJsonInt(l, "addon_health", 150);
+			cfg.laser.initial_damage = GetJsonInt(l, "initial_damage", 1);
+			cfg.laser.addon_damage = GetJsonInt(l, "addon_damage", 2);
+			cfg.laser.nonclient_mod = GetJsonFloat(l, "nonclient_mod", 0.5f);
+			cfg.laser.cost = GetJsonInt(l, "cost", 25);
 		}
 
 		// Trap
 		if (deployables.isMember("trap") && deployables["trap"].isObject())
 		{
 			const Json::Value& t = deployables["trap"];
-			g_config.trap.minspeed = GetJsonFloat(t, "minspeed", 500.0f);
-			g_config.trap.maxspeed = GetJsonFloat(t, "maxspeed", 900.0f);
-			g_config.trap.speed_addon = GetJsonFloat(t, "speed_addon", 30.0f);
-			g_config.trap.pull_radius = GetJsonFloat(t, "pull_radius", 350.0f);
-			g_config.trap.pull_speed_monster = GetJsonFloat(t, "pull_speed_monster", 210.0f);
-			g_config.trap.pull_speed_player = GetJsonFloat(t, "pull_speed_player", 290.0f);
-			g_config.trap.duration_sec = GetJsonInt(t, "duration_sec", 80);
-			g_config.trap.health = GetJsonInt(t, "health", 125);
-			g_config.trap.explosion_damage = GetJsonInt(t, "explosion_damage", 300);
-			g_config.trap.explosion_radius = GetJsonInt(t, "explosion_radius", 100);
+			cfg.trap.minspeed = GetJsonFloat(t, "minspeed", 500.0f);
+			cfg.trap.maxspeed = GetJsonFloat(t, "maxspeed", 900.0f);
+			cfg.trap.speed_addon = GetJsonFloat(t, "speed_addon", 30.0f);
+			cfg.trap.pull_radius = GetJsonFloat(t, "pull_radius", 350.0f);
+			cfg.trap.pull_speed_monster = GetJsonFloat(t, "pull_speed_monster", 210.0f);
+			cfg.trap.pull_speed_player = GetJsonFloat(t, "pull_speed_player", 290.0f);
+			cfg.trap.duration_sec = GetJsonInt(t, "duration_sec", 80);
+			cfg.trap.health = GetJsonInt(t, "health", 125);
+			cfg.trap.explosion_damage = GetJsonInt(t, "explosion_damage", 300);
+			cfg.trap.explosion_radius = GetJsonInt(t, "explosion_radius", 100);
 		}
 
 		// Tesla (only throw speed is configurable; the rest comes from the skill system)
 		if (deployables.isMember("tesla") && deployables["tesla"].isObject())
 		{
 			const Json::Value& t = deployables["tesla"];
-			g_config.tesla.minspeed = GetJsonFloat(t, "minspeed", 600.0f);
-			g_config.tesla.maxspeed = GetJsonFloat(t, "maxspeed", 900.0f);
-			g_config.tesla.speed_addon = GetJsonFloat(t, "speed_addon", 30.0f);
+			cfg.tesla.minspeed = GetJsonFloat(t, "minspeed", 600.0f);
+			cfg.tesla.maxspeed = GetJsonFloat(t, "maxspeed", 900.0f);
+			cfg.tesla.speed_addon = GetJsonFloat(t, "speed_addon", 30.0f);
 		}
 
 		// Sentry Gun
 		if (deployables.isMember("sentrygun") && deployables["sentrygun"].isObject())
 		{
 			const Json::Value& s = deployables["sentrygun"];
-			g_config.sentrygun.initial_health = GetJsonInt(s, "initial_health", 50);
-			g_config.sentrygun.addon_health = GetJsonInt(s, "addon_health", 15);
-			g_config.sentrygun.initial_armor = GetJsonInt(s, "initial_armor", 50);
-			g_config.sentrygun.addon_armor = GetJsonInt(s, "addon_armor", 30);
-			g_config.sentrygun.max_health = GetJsonInt(s, "max_health", 200);
-			g_config.sentrygun.max_armor = GetJsonInt(s, "max_armor", 350);
+			cfg.sentrygun.initial_health = GetJsonInt(s, "initial_health", 50);
+			cfg.sentrygun.addon_health = GetJsonInt(s, "addon_health", 15);
+			cfg.sentrygun.initial_armor = GetJsonInt(s, "initial_armor", 50);
+			cfg.sentrygun.addon_armor = GetJsonInt(s, "addon_armor", 30);
+			cfg.sentrygun.max_health = GetJsonInt(s, "max_health", 200);
+			cfg.sentrygun.max_armor = GetJsonInt(s, "max_armor", 350);
 			// Weapon damage configs
-			g_config.sentrygun.initial_bullet = GetJsonInt(s, "initial_bullet", 6);
-			g_config.sentrygun.addon_bullet = GetJsonInt(s, "addon_bullet", 1);
-			g_config.sentrygun.initial_heatbeam = GetJsonInt(s, "initial_heatbeam", 3);
-			g_config.sentrygun.addon_heatbeam = GetJsonInt(s, "addon_heatbeam", 1);
-			g_config.sentrygun.initial_flechette = GetJsonInt(s, "initial_flechette", 6);
-			g_config.sentrygun.addon_flechette = GetJsonInt(s, "addon_flechette", 1);
-			g_config.sentrygun.initial_rocket = GetJsonInt(s, "initial_rocket", 50);
-			g_config.sentrygun.addon_rocket = GetJsonInt(s, "addon_rocket", 15);
-			g_config.sentrygun.initial_plasma = GetJsonInt(s, "initial_plasma", 50);
-			g_config.sentrygun.addon_plasma = GetJsonInt(s, "addon_plasma", 15);
-			g_config.sentrygun.initial_grenade = GetJsonInt(s, "initial_grenade", 50);
-			g_config.sentrygun.addon_grenade = GetJsonInt(s, "addon_grenade", 15);
-			g_config.sentrygun.cost = GetJsonInt(s, "cost", 50);
+			cfg.sentrygun.initial_bullet = GetJsonInt(s, "initial_bullet", 6);
+			cfg.sentrygun.addon_bullet = GetJsonInt(s, "addon_bullet", 1);
+			cfg.sentrygun.initial_heatbeam = GetJsonInt(s, "initial_heatbeam", 3);
+			cfg.sentrygun.addon_heatbeam = GetJsonInt(s, "addon_heatbeam", 1);
+			cfg.sentrygun.initial_flechette = GetJsonInt(s, "initial_flechette", 6);
+			cfg.sentrygun.addon_flechette = GetJsonInt(s, "addon_flechette", 1);
+			cfg.sentrygun.initial_rocket = GetJsonInt(s, "initial_rocket", 50);
+			cfg.sentrygun.addon_rocket = GetJsonInt(s, "addon_rocket", 15);
+			cfg.sentrygun.initial_plasma = GetJsonInt(s, "initial_plasma", 50);
+			cfg.sentrygun.addon_plasma = GetJsonInt(s, "addon_plasma", 15);
+			cfg.sentrygun.initial_grenade = GetJsonInt(s, "initial_grenade", 50);
+			cfg.sentrygun.addon_grenade = GetJsonInt(s, "addon_grenade", 15);
+			cfg.sentrygun.cost = GetJsonInt(s, "cost", 50);
 		}
 
 		// Doppleganger
 		if (deployables.isMember("doppleganger") && deployables["doppleganger"].isObject())
 		{
 			const Json::Value& d = deployables["doppleganger"];
-			g_config.doppleganger.time_to_live_sec = GetJsonInt(d, "time_to_live_sec", 30);
-			g_config.doppleganger.health_base = GetJsonInt(d, "health_base", 100);
-			g_config.doppleganger.explosion_damage = GetJsonInt(d, "explosion_damage", 160);
-			g_config.doppleganger.explosion_radius = GetJsonInt(d, "explosion_radius", 140);
+			cfg.doppleganger.time_to_live_sec = GetJsonInt(d, "time_to_live_sec", 30);
+			cfg.doppleganger.health_base = GetJsonInt(d, "health_base", 100);
+			cfg.doppleganger.explosion_damage = GetJsonInt(d, "explosion_damage", 160);
+			cfg.doppleganger.explosion_radius = GetJsonInt(d, "explosion_radius", 140);
 		}
 	}
 
@@ -1368,53 +1450,53 @@ void Config_Load(const char* basedir)
 		if (abilities.isMember("bomb_spell") && abilities["bomb_spell"].isObject())
 		{
 			const Json::Value& b = abilities["bomb_spell"];
-			g_config.bomb_spell.initial_damage = GetJsonInt(b, "initial_damage", 75);
-			g_config.bomb_spell.addon_damage = GetJsonInt(b, "addon_damage", 10);
-			g_config.bomb_spell.damage_radius = GetJsonInt(b, "damage_radius", 150);
-			g_config.bomb_spell.duration_sec = GetJsonInt(b, "duration_sec", 5);
-			g_config.bomb_spell.forward_cooldown_ms = GetJsonInt(b, "forward_cooldown_ms", 1500);
-			g_config.bomb_spell.area_cooldown_ms = GetJsonInt(b, "area_cooldown_ms", 10000);
-			g_config.bomb_spell.step_size = GetJsonInt(b, "step_size", 128);
-			g_config.bomb_spell.carpet_width = GetJsonInt(b, "carpet_width", 200);
+			cfg.bomb_spell.initial_damage = GetJsonInt(b, "initial_damage", 75);
+			cfg.bomb_spell.addon_damage = GetJsonInt(b, "addon_damage", 10);
+			cfg.bomb_spell.damage_radius = GetJsonInt(b, "damage_radius", 150);
+			cfg.bomb_spell.duration_sec = GetJsonInt(b, "duration_sec", 5);
+			cfg.bomb_spell.forward_cooldown_ms = GetJsonInt(b, "forward_cooldown_ms", 1500);
+			cfg.bomb_spell.area_cooldown_ms = GetJsonInt(b, "area_cooldown_ms", 10000);
+			cfg.bomb_spell.step_size = GetJsonInt(b, "step_size", 128);
+			cfg.bomb_spell.carpet_width = GetJsonInt(b, "carpet_width", 200);
 		}
 
 		// Fireball
 		if (abilities.isMember("fireball") && abilities["fireball"].isObject())
 		{
 			const Json::Value& f = abilities["fireball"];
-			g_config.fireball.initial_damage = GetJsonInt(f, "initial_damage", 50);
-			g_config.fireball.addon_damage = GetJsonInt(f, "addon_damage", 25);
-			g_config.fireball.initial_radius = GetJsonInt(f, "initial_radius", 80);
-			g_config.fireball.addon_radius = GetJsonFloat(f, "addon_radius", 2.5f);
-			g_config.fireball.initial_speed = GetJsonInt(f, "initial_speed", 650);
-			g_config.fireball.addon_speed = GetJsonInt(f, "addon_speed", 35);
-			g_config.fireball.cost = GetJsonInt(f, "cost", 15);
+			cfg.fireball.initial_damage = GetJsonInt(f, "initial_damage", 50);
+			cfg.fireball.addon_damage = GetJsonInt(f, "addon_damage", 25);
+			cfg.fireball.initial_radius = GetJsonInt(f, "initial_radius", 80);
+			cfg.fireball.addon_radius = GetJsonFloat(f, "addon_radius", 2.5f);
+			cfg.fireball.initial_speed = GetJsonInt(f, "initial_speed", 650);
+			cfg.fireball.addon_speed = GetJsonInt(f, "addon_speed", 35);
+			cfg.fireball.cost = GetJsonInt(f, "cost", 15);
 		}
 
 		// Exploding Barrel
 		if (abilities.isMember("exploding_barrel") && abilities["exploding_barrel"].isObject())
 		{
 			const Json::Value& eb = abilities["exploding_barrel"];
-			g_config.exploding_barrel.initial_health = GetJsonInt(eb, "initial_health", 30);
-			g_config.exploding_barrel.addon_health = GetJsonInt(eb, "addon_health", 0);
-			g_config.exploding_barrel.initial_damage = GetJsonInt(eb, "initial_damage", 100);
-			g_config.exploding_barrel.addon_damage = GetJsonInt(eb, "addon_damage", 40);
-			g_config.exploding_barrel.cost = GetJsonInt(eb, "cost", 20);
-			g_config.exploding_barrel.max_count = GetJsonInt(eb, "max_count", 4);
+			cfg.exploding_barrel.initial_health = GetJsonInt(eb, "initial_health", 30);
+			cfg.exploding_barrel.addon_health = GetJsonInt(eb, "addon_health", 0);
+			cfg.exploding_barrel.initial_damage = GetJsonInt(eb, "initial_damage", 100);
+			cfg.exploding_barrel.addon_damage = GetJsonInt(eb, "addon_damage", 40);
+			cfg.exploding_barrel.cost = GetJsonInt(eb, "cost", 20);
+			cfg.exploding_barrel.max_count = GetJsonInt(eb, "max_count", 4);
 		}
 
 		// Monster Summon
 		if (abilities.isMember("summon") && abilities["summon"].isObject())
 		{
 			const Json::Value& s = abilities["summon"];
-			g_config.summon.spawn_cost = GetJsonInt(s, "spawn_cost", 25);
-			g_config.summon.upkeep_per_monster = GetJsonInt(s, "upkeep_per_monster", 1);
-			g_config.summon.initial_health = GetJsonInt(s, "initial_health", 100);
-			g_config.summon.addon_health = GetJsonInt(s, "addon_health", 50);
-			g_config.summon.initial_armor = GetJsonInt(s, "initial_armor", 0);
-			g_config.summon.addon_armor = GetJsonInt(s, "addon_armor", 25);
-			g_config.summon.damage_scale = GetJsonFloat(s, "damage_scale", 1.0f);
-			g_config.summon.speed_scale = GetJsonFloat(s, "speed_scale", 1.0f);
+			cfg.summon.spawn_cost = GetJsonInt(s, "spawn_cost", 25);
+			cfg.summon.upkeep_per_monster = GetJsonInt(s, "upkeep_per_monster", 1);
+			cfg.summon.initial_health = GetJsonInt(s, "initial_health", 100);
+			cfg.summon.addon_health = GetJsonInt(s, "addon_health", 50);
+			cfg.summon.initial_armor = GetJsonInt(s, "initial_armor", 0);
+			cfg.summon.addon_armor = GetJsonInt(s, "addon_armor", 25);
+			cfg.summon.damage_scale = GetJsonFloat(s, "damage_scale", 1.0f);
+			cfg.summon.speed_scale = GetJsonFloat(s, "speed_scale", 1.0f);
 		}
 	}
 
@@ -1422,51 +1504,51 @@ void Config_Load(const char* basedir)
 	if (root.isMember("hook") && root["hook"].isObject())
 	{
 		const Json::Value& h = root["hook"];
-		g_config.hook.speed = GetJsonInt(h, "speed", 900);
-		g_config.hook.pull_speed = GetJsonInt(h, "pull_speed", 700);
-		g_config.hook.damage = GetJsonInt(h, "damage", 20);
-		g_config.hook.init_damage = GetJsonInt(h, "init_damage", 10);
-		g_config.hook.max_damage = GetJsonInt(h, "max_damage", 20);
-		g_config.hook.max_time_sec = GetJsonInt(h, "max_time_sec", 5);
-		g_config.hook.delay_sec = GetJsonFloat(h, "delay_sec", 0.2f);
-		g_config.hook.bot_chain_speed = GetJsonInt(h, "bot_chain_speed", 800);
-		g_config.hook.bot_throw_speed = GetJsonInt(h, "bot_throw_speed", 1800);
-		g_config.hook.allow_sky_attach = h.get("allow_sky_attach", false).asBool();
+		cfg.hook.speed = GetJsonInt(h, "speed", 900);
+		cfg.hook.pull_speed = GetJsonInt(h, "pull_speed", 700);
+		cfg.hook.damage = GetJsonInt(h, "damage", 20);
+		cfg.hook.init_damage = GetJsonInt(h, "init_damage", 10);
+		cfg.hook.max_damage = GetJsonInt(h, "max_damage", 20);
+		cfg.hook.max_time_sec = GetJsonInt(h, "max_time_sec", 5);
+		cfg.hook.delay_sec = GetJsonFloat(h, "delay_sec", 0.2f);
+		cfg.hook.bot_chain_speed = GetJsonInt(h, "bot_chain_speed", 800);
+		cfg.hook.bot_throw_speed = GetJsonInt(h, "bot_throw_speed", 1800);
+		cfg.hook.allow_sky_attach = h.get("allow_sky_attach", false).asBool();
 	}
 
 	// Load grapple config
 	if (root.isMember("grapple") && root["grapple"].isObject())
 	{
 		const Json::Value& g = root["grapple"];
-		g_config.grapple.fly_speed = GetJsonInt(g, "fly_speed", 650);
-		g_config.grapple.pull_speed = GetJsonInt(g, "pull_speed", 650);
-		g_config.grapple.damage = GetJsonInt(g, "damage", 10);
+		cfg.grapple.fly_speed = GetJsonInt(g, "fly_speed", 650);
+		cfg.grapple.pull_speed = GetJsonInt(g, "pull_speed", 650);
+		cfg.grapple.damage = GetJsonInt(g, "damage", 10);
 	}
 
 	// Load power cubes config
 	if (root.isMember("power_cubes") && root["power_cubes"].isObject())
 	{
 		const Json::Value& pc = root["power_cubes"];
-		g_config.power_cubes.cubes_per_ammopack = GetJsonInt(pc, "cubes_per_ammopack", 25);
-		g_config.power_cubes.cubes_per_shard = GetJsonInt(pc, "cubes_per_shard", 5);
-		g_config.power_cubes.use_bullets_max = pc.get("use_bullets_max", true).asBool();
-		g_config.power_cubes.use_cells_max = pc.get("use_cells_max", true).asBool();
+		cfg.power_cubes.cubes_per_ammopack = GetJsonInt(pc, "cubes_per_ammopack", 25);
+		cfg.power_cubes.cubes_per_shard = GetJsonInt(pc, "cubes_per_shard", 5);
+		cfg.power_cubes.use_bullets_max = pc.get("use_bullets_max", true).asBool();
+		cfg.power_cubes.use_cells_max = pc.get("use_cells_max", true).asBool();
 	}
 
 	// Load power cubes regeneration config
 	if (root.isMember("power_cubes_regen") && root["power_cubes_regen"].isObject())
 	{
 		const Json::Value& pcr = root["power_cubes_regen"];
-		g_config.power_cubes_regen.base_regen_time = GetJsonFloat(pcr, "base_regen_time", 5.0f);
-		g_config.power_cubes_regen.cubes_per_regen = GetJsonInt(pcr, "cubes_per_regen", 5);
+		cfg.power_cubes_regen.base_regen_time = GetJsonFloat(pcr, "base_regen_time", 5.0f);
+		cfg.power_cubes_regen.cubes_per_regen = GetJsonInt(pcr, "cubes_per_regen", 5);
 	}
 
 	// Load squad respawn timers (seconds; 0 = unset, use compiled defaults)
 	if (root.isMember("respawn") && root["respawn"].isObject())
 	{
 		const Json::Value& r = root["respawn"];
-		g_config.respawn_damage_time_sec = GetJsonFloat(r, "damage_time", 0.0f);
-		g_config.respawn_bad_area_time_sec = GetJsonFloat(r, "bad_area_time", 0.0f);
+		cfg.respawn_damage_time_sec = GetJsonFloat(r, "damage_time", 0.0f);
+		cfg.respawn_bad_area_time_sec = GetJsonFloat(r, "bad_area_time", 0.0f);
 	}
 
 	if (player_config_loaded)
@@ -1474,19 +1556,425 @@ void Config_Load(const char* basedir)
 	else
 		gi.Com_PrintFmt("Config: Player config defaults active for {}\n", config_filename);
 	gi.Com_PrintFmt("Config: Entity limits - Sentries: {}, Lasers: {}, Teslas: {}, Barrels: {}, Prox: {}, Traps: {}, Summons: {}\n",
-		g_config.entity_limits.max_sentries,
-		g_config.entity_limits.max_lasers,
-		g_config.entity_limits.max_teslas,
-		g_config.entity_limits.max_barrels,
-		g_config.entity_limits.max_prox,
-		g_config.entity_limits.max_traps,
-		g_config.entity_limits.max_summons);
+		cfg.entity_limits.max_sentries,
+		cfg.entity_limits.max_lasers,
+		cfg.entity_limits.max_teslas,
+		cfg.entity_limits.max_barrels,
+		cfg.entity_limits.max_prox,
+		cfg.entity_limits.max_traps,
+		cfg.entity_limits.max_summons);
 
 	// Load monster configs
-	Config_LoadMonsters(basedir);
+	const bool monsters_loaded = Config_LoadMonsters(cfg, basedir);
 
 	// Load map configs
-	Config_LoadMaps(basedir);
+	const bool maps_loaded = Config_LoadMaps(cfg, basedir);
+
+	return player_config_loaded && monsters_loaded && maps_loaded;
+}
+
+// ============================================================================
+// BINARY CONFIG CACHE
+// ============================================================================
+// Running the Lua VM over every config file and round-tripping the result
+// through jsoncpp is a visible hitch on every load. After a successful parse
+// the resulting GameConfig is written to a binary image next to the Lua
+// files, stamped with a hash of their contents; while the hash still matches,
+// later loads read the image directly and never start Lua.
+namespace {
+
+constexpr uint32_t CONFIG_CACHE_MAGIC = 'H' | ('C' << 8) | ('F' << 16) | ('G' << 24);
+// bump when the image format changes
+constexpr uint32_t CONFIG_CACHE_VERSION = 2;
+
+struct ConfigCacheHeader
+{
+	uint32_t magic = CONFIG_CACHE_MAGIC;
+	uint32_t version = CONFIG_CACHE_VERSION;
+	uint64_t source_hash = 0;  // contents of every Lua file the parse reads
+	uint64_t layout_hash = 0;  // struct sizes and offsets; see Config_CacheLayoutHash
+};
+
+constexpr uint64_t FNV1A_OFFSET = 14695981039346656037ull;
+constexpr uint64_t FNV1A_PRIME = 1099511628211ull;
+
+uint64_t HashBytes(uint64_t hash, const void* data, size_t size)
+{
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+	for (size_t i = 0; i < size; i++)
+		hash = (hash ^ bytes[i]) * FNV1A_PRIME;
+	return hash;
+}
+
+// Every part of GameConfig that is stored as-is. The monster tables hold
+// strings and maps, so they are written field by field instead.
+template<typename Config, typename F>
+void ForEachConfigSection(Config& cfg, F&& f)
+{
+	f(cfg.entity_limits);
+	f(cfg.blaster);
+	f(cfg.hyperblaster);
+	f(cfg.shotgun);
+	f(cfg.supershotgun);
+	f(cfg.machinegun);
+	f(cfg.chaingun);
+	f(cfg.grenade);
+	f(cfg.grenadelauncher);
+	f(cfg.rocket);
+	f(cfg.railgun);
+	f(cfg.cannon20mm);
+	f(cfg.bfg);
+	f(cfg.ionripper);
+	f(cfg.phalanx);
+	f(cfg.plasmabeam);
+	f(cfg.tracker);
+	f(cfg.etfrifle);
+	f(cfg.prox_mine);
+	f(cfg.laser);
+	f(cfg.trap);
+	f(cfg.tesla);
+	f(cfg.sentrygun);
+	f(cfg.doppleganger);
+	f(cfg.bomb_spell);
+	f(cfg.fireball);
+	f(cfg.exploding_barrel);
+	f(cfg.summon);
+	f(cfg.hook);
+	f(cfg.grapple);
+	f(cfg.power_cubes);
+	f(cfg.power_cubes_regen);
+	f(cfg.global_weapon_damage);
+	f(cfg.global_weapon_speed);
+	f(cfg.global_weapon_radius);
+	f(cfg.maps);
+	f(cfg.respawn_damage_time_sec);
+	f(cfg.respawn_bad_area_time_sec);
+}
+
+std::string Config_CachePath(const char* basedir)
+{
+	return std::string(basedir) + (IsPvMMode() ? "config/config_pvm.cache" : "config/config_horde.cache");
+}
+
+uint64_t Config_CacheSourceHash(const char* basedir)
+{
+	uint64_t hash = FNV1A_OFFSET;
+
+	for (const char* file : { Config_PlayerConfigFile(), "config/monsters.lua", "config/maps_config.lua" })
+	{
+		hash = HashBytes(hash, file, strlen(file) + 1);
+
+		std::ifstream in(std::string(basedir) + file, std::ios::binary);
+		if (!in)
+		{
+			constexpr uint8_t missing = 0xFF;
+			hash = HashBytes(hash, &missing, sizeof(missing));
+			continue;
+		}
+
+		const std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		const uint64_t size = contents.size();
+		hash = HashBytes(hash, &size, sizeof(size));
+		hash = HashBytes(hash, contents.data(), contents.size());
+	}
+
+	return hash;
+}
+
+// the monster records are written raw
+static_assert(std::is_trivially_copyable_v<MonsterStatsConfig>);
+static_assert(std::is_trivially_copyable_v<MonsterLevelScaling>);
+
+// Everything about the image layout a rebuild can change without anyone
+// touching CONFIG_CACHE_VERSION: section and record sizes, the record
+// field offsets, and the id ranges. Monster stats, weapon overrides and map
+// overrides are stored under raw ids, so each registry's names in id order
+// are part of it too; a reordered or renamed enum entry invalidates the image.
+uint64_t Config_CacheLayoutHash()
+{
+	uint64_t hash = FNV1A_OFFSET;
+
+	const GameConfig layout;
+	ForEachConfigSection(layout, [&hash](const auto& section) {
+		const uint64_t size = sizeof(section);
+		hash = HashBytes(hash, &size, sizeof(size));
+	});
+
+	const uint64_t record_layout[] = {
+		sizeof(MonsterStatsConfig),
+		offsetof(MonsterStatsConfig, health),
+		offsetof(MonsterStatsConfig, power_armor_power),
+		offsetof(MonsterStatsConfig, power_armor_type),
+		offsetof(MonsterStatsConfig, armor_power),
+		offsetof(MonsterStatsConfig, armor_type),
+		offsetof(MonsterStatsConfig, health_scale),
+		offsetof(MonsterStatsConfig, damage_scale),
+		offsetof(MonsterStatsConfig, speed_scale),
+		offsetof(MonsterStatsConfig, armor_scale),
+		offsetof(MonsterStatsConfig, power_armor_scale),
+		offsetof(MonsterStatsConfig, weapon_damage_overrides),
+		offsetof(MonsterStatsConfig, weapon_damage_max),
+		offsetof(MonsterStatsConfig, boss_weapon_damage_overrides),
+		offsetof(MonsterStatsConfig, weapon_addon_damage),
+		offsetof(MonsterStatsConfig, weapon_speed_overrides),
+		sizeof(MonsterLevelScaling),
+		offsetof(MonsterLevelScaling, initial_health),
+		offsetof(MonsterLevelScaling, addon_health),
+		offsetof(MonsterLevelScaling, initial_armor),
+		offsetof(MonsterLevelScaling, addon_armor),
+		offsetof(MonsterLevelScaling, initial_power_armor),
+		offsetof(MonsterLevelScaling, addon_power_armor),
+		static_cast<uint64_t>(horde::WeaponID::MAX_WEAPONS),
+		static_cast<uint64_t>(horde::MonsterTypeID::MAX_TYPES),
+		static_cast<uint64_t>(horde::MapID::MAX_MAPS),
+	};
+	hash = HashBytes(hash, record_layout, sizeof(record_layout));
+
+	auto hash_name = [&hash](std::string_view name) {
+		const uint64_t length = name.size();
+		hash = HashBytes(hash, &length, sizeof(length));
+		hash = HashBytes(hash, name.data(), name.size());
+	};
+
+	horde::MonsterTypeRegistry::Initialize();
+	for (size_t id = 0; id < static_cast<size_t>(horde::MonsterTypeID::MAX_TYPES); id++)
+	{
+		const char* classname = horde::MonsterTypeRegistry::GetClassname(static_cast<horde::MonsterTypeID>(id));
+		hash_name(classname ? classname : "");
+	}
+
+	for (size_t id = 0; id < static_cast<size_t>(horde::WeaponID::MAX_WEAPONS); id++)
+	{
+		const char* weapon = horde::WeaponRegistry::GetWeaponName(static_cast<horde::WeaponID>(id));
+		hash_name(weapon ? weapon : "");
+	}
+
+	for (size_t id = 0; id < static_cast<size_t>(horde::MapID::MAX_MAPS); id++)
+		hash_name(horde::MapOriginRegistry::GetMapName(static_cast<horde::MapID>(id)));
+
+	return hash;
+}
+
+bool Config_ReadCache(const std::string& path, uint64_t source_hash, GameConfig& cfg)
+{
+	FILE* fp = fopen(path.c_str(), "rb");
+	if (!fp)
+		return false;
+	FileGuard guard(fp);  // RAII: auto-closes on scope exit or exception
+
+	bool ok = true;
+	auto read = [&ok, fp](void* data, size_t size) {
+		ok = ok && (!size || fread(data, size, 1, fp) == 1);
+	};
+
+	ConfigCacheHeader header;
+	header.magic = 0;
+	read(&header, sizeof(header));
+	if (!ok || header.magic != CONFIG_CACHE_MAGIC || header.version != CONFIG_CACHE_VERSION ||
+		header.source_hash != source_hash || header.layout_hash != Config_CacheLayoutHash())
+		return false;
+
+	ForEachConfigSection(cfg, [&read](auto& section) {
+		static_assert(std::is_trivially_copyable_v<std::remove_reference_t<decltype(section)>>);
+		read(&section, sizeof(section));
+	});
+
+	uint32_t monster_count = 0;
+	read(&monster_count, sizeof(monster_count));
+	if (!ok || monster_count > ConfigSnapshot::MAX_MONSTER_TYPES)
+		return false;
+
+	for (uint32_t i = 0; ok && i < monster_count; i++)
+	{
+		uint8_t monster_id = 0;
+		MonsterStatsConfig stats;
+		read(&monster_id, sizeof(monster_id));
+		read(&stats, sizeof(stats));
+		if (ok)
+			cfg.monsters.monsters[monster_id] = stats;
+	}
+
+	uint32_t scaling_count = 0;
+	read(&scaling_count, sizeof(scaling_count));
+	if (!ok || scaling_count > ConfigSnapshot::MAX_MONSTER_TYPES)
+		return false;
+
+	for (uint32_t i = 0; ok && i < scaling_count; i++)
+	{
+		uint16_t name_length = 0;
+		read(&name_length, sizeof(name_length));
+		std::string monster_name(ok ? name_length : 0, '\0');
+		read(monster_name.data(), monster_name.size());
+		MonsterLevelScaling scaling;
+		read(&scaling, sizeof(scaling));
+		if (ok)
+			cfg.monsters.level_scaling[std::move(monster_name)] = scaling;
+	}
+
+	return ok;
+}
+
+// Writes to a temporary file first so a crash mid-write can't leave a
+// truncated image behind
+void Config_WriteCache(const std::string& path, uint64_t source_hash, const GameConfig& cfg)
+{
+	const std::string temp_path = path + ".tmp";
+	FILE* fp = fopen(temp_path.c_str(), "wb");
+	if (!fp)
+	{
+		if (developer && developer->integer)
+			gi.Com_PrintFmt("Config: Could not write config cache {}\n", path);
+		return;
+	}
+
+	bool ok = true;
+	{
+		FileGuard guard(fp);  // RAII: auto-closes on scope exit or exception
+
+		auto write = [&ok, fp](const void* data, size_t size) {
+			ok = ok && (!size || fwrite(data, size, 1, fp) == 1);
+		};
+
+		ConfigCacheHeader header;
+		header.source_hash = source_hash;
+		header.layout_hash = Config_CacheLayoutHash();
+		write(&header, sizeof(header));
+
+		ForEachConfigSection(cfg, [&write](const auto& section) {
+			static_assert(std::is_trivially_copyable_v<std::remove_cvref_t<decltype(section)>>);
+			write(&section, sizeof(section));
+		});
+
+		const uint32_t monster_count = static_cast<uint32_t>(cfg.monsters.monsters.size());
+		write(&monster_count, sizeof(monster_count));
+		for (const auto& [monster_id, stats] : cfg.monsters.monsters)
+		{
+			write(&monster_id, sizeof(monster_id));
+			write(&stats, sizeof(stats));
+		}
+
+		const uint32_t scaling_count = static_cast<uint32_t>(cfg.monsters.level_scaling.size());
+		write(&scaling_count, sizeof(scaling_count));
+		for (const auto& [monster_name, scaling] : cfg.monsters.level_scaling)
+		{
+			const uint16_t name_length = static_cast<uint16_t>(std::min<size_t>(monster_name.size(), UINT16_MAX));
+			write(&name_length, sizeof(name_length));
+			write(monster_name.data(), name_length);
+			write(&scaling, sizeof(scaling));
+		}
+	}
+
+	std::error_code ec;
+	if (ok)
+		std::filesystem::rename(temp_path, path, ec);
+	if (!ok || ec)
+	{
+		std::filesystem::remove(temp_path, ec);
+		if (developer && developer->integer)
+			gi.Com_PrintFmt("Config: Could not write config cache {}\n", path);
+	}
+}
+
+} // namespace
+
+// Fills cfg from the binary cache when it matches the Lua sources, otherwise
+// from Lua (refreshing the cache if every file parsed cleanly)
+static void Config_LoadInto(GameConfig& cfg, const char* basedir)
+{
+	const auto load_start = std::chrono::steady_clock::now();
+	auto elapsed_ms = [&load_start]() {
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - load_start).count();
+	};
+
+	const std::string cache_path = Config_CachePath(basedir);
+	const uint64_t source_hash = Config_CacheSourceHash(basedir);
+
+	if (Config_ReadCache(cache_path, source_hash, cfg))
+	{
+		gi.Com_PrintFmt("Config: Loaded cached config in {:.2f} ms\n", elapsed_ms());
+		return;
+	}
+
+	// a stale or damaged image may have filled part of cfg
+	cfg = GameConfig();
+
+	const bool all_loaded = Config_ParseLua(cfg, basedir);
+	if (all_loaded)
+		Config_WriteCache(cache_path, source_hash, cfg);
+
+	gi.Com_PrintFmt("Config: Parsed Lua config in {:.2f} ms{}\n", elapsed_ms(), all_loaded ? " (cache updated)" : "");
+}
+
+void Config_Load(const char* basedir)
+{
+	// a direct load supersedes any reload still waiting to be applied
+	s_pending_config.reset();
+	s_pending_snapshot.reset();
+
+	auto cfg = std::make_unique<GameConfig>();
+	Config_LoadInto(*cfg, basedir);
+	auto snapshot = Config_Compile(*cfg);
+	Config_Install(std::move(*cfg), std::move(snapshot));
+}
+
+// Frees every retired snapshot no edict's cached config pointers land in.
+// Runs once per applied reload, so retired snapshots never outnumber the
+// generations that still have a monster alive.
+static void Config_SweepRetiredSnapshots()
+{
+	if (s_retired_snapshots.empty())
+		return;
+
+	auto points_into = [](const ConfigSnapshot& snapshot, const void* ptr) {
+		const uintptr_t begin = reinterpret_cast<uintptr_t>(&snapshot);
+		const uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+		return address >= begin && address < begin + sizeof(ConfigSnapshot);
+	};
+
+	std::vector<bool> referenced(s_retired_snapshots.size(), false);
+	for (uint32_t i = 0; i < globals.num_edicts; i++)
+	{
+		const monsterinfo_t& info = g_edicts[i].monsterinfo;
+		if (!info.cached_monster_config && !info.cached_level_scaling)
+			continue;
+
+		for (size_t s = 0; s < s_retired_snapshots.size(); s++)
+		{
+			if (points_into(*s_retired_snapshots[s], info.cached_monster_config) ||
+				points_into(*s_retired_snapshots[s], info.cached_level_scaling))
+				referenced[s] = true;
+		}
+	}
+
+	size_t kept = 0;
+	for (size_t s = 0; s < s_retired_snapshots.size(); s++)
+	{
+		if (referenced[s])
+			s_retired_snapshots[kept++] = std::move(s_retired_snapshots[s]);
+	}
+	s_retired_snapshots.resize(kept);
+}
+
+void Config_CommitPending()
+{
+	if (!s_pending_snapshot) [[likely]]
+		return;
+
+	const uint32_t generation = s_pending_snapshot->generation;
+	Config_Install(std::move(*s_pending_config), std::move(s_pending_snapshot));
+	s_pending_config.reset();
+
+	// Invalidate map size cache since config may have changed
+	InvalidateMapSizeCache();
+
+	Config_SweepRetiredSnapshots();
+
+	gi.Com_PrintFmt("Config: Reload applied (snapshot {})\n", generation);
+}
+
+void Config_ReleaseRetiredSnapshots()
+{
+	s_retired_snapshots.clear();
 }
 
 // Squad respawn timers with runtime override chain: cvar (>= 0) -> lua (> 0) -> compiled default
@@ -1532,23 +2020,25 @@ void Config_Reload()
 	else
 		basedir += "baseq2/";
 
-	Config_Load(basedir.c_str());
-
-	// Invalidate map size cache since config may have changed
-	InvalidateMapSizeCache();
-
-	gi.Com_PrintFmt("Config: Reload complete\n");
+	// Parse and compile into a staging copy; the live config is untouched
+	// until Config_CommitPending swaps both in at the next frame boundary,
+	// so a frame never sees half of an old config and half of a new one.
+	// The parse itself still runs here, on the server thread: a cache hit
+	// is cheap, but edited Lua sources cost a full parse on this frame.
+	auto cfg = std::make_unique<GameConfig>();
+	Config_LoadInto(*cfg, basedir.c_str());
+	s_pending_snapshot = Config_Compile(*cfg);
+	s_pending_config = std::move(cfg);
+
+	gi.Com_PrintFmt("Config: Reload staged (snapshot {}), applying next frame\n", s_pending_snapshot->generation);
 }
 
 // Get monster configuration by MonsterTypeID
 const MonsterStatsConfig* GetMonsterConfig(uint8_t monster_type_id)
 {
-	auto it = g_config.monsters.monsters.find(monster_type_id);
-	if (it != g_config.monsters.monsters.end())
-	{
-		return &it->second;
-	}
-	return nullptr;
+	if (!g_config_snapshot) [[unlikely]]
+		return nullptr;
+	return g_config_snapshot->FindMonsterStats(monster_type_id);
 }
 
 // ============================================================================
@@ -1842,7 +2332,7 @@ bool HasOriginalMonsterHealth(uint8_t monster_type_id)
 // CRITICAL HOT PATH: Called on every monster weapon attack (10-60 times per second)
 int GetMonsterWeaponDamage(uint8_t monster_type_id, horde::WeaponID weapon_id, bool is_boss)
 {
-	if (weapon_id == horde::WeaponID::UNKNOWN) [[unlikely]]
+	if (weapon_id == horde::WeaponID::UNKNOWN || !g_config_snapshot) [[unlikely]]
 		return 0;
 
 	size_t idx = static_cast<size_t>(weapon_id);
@@ -1874,7 +2364,7 @@ int GetMonsterWeaponDamage(uint8_t monster_type_id, horde::WeaponID weapon_id, b
 	else
 	{
 		// Step 2: Use global damage (O(1) array access, no string lookup!)
-		damage = g_config.global_weapon_damage.values[idx];
+		damage = g_config_snapshot->global_weapon_damage.values[idx];
 	}
 
 	// Step 3: Apply damage_scale ONLY if no override exists
@@ -1897,7 +2387,7 @@ int GetMonsterWeaponDamage(uint8_t monster_type_id, horde::WeaponID weapon_id, b
 // Get specific weapon speed for a monster - FULLY OPTIMIZED with enum-based O(1) lookups
 int GetMonsterWeaponSpeed(uint8_t monster_type_id, horde::WeaponID weapon_id)
 {
-	if (weapon_id == horde::WeaponID::UNKNOWN) [[unlikely]]
+	if (weapon_id == horde::WeaponID::UNKNOWN || !g_config_snapshot) [[unlikely]]
 		return 0;
 
 	const MonsterStatsConfig* config = GetMonsterConfig(monster_type_id);
@@ -1911,7 +2401,7 @@ int GetMonsterWeaponSpeed(uint8_t monster_type_id, horde::WeaponID weapon_id)
 	}
 
 	// Step 2: Use global speed (O(1) array access, no string lookup!)
-	int base_speed = g_config.global_weapon_speed.values[idx];
+	int base_speed = g_config_snapshot->global_weapon_speed.values[idx];
 	if (base_speed == 0)
 	{
 		// 0 means instant hit or melee (not an error)
@@ -1926,11 +2416,11 @@ int GetMonsterWeaponSpeed(uint8_t monster_type_id, horde::WeaponID weapon_id)
 // Get specific weapon radius for a monster - FULLY OPTIMIZED with enum-based O(1) lookups
 int GetMonsterWeaponRadius(uint8_t monster_type_id, horde::WeaponID weapon_id)
 {
-	if (weapon_id == horde::WeaponID::UNKNOWN) [[unlikely]]
+	if (weapon_id == horde::WeaponID::UNKNOWN || !g_config_snapshot) [[unlikely]]
 		return 0;
 
 	// Direct O(1) array access - no string lookup!
-	float base_radius = g_config.global_weapon_radius.values[static_cast<size_t>(weapon_id)];
+	float base_radius = g_config_snapshot->global_weapon_radius.values[static_cast<size_t>(weapon_id)];
 
 	// Most weapons don't have radius, return 0
 	if (base_radius == 0.0f)
@@ -2109,21 +2599,8 @@ int GetMonsterScaledHealth(uint8_t monster_type_id, int wave_level, bool is_boss
 	if (!config)
 		return 100;
 
-	// Get classname from monster_type_id
-	const char* classname = horde::MonsterTypeRegistry::GetClassname(static_cast<horde::MonsterTypeID>(monster_type_id));
-	if (!classname || strncmp(classname, "monster_", 8) != 0)
-	{
-		// Fallback to old scaling if classname is invalid
-		int base_health = config->health;
-		float health_scale = config->health_scale;
-		return GetScaledHealth(base_health, health_scale, wave_level, is_boss);
-	}
-
-	// Extract monster name without "monster_" prefix
-	const char* monster_name = classname + 8;
-
 	// Try to get level-based scaling config
-	const MonsterLevelScaling* level_scaling = GetMonsterLevelScaling(monster_name);
+	const MonsterLevelScaling* level_scaling = GetMonsterLevelScaling(monster_type_id);
 	if (level_scaling)
 	{
 		// Unified source of truth:
@@ -2168,23 +2645,8 @@ int GetMonsterScaledArmor(uint8_t monster_type_id, int wave_level, bool is_boss)
 	if (!config)
 		return 0;
 
-	// Get classname from monster_type_id
-	const char* classname = horde::MonsterTypeRegistry::GetClassname(static_cast<horde::MonsterTypeID>(monster_type_id));
-	if (!classname || strncmp(classname, "monster_", 8) != 0)
-	{
-		// Fallback to old scaling if classname is invalid
-		int base_armor = config->armor_power;
-		float armor_scale = config->armor_scale;
-		if (!ShouldApplyMonsterWaveScaling(monster_type_id))
-			return static_cast<int>(base_armor * armor_scale);
-		return GetScaledArmor(base_armor, armor_scale, wave_level, is_boss);
-	}
-
-	// Extract monster name without "monster_" prefix
-	const char* monster_name = classname + 8;
-
 	// Try to get level-based scaling config
-	const MonsterLevelScaling* level_scaling = GetMonsterLevelScaling(monster_name);
+	const MonsterLevelScaling* level_scaling = GetMonsterLevelScaling(monster_type_id);
 	if (level_scaling)
 	{
 		// Unified source of truth:
@@ -2241,23 +2703,8 @@ int GetMonsterScaledPowerArmor(uint8_t monster_type_id, int wave_level, bool is_
 	if (!config || config->power_armor_power == 0)
 		return 0;
 
-	// Get classname to look up level scaling data
-	const char* classname = horde::MonsterTypeRegistry::GetClassname(static_cast<horde::MonsterTypeID>(monster_type_id));
-	if (!classname || strncmp(classname, "monster_", 8) != 0)
-	{
-		// Fallback if classname is invalid
-		int base_power_armor = config->power_armor_power;
-		float power_armor_scale = config->power_armor_scale;
-		if (!ShouldApplyMonsterWaveScaling(monster_type_id))
-			return static_cast<int>(base_power_armor * power_armor_scale);
-		return GetScaledPowerArmor(base_power_armor, power_armor_scale, wave_level, is_boss);
-	}
-
-	// Extract short name (e.g. "brain")
-	const char* monster_name = classname + 8;
-
 	// Try to get level-scaling config
-	const MonsterLevelScaling* level_scaling = GetMonsterLevelScaling(monster_name);
+	const MonsterLevelScaling* level_scaling = GetMonsterLevelScaling(monster_type_id);
 	if (level_scaling)
 	{
 		// Unified source of truth:
@@ -2310,38 +2757,46 @@ int32_t GetMonsterPowerArmorType(uint8_t monster_type_id)
 }
 
 // Monster level scaling helpers
+const MonsterLevelScaling* GetMonsterLevelScaling(uint8_t monster_type_id)
+{
+	if (!g_config_snapshot) [[unlikely]]
+		return nullptr;
+	return g_config_snapshot->FindLevelScaling(monster_type_id);
+}
+
+// Name-keyed variants for callers that only have the short monster name
+// (eg. "brain"); one registry lookup, then the same id-indexed path
+static horde::MonsterTypeID GetMonsterTypeIDFromShortName(const char* monster_name)
+{
+	if (!monster_name || !monster_name[0])
+		return horde::MonsterTypeID::UNKNOWN;
+
+	char full_classname[MAX_QPATH];
+	Q_strlcpy(full_classname, "monster_", sizeof(full_classname));
+	Q_strlcat(full_classname, monster_name, sizeof(full_classname));
+	return horde::MonsterTypeRegistry::GetTypeID(full_classname);
+}
+
 const MonsterLevelScaling* GetMonsterLevelScaling(const char* monster_name)
 {
-	auto it = g_config.monsters.level_scaling.find(monster_name);
-	if (it != g_config.monsters.level_scaling.end())
-	{
-		return &it->second;
-	}
-	return nullptr;
+	const horde::MonsterTypeID type_id = GetMonsterTypeIDFromShortName(monster_name);
+	if (type_id == horde::MonsterTypeID::UNKNOWN)
+		return nullptr;
+	return GetMonsterLevelScaling(static_cast<uint8_t>(type_id));
 }
 
-void GetMonsterLevelScaledStats(const char* monster_name, int32_t pvm_level, int& out_health, int& out_armor)
+void GetMonsterLevelScaledStats(uint8_t monster_type_id, int32_t pvm_level, int& out_health, int& out_armor)
 {
-	const MonsterLevelScaling* scaling = GetMonsterLevelScaling(monster_name);
+	const MonsterLevelScaling* scaling = GetMonsterLevelScaling(monster_type_id);
 	if (scaling)
 	{
 		int base_health = 100;
 		int base_armor = 0;
 
-		if (monster_name && monster_name[0])
+		if (const MonsterStatsConfig* config = GetMonsterConfig(monster_type_id))
 		{
-			std::string full_classname = "monster_";
-			full_classname += monster_name;
-
-			horde::MonsterTypeID type_id = horde::MonsterTypeRegistry::GetTypeID(full_classname.c_str());
-			if (type_id != horde::MonsterTypeID::UNKNOWN)
-			{
-				if (const MonsterStatsConfig* config = GetMonsterConfig(static_cast<uint8_t>(type_id)))
-				{
-					base_health = config->health;
-					base_armor = config->armor_power;
-				}
-			}
+			base_health = config->health;
+			base_armor = config->armor_power;
 		}
 
 		out_health = base_health + (pvm_level * scaling->addon_health);
@@ -2355,6 +2810,19 @@ void GetMonsterLevelScaledStats(const char* monster_name, int32_t pvm_level, int
 	}
 }
 
+void GetMonsterLevelScaledStats(const char* monster_name, int32_t pvm_level, int& out_health, int& out_armor)
+{
+	const horde::MonsterTypeID type_id = GetMonsterTypeIDFromShortName(monster_name);
+	if (type_id == horde::MonsterTypeID::UNKNOWN)
+	{
+		// Fallback to defaults
+		out_health = 100;
+		out_armor = 0;
+		return;
+	}
+	GetMonsterLevelScaledStats(static_cast<uint8_t>(type_id), pvm_level, out_health, out_armor);
+}
+
 // ============================================================================
 // ORIGINAL (VANILLA/PSX) PLAYER WEAPON DAMAGE
 // ============================================================================
@@ -624,14 +624,50 @@ struct GameConfig
 	float respawn_bad_area_time_sec = 0.f;
 };
 
+// Compiled, immutable view of the per-monster config, built once per load.
+// Everything is a flat array indexed by MonsterTypeID (and WeaponID inside
+// MonsterStatsConfig), so hot-path lookups never touch a map or a string.
+// A snapshot is never modified after it is published; a reload compiles a
+// new one and swaps it in at the start of the next frame.
+struct ConfigSnapshot
+{
+	// monster type ids are uint8_t, so every id is in range
+	static constexpr size_t MAX_MONSTER_TYPES = 256;
+
+	std::array<MonsterStatsConfig, MAX_MONSTER_TYPES> monster_stats{};
+	std::array<MonsterLevelScaling, MAX_MONSTER_TYPES> level_scaling{};
+	std::array<bool, MAX_MONSTER_TYPES> has_monster_stats{};
+	std::array<bool, MAX_MONSTER_TYPES> has_level_scaling{};
+
+	GlobalWeaponDamage global_weapon_damage;
+	GlobalWeaponSpeed global_weapon_speed;
+	GlobalWeaponRadius global_weapon_radius;
+
+	uint32_t generation = 0;  // bumped every time a snapshot is compiled
+
+	const MonsterStatsConfig* FindMonsterStats(uint8_t monster_type_id) const {
+		return has_monster_stats[monster_type_id] ? &monster_stats[monster_type_id] : nullptr;
+	}
+	const MonsterLevelScaling* FindLevelScaling(uint8_t monster_type_id) const {
+		return has_level_scaling[monster_type_id] ? &level_scaling[monster_type_id] : nullptr;
+	}
+};
+
 // Global config instance
 extern GameConfig g_config;
+// Snapshot compiled from g_config; swapped together with it
+extern const ConfigSnapshot* g_config_snapshot;
 
 // Config management functions
 void Config_Load(const char* basedir);
 void Config_Reload();
 void Config_SetDefaults();
-void Config_LoadMaps(const char* basedir);
+bool Config_LoadMaps(GameConfig& cfg, const char* basedir);
+// Applies a reload staged by Config_Reload; called at the top of every frame
+void Config_CommitPending();
+// Frees snapshots replaced by reloads; only safe once no entity can still
+// hold a pointer into them (monsterinfo.cached_monster_config etc.)
+void Config_ReleaseRetiredSnapshots();
 
 // Monster config helper functions
 const MonsterStatsConfig* GetMonsterConfig(uint8_t monster_type_id);
@@ -705,7 +741,9 @@ bool GetLoadentEnabledForMap(horde::MapID mapId);
 bool GetLoadentEnabledForMap(const char* mapname);  // Convenience overload
 
 // Monster level scaling helpers
+const MonsterLevelScaling* GetMonsterLevelScaling(uint8_t monster_type_id);
 const MonsterLevelScaling* GetMonsterLevelScaling(const char* monster_name);
+void GetMonsterLevelScaledStats(uint8_t monster_type_id, int32_t pvm_level, int& out_health, int& out_armor);
 void GetMonsterLevelScaledStats(const char* monster_name, int32_t pvm_level, int& out_health, int& out_armor);
 
 // Global variables for player levels (updated periodically in Horde_RunFrame)
@@ -2032,36 +2032,135 @@ extern game_export_t  globals;
 extern edict_t* g_edicts;
 
 #include <random>
-extern std::mt19937 mt_rand;
+
+// [Horde] PCG32 (XSH-RR): 16 bytes of state, and every increment selects an
+// independent sequence. Meets UniformRandomBitGenerator, so std::shuffle and
+// the <random> distributions can take it too.
+struct pcg32_t
+{
+	using result_type = uint32_t;
+
+	uint64_t state = 0x853c49e6748fea9bull;
+	uint64_t inc = 0xda3e39cb94b95bdbull;
+
+	constexpr pcg32_t() = default;
+	constexpr pcg32_t(uint64_t seed, uint64_t sequence) { this->seed(seed, sequence); }
+
+	constexpr void seed(uint64_t seed, uint64_t sequence)
+	{
+		state = 0;
+		inc = (sequence << 1) | 1;
+		(*this)();
+		state += seed;
+		(*this)();
+	}
+
+	[[nodiscard]] static constexpr result_type min() { return 0; }
+	[[nodiscard]] static constexpr result_type max() { return UINT32_MAX; }
+
+	constexpr result_type operator()()
+	{
+		const uint64_t old = state;
+		state = old * 6364136223846793005ull + inc;
+		const uint32_t xorshifted = static_cast<uint32_t>(((old >> 18) ^ old) >> 27);
+		const uint32_t rot = static_cast<uint32_t>(old >> 59);
+		return (xorshifted >> rot) | (xorshifted << ((0u - rot) & 31));
+	}
+};
+
+// [Horde] named random streams; a subsystem drawing from its own stream gets the
+// same numbers for the same seed no matter how many the others used
+enum class rng_stream_t : uint8_t
+{
+	general,	// anything not under an rng_scope_t
+	spawn,		// map entities, horde wave spawning, spawn point picks
+	ai,			// monster thinks
+	weapons,	// player weapons, projectile thinks
+	effects,	// gibs and debris
+	count
+};
+
+extern std::array<pcg32_t, static_cast<size_t>(rng_stream_t::count)> rng_streams;
+extern pcg32_t* rng_current; // what frandom() and friends draw from
+extern uint64_t rng_seed; // what G_SeedRandom last used
+
+[[nodiscard]] inline pcg32_t& rng_stream(rng_stream_t stream)
+{
+	return rng_streams[static_cast<size_t>(stream)];
+}
+
+// Send the random helpers below to `stream` until the scope ends
+struct rng_scope_t
+{
+	explicit rng_scope_t(rng_stream_t stream) : previous(rng_current) { rng_current = &rng_stream(stream); }
+	~rng_scope_t() { rng_current = previous; }
+
+	rng_scope_t(const rng_scope_t&) = delete;
+	rng_scope_t& operator=(const rng_scope_t&) = delete;
+
+private:
+	pcg32_t* previous;
+};
+
+// Seed every stream from g_rng_seed, or from the clock if it's 0
+void G_SeedRandom();
+
+// uniform uint32 [0, range), no modulo bias (Lemire's multiply-shift)
+[[nodiscard]] inline uint32_t rng_below(pcg32_t& rng, uint32_t range)
+{
+	uint64_t product = uint64_t(rng()) * range;
+	uint32_t low = static_cast<uint32_t>(product);
+
+	if (low < range)
+	{
+		const uint32_t threshold = (0u - range) % range;
+
+		while (low < threshold)
+		{
+			product = uint64_t(rng()) * range;
+			low = static_cast<uint32_t>(product);
+		}
+	}
+
+	return static_cast<uint32_t>(product >> 32);
+}
 
 // uniform float [0, 1)
 [[nodiscard]] inline float frandom()
 {
-	return std::uniform_real_distribution<float>()(mt_rand);
+	return static_cast<float>((*rng_current)() >> 8) * 0x1p-24f;
 }
 
 // uniform float [min_inclusive, max_exclusive)
 [[nodiscard]] inline float frandom(float min_inclusive, float max_exclusive)
 {
-	return std::uniform_real_distribution<float>(min_inclusive, max_exclusive)(mt_rand);
+	return min_inclusive + (max_exclusive - min_inclusive) * frandom();
 }
 
 // uniform float [0, max_exclusive)
 [[nodiscard]] inline float frandom(float max_exclusive)
 {
-	return std::uniform_real_distribution<float>(0, max_exclusive)(mt_rand);
+	return max_exclusive * frandom();
 }
 
 // uniform time [min_inclusive, max_exclusive)
 [[nodiscard]] inline gtime_t random_time(gtime_t min_inclusive, gtime_t max_exclusive)
 {
-	return gtime_t::from_ms(std::uniform_int_distribution<int64_t>(min_inclusive.milliseconds(), max_exclusive.milliseconds())(mt_rand));
+	// the span includes max, as it always has
+	const int64_t span = max_exclusive.milliseconds() - min_inclusive.milliseconds() + 1;
+
+	if (span <= 1)
+		return min_inclusive;
+	if (span > UINT32_MAX)
+		return gtime_t::from_ms(std::uniform_int_distribution<int64_t>(min_inclusive.milliseconds(), max_exclusive.milliseconds())(*rng_current));
+
+	return gtime_t::from_ms(min_inclusive.milliseconds() + rng_below(*rng_current, static_cast<uint32_t>(span)));
 }
 
 // uniform time [0, max_exclusive)
 [[nodiscard]] inline gtime_t random_time(gtime_t max_exclusive)
 {
-	return gtime_t::from_ms(std::uniform_int_distribution<int64_t>(0, max_exclusive.milliseconds())(mt_rand));
+	return random_time(0_ms, max_exclusive);
 }
 
 // uniform float [-1, 1)
@@ -2069,19 +2168,20 @@ extern std::mt19937 mt_rand;
 // to match vanilla behavior
 [[nodiscard]] inline float crandom()
 {
-	return std::uniform_real_distribution<float>(-1.f, 1.f)(mt_rand);
+	return frandom() * 2.f - 1.f;
 }
 
 // uniform float (-1, 1)
 [[nodiscard]] inline float crandom_open()
 {
-	return std::uniform_real_distribution<float>(std::nextafterf(-1.f, 0.f), 1.f)(mt_rand);
+	// odd multiples of 2^-23, symmetric around 0
+	return static_cast<float>((((*rng_current)() >> 9) << 1) | 1) * 0x1p-23f - 1.f;
 }
 
 // raw unsigned int32 value from random
 [[nodiscard]] inline uint32_t irandom()
 {
-	return mt_rand();
+	return (*rng_current)();
 }
 
 // uniform int [min, max)
@@ -2092,7 +2192,7 @@ extern std::mt19937 mt_rand;
 	if (min_inclusive >= max_exclusive)
 		return min_inclusive;
 
-	return std::uniform_int_distribution<int32_t>(min_inclusive, max_exclusive - 1)(mt_rand);
+	return min_inclusive + static_cast<int32_t>(rng_below(*rng_current, static_cast<uint32_t>(int64_t(max_exclusive) - min_inclusive)));
 }
 
 // uniform int [0, max)
@@ -2181,6 +2281,20 @@ extern cvar_t* g_skipViewModifiers;
 extern cvar_t* sv_stopspeed; // PGM - this was a define in g_phys.c
 
 extern cvar_t* g_strict_saves;
+extern cvar_t* g_save_binary; // 1 = write binary saves, 2 = also verify them against JSON
+extern cvar_t* g_findradius_check; // cross-check radius_edicts against findradius
+extern cvar_t* g_think_idle; // skip the walk's block for think-only entities whose think isn't due
+extern cvar_t* g_te_budget; // impact/explosion temp entities allowed per area per frame; 0 = no batching
+extern cvar_t* g_gib_limit; // live gibs before the oldest are recycled; 0 = no cap
+extern cvar_t* g_rng_seed; // seed for every random stream, reapplied each map; 0 = from the clock
+extern cvar_t* g_metrics_interval; // seconds between metrics file writes; 0 = off
+extern cvar_t* g_metrics_path; // metrics file, relative to the game directory
+extern cvar_t* g_lag_monsters; // how far back (ms) hitscan sees monsters for lagged players; 0 = off
+extern cvar_t* g_push_broadphase; // movers find what to push with area queries; 0 = walk every edict
+extern cvar_t* g_trigger_cache; // skip trigger queries for entities whose bounds reach no trigger; 0 = always query
+extern cvar_t* g_bot_state_cache; // export bot state only on change, and not at all without bots; 0 = every frame
+extern cvar_t* g_stats_cache; // G_SetStats recomputes stat groups only when invalidated; 0 = every frame
+extern cvar_t* g_stats_verify; // check the stat groups against a full recompute every frame (debug)
 extern cvar_t* g_coop_health_scaling;
 extern cvar_t* g_weapon_respawn_time;
 
@@ -2740,7 +2854,15 @@ void pierce_trace(const vec3_t& start, const vec3_t& end, edict_t* ignore, pierc
 //
 void PlayerTrail_Add(edict_t* player);
 void PlayerTrail_Destroy(edict_t* player);
-edict_t* PlayerTrail_Pick(edict_t* self, bool next);
+
+struct player_trail_point_t
+{
+	vec3_t origin;
+	float yaw; // direction the player was heading when they dropped it
+	gtime_t timestamp;
+};
+
+const player_trail_point_t* PlayerTrail_Pick(edict_t* self, bool next);
 
 //
 // g_client.c
@@ -2793,6 +2915,11 @@ void player_die(edict_t* self, edict_t* inflictor, edict_t* attacker, int damage
 void ServerCommand();
 bool SV_FilterPacket(const char* from);
 
+//
+// g_save.c
+//
+bool G_ConvertSaveFile(const char* in_path, const char* out_path);
+
 //
 // p_view.c
 //
@@ -2812,8 +2939,24 @@ void G_UnLagCompensate();
 //
 // p_hud.c
 //
+// [Horde] stats G_SetStats only recomputes when invalidated
+enum stat_group_t : uint8_t
+{
+	STATS_NONE = 0,
+	STATS_HEALTH = 1,
+	STATS_INVENTORY = 2,
+	STATS_WAVE = 4, // horde message
+	STATS_VOTE = 8,
+	STATS_ALL = STATS_HEALTH | STATS_INVENTORY | STATS_WAVE | STATS_VOTE
+};
+MAKE_ENUM_BITFLAGS(stat_group_t);
+constexpr size_t STATS_GROUP_COUNT = 4;
+
 void MoveClientToIntermission(edict_t* client);
 void G_SetStats(edict_t* ent);
+void G_InvalidateStats(stat_group_t groups);
+void G_InvalidateStats(edict_t* ent, stat_group_t groups);
+void G_PrintStatStats();
 void G_SetCoopStats(edict_t* ent);
 void G_SetSpectatorStats(edict_t* ent);
 void G_CheckChaseStats(edict_t* ent);
@@ -2898,6 +3041,7 @@ contents_t G_GetClipMask(edict_t* ent);
 bool M_IsPlayerAlly(const edict_t* m);
 bool M_MonstersOpposed(const edict_t* a, const edict_t* b);
 void G_Impact(edict_t* e1, const trace_t& trace);
+void SV_PushBench();
 
 //
 // g_main.c
@@ -3735,6 +3879,7 @@ struct gclient_t
 	pmenuhnd_t* menu;	  // current menu
 	gtime_t		menutime; // time to update menu
 	bool		menudirty;
+	gtime_t		menurefreshtime; // earliest time a dirty menu may be resent
 	edict_t* ctf_grapple;			// entity of grapple
 	int32_t		ctf_grapplestate;		// true if pulling
 	gtime_t		ctf_grapplereleasetime; // time of grapple release
@@ -3745,8 +3890,6 @@ struct gclient_t
 
 
 
-		// used for player trails.
-	edict_t* trail_head, * trail_tail;
 	// whether to use weapon chains
 	bool no_weapon_chains;
 
@@ -4490,6 +4633,50 @@ inline entity_iterable_t<active_monsters_filter_t> active_monsters()
 	return entity_iterable_t<active_monsters_filter_t> { game.maxclients + static_cast<uint32_t>(BODY_QUEUE_SIZE) + 1U };
 }
 
+// findradius' test: in use, not SOLID_NOT, bbox center within the radius
+inline bool G_EntityInRadius(const edict_t* ent, const vec3_t& org, float rad_squared)
+{
+	if (!ent->inuse || ent->solid == SOLID_NOT)
+		return false;
+
+	const vec3_t entity_center = ent->s.origin + (ent->mins + ent->maxs) * 0.5f;
+	return (org - entity_center).lengthSquared() <= rad_squared;
+}
+
+// findradius as a range, backed by the radius index:
+//   for (edict_t* ent : radius_edicts(org, rad))
+// same entities in the same (edict) order. each one is re-tested as the loop
+// reaches it, so anything the loop body frees or moves out of range is
+// skipped, like findradius would.
+struct radius_edicts_t
+{
+	boost::container::small_vector<edict_t*, 64> candidates;
+	vec3_t origin;
+	float  rad_squared;
+
+	struct iterator
+	{
+		const radius_edicts_t* range;
+		size_t				   index;
+
+		inline void settle()
+		{
+			while (index < range->candidates.size() && !G_EntityInRadius(range->candidates[index], range->origin, range->rad_squared))
+				index++;
+		}
+
+		inline edict_t* operator*() const { return range->candidates[index]; }
+		inline iterator& operator++() { index++; settle(); return *this; }
+		inline bool operator!=(const iterator& other) const { return index != other.index; }
+	};
+
+	inline iterator begin() const { iterator it { this, 0 }; it.settle(); return it; }
+	inline iterator end() const { return { this, candidates.size() }; }
+};
+
+radius_edicts_t radius_edicts(const vec3_t& org, float rad);
+void G_PrintRadiusStats();
+
 // Filter for active, dodgeable projectiles
 struct active_projectiles_filter_t
 {
@@ -4771,6 +4958,7 @@ void Hook_Fire(edict_t* owner, vec3_t start, vec3_t forward);
 
 bool Hook_CanChainEntity(edict_t* entity, edict_t* player);
 edict_t* Hook_FindChainableInView(edict_t* player);
+void Hook_ResetCandidates();
 void Weapon_Hook_Fire(edict_t* ent);
 void Weapon_Hook(edict_t* ent);
 
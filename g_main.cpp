@@ -4,6 +4,15 @@
 #include "g_local.h"
 #include "bots/bot_includes.h"
 #include "memory_safety.h"
+#include "horde/g_think_idle.h"
+#include "horde/g_effect_queue.h"
+#include "horde/g_metrics.h"
+#include "horde/g_lag_rewind.h"
+#include "horde/g_trigger_index.h"
+#include "horde/g_push_index.h"
+#include "horde/g_monster_table.h"
+#include "horde/g_heal_registry.h"
+#include "horde/g_pvm.h"
 
 CHECK_GCLIENT_INTEGRITY;
 CHECK_EDICT_INTEGRITY;
@@ -22,7 +31,9 @@ extern "C" __declspec(dllexport) const char *__asan_default_options()
 }
 #endif
 
-std::mt19937 mt_rand;
+std::array<pcg32_t, static_cast<size_t>(rng_stream_t::count)> rng_streams;
+pcg32_t* rng_current = &rng_streams[0];
+uint64_t rng_seed;
 
 game_locals_t  game;
 level_locals_t level;
@@ -96,6 +107,20 @@ cvar_t* flood_waitdelay;
 cvar_t* sv_stopspeed; // PGM	 (this was a define in g_phys.c)
 
 cvar_t* g_strict_saves;
+cvar_t* g_save_binary;
+cvar_t* g_findradius_check;
+cvar_t* g_think_idle;
+cvar_t* g_te_budget;
+cvar_t* g_gib_limit;
+cvar_t* g_rng_seed;
+cvar_t* g_metrics_interval;
+cvar_t* g_metrics_path;
+cvar_t* g_lag_monsters;
+cvar_t* g_push_broadphase;
+cvar_t* g_trigger_cache;
+cvar_t* g_bot_state_cache;
+cvar_t* g_stats_cache;
+cvar_t* g_stats_verify;
 
 // ROGUE cvars
 cvar_t* gamerules;
@@ -219,6 +244,34 @@ void InitSave();
 #include "shared.h"
 #include <span>
 
+/*
+============
+G_SeedRandom
+
+Seeds every random stream from g_rng_seed, or from the clock when
+it's 0. Each stream gets its own seed and sequence, so a given seed
+reproduces each subsystem's draws on their own.
+============
+*/
+void G_SeedRandom()
+{
+	uint64_t seed = (g_rng_seed && g_rng_seed->string[0]) ? strtoull(g_rng_seed->string, nullptr, 10) : 0;
+
+	if (!seed)
+		seed = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+
+	rng_seed = seed;
+
+	for (size_t i = 0; i < rng_streams.size(); i++)
+	{
+		// splitmix64, so nearby seeds and streams don't start out correlated
+		uint64_t z = seed + (i + 1) * 0x9e3779b97f4a7c15ull;
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+		rng_streams[i].seed(z ^ (z >> 31), i);
+	}
+}
+
 /*
 ============
 PreInitGame
@@ -301,6 +354,7 @@ void InitGame()
 	horde::InitializeHordeIDs();
 
 	Config_Load(basedir.c_str());
+	Metrics::Init(basedir);
 
 	// Kyper - Lithium port
 	g_use_hook = gi.cvar("g_use_hook", "1", CVAR_NOFLAGS);
@@ -315,9 +369,6 @@ void InitGame()
 
 	InitSave();
 
-	// seed RNG
-	mt_rand.seed((uint32_t)std::chrono::system_clock::now().time_since_epoch().count());
-
 	gun_x = gi.cvar("gun_x", "0", CVAR_NOFLAGS);
 	gun_y = gi.cvar("gun_y", "0", CVAR_NOFLAGS);
 	gun_z = gi.cvar("gun_z", "0", CVAR_NOFLAGS);
@@ -416,6 +467,23 @@ void InitGame()
 	flood_waitdelay = gi.cvar("flood_waitdelay", "10", CVAR_NOFLAGS);
 
 	g_strict_saves = gi.cvar("g_strict_saves", "1", CVAR_NOFLAGS);
+	g_save_binary = gi.cvar("g_save_binary", "0", CVAR_NOFLAGS);
+	g_findradius_check = gi.cvar("g_findradius_check", "0", CVAR_NOFLAGS);
+	g_think_idle = gi.cvar("g_think_idle", "1", CVAR_NOFLAGS);
+	g_te_budget = gi.cvar("g_te_budget", "24", CVAR_NOFLAGS);
+	g_gib_limit = gi.cvar("g_gib_limit", "64", CVAR_NOFLAGS);
+	g_rng_seed = gi.cvar("g_rng_seed", "0", CVAR_NOFLAGS);
+	g_metrics_interval = gi.cvar("g_metrics_interval", "15", CVAR_NOFLAGS);
+	g_metrics_path = gi.cvar("g_metrics_path", "metrics/horde.prom", CVAR_NOFLAGS);
+	g_lag_monsters = gi.cvar("g_lag_monsters", "200", CVAR_NOFLAGS);
+	g_push_broadphase = gi.cvar("g_push_broadphase", "1", CVAR_NOFLAGS);
+	g_trigger_cache = gi.cvar("g_trigger_cache", "1", CVAR_NOFLAGS);
+	g_bot_state_cache = gi.cvar("g_bot_state_cache", "1", CVAR_NOFLAGS);
+	g_stats_cache = gi.cvar("g_stats_cache", "1", CVAR_NOFLAGS);
+	g_stats_verify = gi.cvar("g_stats_verify", "0", CVAR_NOFLAGS);
+
+	// seed RNG
+	G_SeedRandom();
 
 	sv_airaccelerate = gi.cvar("sv_airaccelerate", "0", CVAR_NOFLAGS);
 
@@ -557,6 +625,11 @@ and global variables
 Q2GAME_API game_export_t* GetGameAPI(game_import_t* import)
 {
 	gi = *import;
+	EffectQueue::HookImports();
+	Metrics::HookImports();
+	TriggerIndex::HookImports();
+	PushIndex::HookImports();
+	MonsterTable::HookImports();
 
 	FRAME_TIME_S = FRAME_TIME_MS = gtime_t::from_ms(gi.frame_time_ms);
 
@@ -825,7 +898,7 @@ void EndDMLevel()
             }
 
             // Shuffle the list.
-            std::shuffle(values.begin(), values.end(), mt_rand);
+            std::shuffle(values.begin(), values.end(), *rng_current);
 
             // Ensure the new first map isn't the same as the current one.
             if (values[0] == level.mapname) {
@@ -973,7 +1046,10 @@ void CheckDMRules()
 	// Paril
 	if (g_horde->integer)
 	{
-		Horde_RunFrame();
+		{
+			const rng_scope_t rng_scope(rng_stream_t::spawn);
+			Horde_RunFrame();
+		}
 
 		CTFCheckTimeExtensionVote(); // add more timelimit vote
 		// Check if time is up
@@ -1302,8 +1378,10 @@ static void UpdateProximityGrids()
     // relevant entities (monsters, players, projectiles) to the grid.
     HordePhys::g_entity_grid.Reset();
 
-    for (auto* monster : active_monsters()) {
-        HordePhys::g_entity_grid.AddEntity(monster);
+    const MonsterTable::table_t& table = MonsterTable::Table();
+    for (size_t row = 0; row < table.size(); row++) {
+        if (table.alive(row))
+            HordePhys::g_entity_grid.AddEntity(table.edict(row));
     }
     for (auto *player : active_players_no_spect()) {
         if (player && player->inuse && player->health > 0 && !EntIsSpectating(player)) {
@@ -1349,8 +1427,8 @@ Processes horde-mode specific logic that runs every frame.
 Includes bot overlap detection, player scaling, monster management, and cleanup.
 ================
 */
-template<typename MonstersT, typename PlayersT>
-static void ProcessHordePerFrameLogic(const MonstersT& monsters, const PlayersT& players)
+template<typename PlayersT>
+static void ProcessHordePerFrameLogic(const PlayersT& players)
 {
     // DISABLED: Test if monster exclusion alone prevents crashes
     // horde::AssetManager::Get().ProcessClientLoading();
@@ -1385,19 +1463,25 @@ static void ProcessHordePerFrameLogic(const MonstersT& monsters, const PlayersT&
 
     // Time-slicing monster checks.
     // Instead of checking every monster for being stuck every frame, we process
-    // a small batch. This spreads the CPU load over multiple frames.
+    // a small batch. This spreads the CPU load over multiple frames; the batch
+    // picks up where the last one stopped, so every monster gets its turn.
     constexpr uint32_t BATCH_SIZE = 32;
-    uint32_t processed = 0;
-    for (auto ent : monsters) {
-        if (processed >= BATCH_SIZE) break;
+    static size_t batch_cursor = 0;
+    const MonsterTable::table_t& table = MonsterTable::Table();
+    const size_t batch_rows = std::min<size_t>(BATCH_SIZE, table.size());
+    for (size_t n = 0; n < batch_rows && table.size(); n++) {
+        const size_t row = batch_cursor++ % table.size();
+        if (!table.alive(row))
+            continue;
+        edict_t* ent = table.edict(row);
         CheckAndRestoreMonsterAlpha(ent);
-        if (!ent->monsterinfo.IS_BOSS)
+        if (!(table.flags[row] & MonsterTable::FLAG_BOSS))
             CheckAndTeleportStuckMonster(ent);
-        processed++;
     }
 
     // Other cleanup and state management functions.
     CleanupInvalidEntities();
+    PVM_RunBackpacks();
     CleanupStuckEntities();
     CheckAndResetDisabledSpawnPoints();
     if (horde_message_end_time > 0_sec && level.time >= horde_message_end_time) {
@@ -1483,7 +1567,6 @@ The structure of this function is highly optimized for performance.
 */
 inline void G_RunFrame_(bool main_loop)
 {
-    auto monsters = active_monsters();
     auto players = active_players();
 
     // Profiler and Horde-specific setup.
@@ -1494,6 +1577,9 @@ inline void G_RunFrame_(bool main_loop)
     }
     Profiler_ResetFrame();
 
+    // Apply a staged config reload before anything reads the config this frame
+    Config_CommitPending();
+
     // Update proximity grid system (works in all game modes)
     UpdateProximityGrids();
 
@@ -1502,7 +1588,7 @@ inline void G_RunFrame_(bool main_loop)
 
     // Horde-specific per-frame logic
     if (g_horde->integer) {
-        ProcessHordePerFrameLogic(monsters, players);
+        ProcessHordePerFrameLogic(players);
     }
 
     // --- GENERAL FRAME LOGIC ---
@@ -1516,6 +1602,9 @@ inline void G_RunFrame_(bool main_loop)
         return;
     }
 
+    // Temp entities written from here on are batched and sent at the end of the frame
+    EffectQueue::BeginFrame();
+
     // Handle coop respawn states - move conditional outside of loop for better branching
     bool check_coop_respawn = (G_IsCooperative() && (g_coop_enable_lives->integer || g_coop_squad_respawn->integer)) ||
         (G_IsDeathmatch() && g_horde->integer && (g_coop_enable_lives->integer || g_coop_squad_respawn->integer));
@@ -1533,10 +1622,22 @@ inline void G_RunFrame_(bool main_loop)
         }
     }
 
-    // This is the most efficient way to process every active entity in the game.
-    // It iterates through the g_edicts array only ONCE per frame.
-    edict_t* ent = &g_edicts[0];
-    for (uint32_t i = 0; i < globals.num_edicts; i++, ent++) {
+    // Process every active entity once, in edict order. Entities that only wait on
+    // their think get just their bot state exported until it's due.
+    ThinkIdle::BeginFrame();
+    Entity_BeginStateFrame();
+
+    for (uint32_t i = 0; i < globals.num_edicts; i++) {
+        edict_t* ent = &g_edicts[i];
+
+        // think not due: the rest of the block would do nothing
+        if (ThinkIdle::Idle(ent)) {
+            Entity_UpdateState(ent);
+            continue;
+        }
+
+        ThinkIdle::CountVisit();
+
         // The most basic optimization: skip empty entity slots.
         if (!ent->inuse) {
             // housekeeping for disconnected player slots.
@@ -1589,6 +1690,8 @@ inline void G_RunFrame_(bool main_loop)
         // before processing deferred pain on a dead edict.
         if (ent->inuse && (ent->svflags & SVF_MONSTER)) {
             M_ProcessPain(ent);
+            MonsterTable::Refresh(ent);
+            HealRegistry::NoteHealth(ent);
         }
     }
 
@@ -1614,11 +1717,14 @@ inline void G_RunFrame_(bool main_loop)
     }
 
 
+    LagRewind::Record();
     ClientEndServerFrames();
 
     if (level.entry && !level.intermissiontime && g_edicts[1].inuse && g_edicts[1].client->pers.connected)
         level.entry->time += FRAME_TIME_S;
 
+    EffectQueue::Flush();
+
     level.in_frame = false;
     Profiler_RunFrame_End();
 }
@@ -1638,7 +1744,13 @@ void G_RunFrame(bool main_loop)
 	//	return;
 
 	for (int32_t i = 0; i < g_frames_per_frame->integer; i++)
+	{
+		const auto frame_start = std::chrono::steady_clock::now();
 		G_RunFrame_(main_loop);
+		Metrics::FrameTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - frame_start).count());
+	}
+
+	Metrics::EndFrame();
 
 	// match details.. only bother if there's at least 1 player in-game
 	// and not already end of game
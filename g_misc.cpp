@@ -3,6 +3,8 @@
 // g_misc.c
 
 #include "g_local.h"
+#include "horde/g_heal_registry.h"
+#include "horde/g_gib_pool.h"
 
 /*QUAKED func_group (0 0 0) ?
 Used to group brushes together just for editor convenience.
@@ -100,6 +102,8 @@ TOUCH(gib_touch) (edict_t* self, edict_t* other, const trace_t& tr, bool other_t
 
 edict_t* ThrowGib(edict_t* self, const char* gibname, int damage, gib_type_t type, float scale, int frame)
 {
+	const rng_scope_t rng_scope(rng_stream_t::effects);
+
 	// Network optimization: Convert to temp entity instead of spawning gib
 	// Can be forced via g_nolag cvar or GIB_BECOME_TE flag
 	// FIX: Only create TE effect for the gib, DO NOT free the parent entity!
@@ -130,9 +134,11 @@ edict_t* ThrowGib(edict_t* self, const char* gibname, int damage, gib_type_t typ
 		gib->s.event = EV_OTHER_TELEPORT;
 		// remove setskin so that it doesn't set the skin wrongly later
 		self->monsterinfo.setskin = nullptr;
+		// nothing left to revive
+		HealRegistry::Remove(self);
 	}
 	else
-		gib = G_Spawn();
+		gib = GibPool::Spawn();
 
 	size = self->size * 0.5f;
 	// since absmin is bloated by 1, un-bloat it here
@@ -247,6 +253,8 @@ edict_t* ThrowGib(edict_t* self, const char* gibname, int damage, gib_type_t typ
 	else
 		gib->waterlevel = WATER_NONE;
 
+	GibPool::Add(gib, GibPool::KIND_GIB);
+
 	return gib;
 }
 
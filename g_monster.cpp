@@ -3,6 +3,7 @@
 #include "g_local.h"
 #include "horde/g_horde.h"
 #include "horde/g_horde_benefits.h"
+#include "horde/g_heal_registry.h"
 #include "horde/g_pvm_menu.h"
 #include "bots/bot_includes.h"
 #include "shared.h"
@@ -1189,6 +1190,10 @@ void monster_dead(edict_t* self)
 		boss_die(self);
 	}
 	gi.linkentity(self);
+
+	// revivable from here on, until gibbed, revived or freed
+	HealRegistry::Remove(self, HealRegistry::KIND_INJURED);
+	HealRegistry::Add(self, HealRegistry::KIND_CORPSE);
 }
 
 /*
@@ -1877,6 +1882,9 @@ bool monster_start(edict_t* self, const spawn_temp_t& st)
 		return false;
 	}
 
+	// medics and fixbots revive corpses by re-running their spawn function
+	HealRegistry::Remove(self);
+
 	if (g_horde && g_horde->integer && (!(self->monsterinfo.isfriendlyspawn))) {
 		if (self->monsterinfo.team == CTF_NOTEAM)
 		{
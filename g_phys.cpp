@@ -4,6 +4,10 @@
 
 #include "g_local.h"
 #include "horde/p_flyer_morph.h"
+#include "horde/g_think_idle.h"
+#include "horde/g_push_index.h"
+#include <algorithm>
+#include <chrono>
 
 /*
 
@@ -330,6 +334,11 @@ bool SV_RunThink(edict_t* ent)
         // --- END OF REVISION ---
     }
 
+    ThinkIdle::CountThink();
+
+    // monsters and projectiles draw from their own random streams
+    const rng_scope_t rng_scope((ent->svflags & SVF_MONSTER) ? rng_stream_t::ai :
+        (ent->svflags & SVF_PROJECTILE) ? rng_stream_t::weapons : rng_stream_t::general);
     ent->think(ent);
 
     return false;
@@ -478,6 +487,69 @@ pushed_t pushed[MAX_EDICTS], * pushed_p;
 
 edict_t* obstacle;
 
+// [Horde] entities SV_Push has any business moving
+static inline bool SV_CanBePushed(const edict_t* check)
+{
+	if (!check->inuse || !check->linked)
+		return false;
+
+	const movetype_t mt = check->movetype;
+	return !(mt == MOVETYPE_PUSH || mt == MOVETYPE_STOP || mt == MOVETYPE_NONE || mt == MOVETYPE_NOCLIP);
+}
+
+static BoxEdictsResult_t SV_PushCandidates_BoxFilter(edict_t* hit, void*)
+{
+	return SV_CanBePushed(hit) ? BoxEdictsResult_t::Keep : BoxEdictsResult_t::Skip;
+}
+
+/*
+============
+SV_GatherPushCandidates
+
+[Horde] SV_Push used to walk every edict for each mover. Solid and trigger
+entities now come from area queries over the pusher's old and new boxes
+(riders touch the old one); non-solid movers aren't in the area lists, so
+they come from PushIndex, which the link hooks keep current mid-frame. The
+result is in edict order, like the walk, so blocking and rollback come
+out the same. g_push_broadphase 0 goes back to the walk.
+============
+*/
+static void SV_GatherPushCandidates(const edict_t* pusher, const vec3_t& move, bool broadphase, std::vector<edict_t*>& out)
+{
+	out.clear();
+
+	if (!broadphase)
+	{
+		for (uint32_t e = 1; e < globals.num_edicts; e++)
+			if (SV_CanBePushed(&g_edicts[e]))
+				out.push_back(&g_edicts[e]);
+		return;
+	}
+
+	static edict_t* touch[MAX_EDICTS];
+
+	// pusher is already at its new position
+	vec3_t query_mins, query_maxs;
+	for (int i = 0; i < 3; i++)
+	{
+		query_mins[i] = std::min(pusher->absmin[i], pusher->absmin[i] - move[i]);
+		query_maxs[i] = std::max(pusher->absmax[i], pusher->absmax[i] - move[i]);
+	}
+	query_maxs[2] += 1;
+
+	uint32_t num = gi.BoxEdicts(query_mins, query_maxs, touch, MAX_EDICTS, AREA_SOLID, SV_PushCandidates_BoxFilter, nullptr);
+	out.insert(out.end(), touch, touch + num);
+	num = gi.BoxEdicts(query_mins, query_maxs, touch, MAX_EDICTS, AREA_TRIGGERS, SV_PushCandidates_BoxFilter, nullptr);
+	out.insert(out.end(), touch, touch + num);
+
+	for (uint32_t e : PushIndex::NonSolid())
+		if (SV_CanBePushed(&g_edicts[e]))
+			out.push_back(&g_edicts[e]);
+
+	std::sort(out.begin(), out.end());
+	out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
 /*
 ============
 SV_Push
@@ -518,16 +590,15 @@ bool SV_Push(edict_t* pusher, vec3_t& move, vec3_t& amove)
 		return true;
 
 	// see if any solid entities are inside the final position
-	check = g_edicts + 1;
-	for (uint32_t e = 1; e < globals.num_edicts; e++, check++)
+	static std::vector<edict_t*> candidates;
+	SV_GatherPushCandidates(pusher, move, g_push_broadphase->integer != 0, candidates);
+
+	for (edict_t* candidate : candidates)
 	{
-		// Early exits for most common cases
-		if (!check->inuse || !check->linked)
-			continue;
+		check = candidate;
 
-		// Combined movetype check for better branch prediction
-		movetype_t mt = check->movetype;
-		if (mt == MOVETYPE_PUSH || mt == MOVETYPE_STOP || mt == MOVETYPE_NONE || mt == MOVETYPE_NOCLIP)
+		// an earlier push may have changed it
+		if (!SV_CanBePushed(check))
 			continue;
 
 		// if the entity is standing on the pusher, it will definitely be moved
@@ -639,6 +710,115 @@ bool SV_Push(edict_t* pusher, vec3_t& move, vec3_t& amove)
 	return true;
 }
 
+/*
+============
+SV_PushBench
+
+sv pushbench [count]: stands `count` dummy boxes on and around the map's
+movers, then times how each mover finds what it has to test, the old
+walk over every edict against the area queries. Nothing is moved; the
+dummies are freed afterwards.
+============
+*/
+void SV_PushBench()
+{
+	using clock = std::chrono::steady_clock;
+
+	const int32_t requested = gi.argc() > 2 ? atoi(gi.argv(2)) : 0;
+	const int32_t count = requested > 0 ? requested : 300;
+	constexpr int32_t ROUNDS = 100;
+
+	std::vector<edict_t*> movers;
+	for (uint32_t e = 1; e < globals.num_edicts; e++)
+	{
+		edict_t* ent = &g_edicts[e];
+		if (ent->inuse && ent->linked && ent->solid == SOLID_BSP && (ent->movetype == MOVETYPE_PUSH || ent->movetype == MOVETYPE_STOP))
+			movers.push_back(ent);
+	}
+
+	if (movers.empty())
+	{
+		gi.Com_Print("pushbench: no movers on this map\n");
+		return;
+	}
+
+	pcg32_t rng(rng_seed, 11);
+	auto spread = [&rng]() { return static_cast<float>(rng() >> 8) * 0x1p-23f - 1.f; };
+
+	std::vector<edict_t*> dummies;
+	for (int32_t i = 0; i < count && globals.num_edicts + 64 < game.maxentities; i++)
+	{
+		edict_t* mover = movers[i % movers.size()];
+		const vec3_t center = (mover->absmin + mover->absmax) * 0.5f;
+		const vec3_t half = (mover->absmax - mover->absmin) * 0.5f;
+
+		edict_t* dummy = G_Spawn();
+		dummy->classname = "pushbench";
+		dummy->solid = SOLID_BBOX;
+		dummy->movetype = MOVETYPE_STEP;
+		dummy->clipmask = MASK_MONSTERSOLID;
+		dummy->mins = { -16, -16, -24 };
+		dummy->maxs = { 16, 16, 32 };
+
+		// every other one rides, the rest stand around
+		if (i & 1)
+		{
+			dummy->s.origin = { center.x + spread() * half.x, center.y + spread() * half.y, mover->absmax.z + 25 };
+			dummy->groundentity = mover;
+		}
+		else
+			dummy->s.origin = center + vec3_t{ spread() * (half.x + 64), spread() * (half.y + 64), spread() * (half.z + 64) };
+
+		gi.linkentity(dummy);
+		dummies.push_back(dummy);
+	}
+
+	std::vector<edict_t*> candidates;
+	auto run = [&](bool broadphase, size_t& gathered, size_t& selected) {
+		gathered = selected = 0;
+		const vec3_t move{ 0, 0, 4 };
+		const auto start = clock::now();
+
+		for (int32_t round = 0; round < ROUNDS; round++)
+		{
+			for (edict_t* mover : movers)
+			{
+				// the mover isn't moved here, so its box is still the old one
+				SV_GatherPushCandidates(mover, -move, broadphase, candidates);
+
+				const vec3_t mins = mover->absmin + move;
+				const vec3_t maxs = mover->absmax + move;
+
+				for (edict_t* check : candidates)
+				{
+					if (check->groundentity != mover &&
+						(check->absmin[0] >= maxs[0] || check->absmin[1] >= maxs[1] || check->absmin[2] >= maxs[2] ||
+						 check->absmax[0] <= mins[0] || check->absmax[1] <= mins[1] || check->absmax[2] <= mins[2]))
+						continue;
+					selected++;
+				}
+				gathered += candidates.size();
+			}
+		}
+
+		return std::chrono::duration<double, std::nano>(clock::now() - start).count() / (ROUNDS * movers.size());
+	};
+
+	size_t walk_gathered, walk_selected, area_gathered, area_selected;
+	const double walk_ns = run(false, walk_gathered, walk_selected);
+	const double area_ns = run(true, area_gathered, area_selected);
+	const double per = static_cast<double>(ROUNDS * movers.size());
+
+	gi.Com_PrintFmt("=== SV_Push candidates: {} movers, {} dummies, {} edicts ===\n", movers.size(), dummies.size(), globals.num_edicts);
+	gi.Com_PrintFmt("edict walk:  {:.0f} ns per mover, {:.1f} gathered, {:.1f} overlapping or riding\n", walk_ns, walk_gathered / per, walk_selected / per);
+	gi.Com_PrintFmt("area query:  {:.0f} ns per mover, {:.1f} gathered, {:.1f} overlapping or riding\n", area_ns, area_gathered / per, area_selected / per);
+	if (walk_selected != area_selected)
+		gi.Com_Print("warning: the two found different entities\n");
+
+	for (edict_t* dummy : dummies)
+		G_FreeEdict(dummy);
+}
+
 /*
 ================
 SV_Physics_Pusher
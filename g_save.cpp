@@ -4,6 +4,14 @@
 #include <sstream>
 
 #include "g_local.h"
+#include "horde/g_heal_registry.h"
+#include "horde/g_horde_phys.h"
+#include "horde/g_gib_pool.h"
+#include "horde/g_lag_rewind.h"
+#include "horde/g_trigger_index.h"
+#include "horde/g_push_index.h"
+#include "horde/g_monster_table.h"
+#include "horde/g_pvm.h"
 #include <float.h>
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -1035,8 +1043,6 @@ FIELD_AUTO(tracker_pain_time),
 // owned_sphere is DM only
 
 FIELD_AUTO(empty_click_sound),
-FIELD_AUTO(trail_head),
-FIELD_AUTO(trail_tail),
 
 FIELD_GAME_STRING(landmark_name),
 FIELD_AUTO(landmark_rel_pos),
@@ -2482,6 +2488,8 @@ void read_save_struct_json(const Json::Value& json, void* data, const save_struc
 
 #include <fstream>
 #include <memory>
+#include <deque>
+#include <array>
 
 static Json::Value parseJson(const char* jsonString)
 {
@@ -2500,7 +2508,7 @@ static Json::Value parseJson(const char* jsonString)
 	return json;
 }
 
-static char* saveJson(const Json::Value& json, size_t* out_size)
+static std::string stringifyJson(const Json::Value& json)
 {
 	Json::StreamWriterBuilder builder;
 	builder["indentation"] = "\t";
@@ -2508,22 +2516,851 @@ static char* saveJson(const Json::Value& json, size_t* out_size)
 	const std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
 	std::stringstream						  ss(std::ios_base::out | std::ios_base::binary);
 	writer->write(json, &ss);
-	*out_size = ss.tellp();
+	return ss.str();
+}
+
+static char* saveJson(const Json::Value& json, size_t* out_size)
+{
+	const std::string v = stringifyJson(json);
+	*out_size = v.size();
 	char* const out = static_cast<char*>(gi.TagMalloc(*out_size + 1, TAG_GAME));
-	// FIXME: some day...
-	std::string v = ss.str();
 	memcpy(out, v.c_str(), *out_size);
 	out[*out_size] = '\0';
 	return out;
 }
 
-// new entry point for WriteGame.
-// returns pointer to TagMalloc'd JSON string.
-char* WriteGameJson(bool autosave, size_t* out_size)
+// binary save format;
+// - driven by the same field tables as the JSON format, but streamed
+//   into a flat byte buffer instead of building a Json::Value tree
+// - mirrors the JSON document value for value (objects, arrays, numbers,
+//   strings), so a save converts losslessly between the two formats
+// - object keys are interned; the key table is written once after the
+//   root value, so empty fields can be rolled back without touching it
+// - the engine stores saves as NUL-terminated text, so the finished
+//   stream is handed over base64 encoded inside a one-member JSON object
+// - selected with g_save_binary; 2 also builds the JSON document and
+//   checks the binary stream decodes to exactly the same thing
+
+constexpr uint8_t SAVE_BINARY_MAGIC[4] = { 'Q', '2', 'S', 'B' };
+constexpr uint8_t SAVE_BINARY_VERSION = 1;
+constexpr std::string_view SAVE_BINARY_PREFIX = "{\"save_binary\":\"";
+constexpr std::string_view SAVE_BINARY_SUFFIX = "\"}";
+constexpr int32_t SAVE_BINARY_MAX_DEPTH = 64;
+
+enum save_bin_token_t : uint8_t
+{
+	SBT_NULL,
+	SBT_FALSE,
+	SBT_TRUE,
+	SBT_INT,	// zigzag varint
+	SBT_UINT,	// varint
+	SBT_FLOAT,	// 4 bytes; a double that survives the trip through float
+	SBT_DOUBLE, // 8 bytes
+	SBT_STRING, // varint length, bytes
+	SBT_ARRAY,	// varint count, values
+	SBT_OBJECT	// (varint key id + 1, value) pairs, ended by a 0
+};
+
+struct save_bin_writer_t
+{
+	std::vector<uint8_t> bytes;
+	std::deque<std::string> keys;
+	boost::unordered::unordered_flat_map<std::string_view, uint32_t> key_ids;
+
+	save_bin_writer_t()
+	{
+		bytes.reserve(256 * 1024);
+		put_raw(SAVE_BINARY_MAGIC, sizeof(SAVE_BINARY_MAGIC));
+		put_byte(SAVE_BINARY_VERSION);
+	}
+
+	// position to roll back to if a value turns out to be empty
+	size_t mark() const { return bytes.size(); }
+	void rewind(size_t mark) { bytes.resize(mark); }
+
+	void put_byte(uint8_t b) { bytes.push_back(b); }
+	void put_raw(const void* data, size_t size)
+	{
+		const uint8_t* p = static_cast<const uint8_t*>(data);
+		bytes.insert(bytes.end(), p, p + size);
+	}
+	void put_varint(uint64_t v)
+	{
+		for (; v >= 0x80; v >>= 7)
+			bytes.push_back(static_cast<uint8_t>(v) | 0x80);
+		bytes.push_back(static_cast<uint8_t>(v));
+	}
+
+	void put_key(std::string_view key)
+	{
+		auto it = key_ids.find(key);
+
+		if (it == key_ids.end())
+		{
+			const std::string& stored = keys.emplace_back(key);
+			it = key_ids.emplace(stored, static_cast<uint32_t>(keys.size() - 1)).first;
+		}
+
+		put_varint(it->second + 1);
+	}
+	void end_object() { put_varint(0); }
+
+	void put_value(const Json::Value& value)
+	{
+		switch (value.type())
+		{
+		case Json::nullValue:
+			put_byte(SBT_NULL);
+			return;
+		case Json::booleanValue:
+			put_byte(value.asBool() ? SBT_TRUE : SBT_FALSE);
+			return;
+		case Json::intValue: {
+			const int64_t i = value.asInt64();
+			put_byte(SBT_INT);
+			put_varint((static_cast<uint64_t>(i) << 1) ^ static_cast<uint64_t>(i >> 63));
+			return;
+		}
+		case Json::uintValue:
+			put_byte(SBT_UINT);
+			put_varint(value.asUInt64());
+			return;
+		case Json::realValue: {
+			const double d = value.asDouble();
+			const float f = static_cast<float>(d);
+
+			if (static_cast<double>(f) == d)
+			{
+				put_byte(SBT_FLOAT);
+				put_raw(&f, sizeof(f));
+			}
+			else
+			{
+				put_byte(SBT_DOUBLE);
+				put_raw(&d, sizeof(d));
+			}
+			return;
+		}
+		case Json::stringValue: {
+			const char* begin, * end;
+			value.getString(&begin, &end);
+			put_byte(SBT_STRING);
+			put_varint(end - begin);
+			put_raw(begin, end - begin);
+			return;
+		}
+		case Json::arrayValue:
+			put_byte(SBT_ARRAY);
+			put_varint(value.size());
+			for (const Json::Value& element : value)
+				put_value(element);
+			return;
+		case Json::objectValue:
+			put_byte(SBT_OBJECT);
+			for (auto it = value.begin(); it != value.end(); it++)
+			{
+				const char* end;
+				const char* name = it.memberName(&end);
+				put_key({ name, static_cast<size_t>(end - name) });
+				put_value(*it);
+			}
+			end_object();
+			return;
+		}
+	}
+
+	// appends the key table and the trailer pointing at it
+	void finish()
+	{
+		const uint32_t table_offset = static_cast<uint32_t>(bytes.size());
+
+		put_varint(keys.size());
+		for (const std::string& key : keys)
+		{
+			put_varint(key.size());
+			put_raw(key.data(), key.size());
+		}
+
+		put_raw(&table_offset, sizeof(table_offset));
+	}
+};
+
+struct save_bin_reader_t
+{
+	const uint8_t* start;
+	const uint8_t* pos;
+	const uint8_t* end; // end of the value stream; the key table follows
+	std::vector<std::string_view> keys;
+
+	// field lookups per structure, indexed by key id; resolved on first use
+	boost::unordered::unordered_flat_map<const save_struct_t*, std::vector<const save_field_t*>> field_cache;
+
+	// returns false if `data` doesn't hold a binary save
+	bool open(const std::vector<uint8_t>& data)
+	{
+		uint32_t table_offset;
+
+		if (data.size() < sizeof(SAVE_BINARY_MAGIC) + 1 + sizeof(table_offset) ||
+			memcmp(data.data(), SAVE_BINARY_MAGIC, sizeof(SAVE_BINARY_MAGIC)) ||
+			data[sizeof(SAVE_BINARY_MAGIC)] != SAVE_BINARY_VERSION)
+			return false;
+
+		memcpy(&table_offset, data.data() + data.size() - sizeof(table_offset), sizeof(table_offset));
+
+		if (table_offset < sizeof(SAVE_BINARY_MAGIC) + 1 || table_offset > data.size() - sizeof(table_offset))
+			return false;
+
+		start = data.data();
+		pos = start + table_offset;
+		end = start + data.size() - sizeof(table_offset);
+
+		const uint64_t num_keys = get_varint();
+		keys.clear();
+		for (uint64_t i = 0; i < num_keys && pos < end; i++)
+		{
+			const size_t len = get_varint();
+			keys.push_back(get_bytes(len));
+		}
+
+		if (keys.size() != num_keys)
+			return false;
+
+		pos = start + sizeof(SAVE_BINARY_MAGIC) + 1;
+		end = start + table_offset;
+		return true;
+	}
+
+	[[noreturn]] void corrupt() const
+	{
+		gi.Com_Error("binary save data is truncated or corrupt");
+		std::abort();
+	}
+
+	uint8_t peek() const { return pos < end ? *pos : SBT_NULL; }
+	uint8_t get_byte()
+	{
+		if (pos >= end)
+			corrupt();
+		return *pos++;
+	}
+	uint64_t get_varint()
+	{
+		uint64_t v = 0;
+
+		for (int32_t shift = 0; shift < 64; shift += 7)
+		{
+			const uint8_t b = get_byte();
+			v |= static_cast<uint64_t>(b & 0x7F) << shift;
+
+			if (!(b & 0x80))
+				return v;
+		}
+
+		corrupt();
+	}
+	std::string_view get_bytes(size_t size)
+	{
+		if (size > static_cast<size_t>(end - pos))
+			corrupt();
+
+		std::string_view bytes(reinterpret_cast<const char*>(pos), size);
+		pos += size;
+		return bytes;
+	}
+	template<typename T>
+	T get_scalar()
+	{
+		T value;
+		memcpy(&value, get_bytes(sizeof(T)).data(), sizeof(T));
+		return value;
+	}
+
+	// next key of the current object; false once the object ends
+	bool get_key(std::string_view& key, uint32_t& key_id)
+	{
+		const uint64_t v = get_varint();
+
+		if (!v)
+			return false;
+		else if (v > keys.size())
+			corrupt();
+
+		key_id = static_cast<uint32_t>(v - 1);
+		key = keys[key_id];
+		return true;
+	}
+
+	Json::Value get_value(int32_t depth = 0)
+	{
+		if (depth > SAVE_BINARY_MAX_DEPTH)
+			corrupt();
+
+		switch (get_byte())
+		{
+		case SBT_NULL:
+			return Json::Value::nullSingleton();
+		case SBT_FALSE:
+			return Json::Value(false);
+		case SBT_TRUE:
+			return Json::Value(true);
+		case SBT_INT: {
+			const uint64_t v = get_varint();
+			return Json::Value(static_cast<Json::Int64>((v >> 1) ^ (~(v & 1) + 1)));
+		}
+		case SBT_UINT:
+			return Json::Value(static_cast<Json::UInt64>(get_varint()));
+		case SBT_FLOAT:
+			return Json::Value(static_cast<double>(get_scalar<float>()));
+		case SBT_DOUBLE:
+			return Json::Value(get_scalar<double>());
+		case SBT_STRING: {
+			const std::string_view str = get_bytes(get_varint());
+			return Json::Value(str.data(), str.data() + str.size());
+		}
+		case SBT_ARRAY: {
+			const uint64_t count = get_varint();
+			Json::Value array(Json::arrayValue);
+
+			if (count > static_cast<uint64_t>(end - pos))
+				corrupt();
+
+			array.resize(static_cast<Json::ArrayIndex>(count));
+			for (Json::ArrayIndex i = 0; i < count; i++)
+				array[i] = get_value(depth + 1);
+			return array;
+		}
+		case SBT_OBJECT: {
+			Json::Value object(Json::objectValue);
+			std::string_view key;
+			uint32_t key_id;
+
+			while (get_key(key, key_id))
+				object[std::string(key)] = get_value(depth + 1);
+			return object;
+		}
+		default:
+			corrupt();
+		}
+	}
+
+	void skip_value(int32_t depth = 0)
+	{
+		if (depth > SAVE_BINARY_MAX_DEPTH)
+			corrupt();
+
+		switch (get_byte())
+		{
+		case SBT_NULL:
+		case SBT_FALSE:
+		case SBT_TRUE:
+			return;
+		case SBT_INT:
+		case SBT_UINT:
+			get_varint();
+			return;
+		case SBT_FLOAT:
+			get_bytes(sizeof(float));
+			return;
+		case SBT_DOUBLE:
+			get_bytes(sizeof(double));
+			return;
+		case SBT_STRING:
+			get_bytes(get_varint());
+			return;
+		case SBT_ARRAY:
+			for (uint64_t count = get_varint(); count; count--)
+				skip_value(depth + 1);
+			return;
+		case SBT_OBJECT: {
+			std::string_view key;
+			uint32_t key_id;
+
+			while (get_key(key, key_id))
+				skip_value(depth + 1);
+			return;
+		}
+		default:
+			corrupt();
+		}
+	}
+
+	const save_field_t* find_field(const save_struct_t* structure, std::string_view key, uint32_t key_id)
+	{
+		static constexpr save_field_t no_field = { nullptr, 0, { ST_INVALID } };
+
+		std::vector<const save_field_t*>& cache = field_cache[structure];
+
+		if (key_id >= cache.size())
+			cache.resize(keys.size(), nullptr);
+
+		const save_field_t*& slot = cache[key_id];
+
+		if (!slot)
+		{
+			slot = &no_field;
+
+			for (const save_field_t& field : structure->fields)
+			{
+				if (key == field.name)
+				{
+					slot = &field;
+					break;
+				}
+			}
+		}
+
+		return slot == &no_field ? nullptr : slot;
+	}
+};
+
+static void resolve_element_type(const save_type_t* type, save_type_t& element_type, size_t& element_size)
+{
+	if (type->type_resolver)
+	{
+		element_type = type->type_resolver();
+		element_size = get_complex_type_size(element_type);
+	}
+	else
+	{
+		element_size = get_simple_type_size((save_type_id_t)type->tag);
+		element_type = { (save_type_id_t)type->tag };
+	}
+}
+
+bool write_save_struct_bin(const void* data, const save_struct_t* structure, bool null_for_empty, save_bin_writer_t& out);
+
+// binary counterpart of write_save_type_json, with the same rules for
+// what counts as empty. containers are streamed; leaf values go through
+// write_save_type_json so both formats encode them identically.
+bool write_save_type_bin(const void* data, const save_type_t* type, bool null_for_empty, save_bin_writer_t& out)
+{
+	switch (type->id)
+	{
+	case ST_STRUCT:
+		if (type->is_empty && type->is_empty(data))
+			return false;
+		else if (write_save_struct_bin(data, type->structure, true, out))
+			return true;
+		else if (null_for_empty)
+			return false;
+
+		out.put_byte(SBT_NULL);
+		return true;
+	case ST_FIXED_ARRAY:
+	case ST_SAVABLE_DYNAMIC: {
+		const uint8_t* elements;
+		size_t		   count;
+		save_type_t    element_type;
+		size_t		   element_size;
+
+		if (type->id == ST_FIXED_ARRAY)
+		{
+			elements = (const uint8_t*)data;
+			count = type->count;
+		}
+		else
+		{
+			const savable_allocated_memory_t<void, 0>* savptr = (const savable_allocated_memory_t<void, 0> *) data;
+			elements = (const uint8_t*)savptr->ptr;
+			count = savptr->count;
+		}
+
+		resolve_element_type(type, element_type, element_size);
+
+		if (null_for_empty)
+		{
+			if (type->is_empty)
+			{
+				if (type->is_empty(data))
+					return false;
+			}
+			else
+			{
+				size_t i;
+				const uint8_t* element = elements;
+
+				for (i = 0; i < count; i++, element += element_size)
+				{
+					const size_t mark = out.mark();
+					const bool valid_value = write_save_type_bin(element, &element_type, !element_type.never_empty, out);
+					out.rewind(mark);
+
+					if (valid_value)
+						break;
+				}
+
+				if (i == count)
+					return false;
+			}
+		}
+
+		out.put_byte(SBT_ARRAY);
+		out.put_varint(count);
+
+		const uint8_t* element = elements;
+		for (size_t i = 0; i < count; i++, element += element_size)
+			if (!write_save_type_bin(element, &element_type, false, out))
+				out.put_byte(SBT_NULL);
+
+		return true;
+	}
+	default: {
+		Json::Value value;
+
+		if (!write_save_type_json(data, type, null_for_empty, value))
+			return false;
+
+		out.put_value(value);
+		return true;
+	}
+	}
+}
+
+bool write_save_struct_bin(const void* data, const save_struct_t* structure, bool null_for_empty, save_bin_writer_t& out)
+{
+	const size_t object_mark = out.mark();
+	bool		 any_field = false;
+
+	out.put_byte(SBT_OBJECT);
+
+	for (auto& field : structure->fields)
+	{
+		const void*  p = ((const uint8_t*)data) + field.offset;
+		const size_t field_mark = out.mark();
+
+		out.put_key(field.name);
+
+		if (write_save_type_bin(p, &field.type, !field.type.never_empty, out))
+			any_field = true;
+		else
+			out.rewind(field_mark);
+	}
+
+	if (null_for_empty && !any_field)
+	{
+		out.rewind(object_mark);
+		return false;
+	}
+
+	out.end_object();
+	return true;
+}
+
+void read_save_struct_bin(save_bin_reader_t& in, void* data, const save_struct_t* structure);
+
+// binary counterpart of read_save_type_json. structs and arrays are read
+// straight from the stream; anything else (including values of the wrong
+// shape) is decoded to a Json::Value and handed to the JSON reader, so
+// validation and error reporting are shared between the formats.
+void read_save_type_bin(save_bin_reader_t& in, void* data, const save_type_t* type, const char* field)
+{
+	const uint8_t token = in.peek();
+
+	if (type->id == ST_STRUCT && token == SBT_OBJECT)
+	{
+		in.get_byte();
+		json_push_stack(field);
+		read_save_struct_bin(in, data, type->structure);
+		json_pop_stack();
+		return;
+	}
+	else if ((type->id == ST_FIXED_ARRAY || type->id == ST_SAVABLE_DYNAMIC) && token == SBT_ARRAY)
+	{
+		in.get_byte();
+
+		const uint64_t count = in.get_varint();
+		save_type_t    element_type;
+		size_t		   element_size;
+		uint8_t*	   element;
+
+		resolve_element_type(type, element_type, element_size);
+
+		if (type->id == ST_FIXED_ARRAY)
+		{
+			if (count != type->count)
+			{
+				json_print_error(field, "fixed array length mismatch", false);
+
+				for (uint64_t i = 0; i < count; i++)
+					in.skip_value();
+				return;
+			}
+
+			element = (uint8_t*)data;
+		}
+		else
+		{
+			if (count > static_cast<uint64_t>(in.end - in.pos))
+				in.corrupt();
+
+			savable_allocated_memory_t<void, 0>* savptr = (savable_allocated_memory_t<void, 0> *) data;
+			savptr->count = count;
+			savptr->ptr = gi.TagMalloc(element_size * savptr->count, type->count);
+			element = (uint8_t*)savptr->ptr;
+		}
+
+		for (uint64_t i = 0; i < count; i++, element += element_size)
+			read_save_type_bin(in, element, &element_type, fmt::format("[{}]", i).c_str());
+		return;
+	}
+
+	read_save_type_json(in.get_value(), data, type, field);
+}
+
+void read_save_struct_bin(save_bin_reader_t& in, void* data, const save_struct_t* structure)
+{
+	std::string_view key;
+	uint32_t		 key_id;
+
+	while (in.get_key(key, key_id))
+	{
+		const save_field_t* field = in.find_field(structure, key, key_id);
+
+		if (!field)
+		{
+			json_print_error(std::string(key).c_str(), "unknown field", false);
+			in.skip_value();
+			continue;
+		}
+
+		read_save_type_bin(in, ((uint8_t*)data) + field->offset, &field->type, field->name);
+	}
+}
+
+// reads a top-level structure ("game", "level", a client or an entity)
+static void read_save_root_bin(save_bin_reader_t& in, void* data, const save_struct_t* structure)
+{
+	if (in.peek() != SBT_OBJECT)
+	{
+		json_print_error("", "expected object", false);
+		in.skip_value();
+		return;
+	}
+
+	in.get_byte();
+	read_save_struct_bin(in, data, structure);
+}
+
+// locates the members of the root object, so they can be read
+// in dependency order whatever order they were written in
+static boost::unordered::unordered_flat_map<std::string_view, const uint8_t*> read_save_members_bin(save_bin_reader_t& in)
+{
+	boost::unordered::unordered_flat_map<std::string_view, const uint8_t*> members;
+	std::string_view key;
+	uint32_t		 key_id;
+
+	if (in.get_byte() != SBT_OBJECT)
+		gi.Com_Error("expected object at root");
+
+	while (in.get_key(key, key_id))
+	{
+		members[key] = in.pos;
+		in.skip_value();
+	}
+
+	return members;
+}
+
+static constexpr char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// wraps a finished stream in the text container the engine stores
+static char* save_bin_wrap(const std::vector<uint8_t>& bytes, size_t* out_size)
+{
+	*out_size = SAVE_BINARY_PREFIX.size() + ((bytes.size() + 2) / 3) * 4 + SAVE_BINARY_SUFFIX.size();
+	char* const out = static_cast<char*>(gi.TagMalloc(*out_size + 1, TAG_GAME));
+	char* p = out;
+
+	memcpy(p, SAVE_BINARY_PREFIX.data(), SAVE_BINARY_PREFIX.size());
+	p += SAVE_BINARY_PREFIX.size();
+
+	for (size_t i = 0; i < bytes.size(); i += 3)
+	{
+		const size_t   remaining = bytes.size() - i;
+		const uint32_t chunk = (bytes[i] << 16) | ((remaining > 1 ? bytes[i + 1] : 0) << 8) | (remaining > 2 ? bytes[i + 2] : 0);
+
+		*p++ = BASE64_CHARS[(chunk >> 18) & 63];
+		*p++ = BASE64_CHARS[(chunk >> 12) & 63];
+		*p++ = remaining > 1 ? BASE64_CHARS[(chunk >> 6) & 63] : '=';
+		*p++ = remaining > 2 ? BASE64_CHARS[chunk & 63] : '=';
+	}
+
+	memcpy(p, SAVE_BINARY_SUFFIX.data(), SAVE_BINARY_SUFFIX.size());
+	p += SAVE_BINARY_SUFFIX.size();
+	*p = '\0';
+	return out;
+}
+
+// returns false if `text` isn't a binary save container
+static bool save_bin_unwrap(std::string_view text, std::vector<uint8_t>& bytes)
+{
+	if (text.size() < SAVE_BINARY_PREFIX.size() + SAVE_BINARY_SUFFIX.size() ||
+		!text.starts_with(SAVE_BINARY_PREFIX) || !text.ends_with(SAVE_BINARY_SUFFIX))
+		return false;
+
+	const std::string_view encoded = text.substr(SAVE_BINARY_PREFIX.size(), text.size() - SAVE_BINARY_PREFIX.size() - SAVE_BINARY_SUFFIX.size());
+
+	if (encoded.size() % 4)
+		gi.Com_Error("binary save data is truncated or corrupt");
+
+	std::array<int8_t, 256> lookup;
+	lookup.fill(-1);
+	for (int32_t i = 0; i < 64; i++)
+		lookup[static_cast<uint8_t>(BASE64_CHARS[i])] = i;
+
+	bytes.clear();
+	bytes.reserve(encoded.size() / 4 * 3);
+
+	for (size_t i = 0; i < encoded.size(); i += 4)
+	{
+		uint32_t chunk = 0;
+		int32_t  valid = 0;
+
+		for (size_t j = 0; j < 4; j++)
+		{
+			const char c = encoded[i + j];
+
+			if (c == '=' && i + 4 == encoded.size() && j >= 2)
+			{
+				chunk <<= 6;
+				continue;
+			}
+			else if (lookup[static_cast<uint8_t>(c)] < 0)
+				gi.Com_Error("binary save data is truncated or corrupt");
+
+			chunk = (chunk << 6) | lookup[static_cast<uint8_t>(c)];
+			valid++;
+		}
+
+		bytes.push_back(static_cast<uint8_t>(chunk >> 16));
+		if (valid > 2)
+			bytes.push_back(static_cast<uint8_t>(chunk >> 8));
+		if (valid > 3)
+			bytes.push_back(static_cast<uint8_t>(chunk));
+	}
+
+	return true;
+}
+
+// finds the first difference between two documents, for g_save_binary 2
+static bool save_bin_diff(const Json::Value& a, const Json::Value& b, std::string& path)
+{
+	if (a.type() != b.type())
+		return true;
+	else if (a.isObject())
+	{
+		for (auto it = a.begin(); it != a.end(); it++)
+		{
+			const std::string name = it.name();
+
+			if (!b.isMember(name) || save_bin_diff(*it, b[name], path))
+			{
+				path = "." + name + path;
+				return true;
+			}
+		}
+
+		return a.size() != b.size();
+	}
+	else if (a.isArray())
+	{
+		for (Json::ArrayIndex i = 0; i < a.size() && i < b.size(); i++)
+		{
+			if (save_bin_diff(a[i], b[i], path))
+			{
+				path = fmt::format("[{}]", i) + path;
+				return true;
+			}
+		}
+
+		return a.size() != b.size();
+	}
+
+	return a != b;
+}
+
+static void save_bin_verify(const std::vector<uint8_t>& bytes, const Json::Value& json, const char* what)
+{
+	save_bin_reader_t in;
+
+	if (!in.open(bytes))
+	{
+		gi.Com_PrintFmt("binary {} save: couldn't reopen stream\n", what);
+		return;
+	}
+
+	std::string path;
+	if (save_bin_diff(in.get_value(), json, path))
+		gi.Com_PrintFmt("binary {} save: MISMATCH with JSON at {}\n", what, path.empty() ? "<root>" : path);
+	else
+		gi.Com_PrintFmt("binary {} save: matches JSON ({} bytes)\n", what, bytes.size());
+}
+
+// converts a save between the JSON and binary formats, for debugging;
+// the output format is whichever one the input isn't
+bool G_ConvertSaveFile(const char* in_path, const char* out_path)
 {
-	if (!autosave)
-		SaveClientData();
+	std::ifstream in_file(in_path, std::ios::binary);
+
+	if (!in_file)
+	{
+		gi.Com_PrintFmt("Couldn't open {}\n", in_path);
+		return false;
+	}
+
+	const std::string text((std::istreambuf_iterator<char>(in_file)), std::istreambuf_iterator<char>());
+	std::vector<uint8_t> bytes;
+	std::string output;
+
+	if (save_bin_unwrap(text, bytes))
+	{
+		save_bin_reader_t in;
+
+		if (!in.open(bytes))
+		{
+			gi.Com_PrintFmt("{} is not a supported binary save\n", in_path);
+			return false;
+		}
+
+		output = stringifyJson(in.get_value());
+	}
+	else
+	{
+		Json::CharReaderBuilder reader;
+		reader["allowSpecialFloats"] = true;
+		Json::Value json;
+		JSONCPP_STRING errs;
+		std::stringstream ss(text, std::ios_base::in | std::ios_base::binary);
+
+		if (!Json::parseFromStream(reader, ss, &json, &errs))
+		{
+			gi.Com_PrintFmt("Couldn't decode JSON in {}: {}\n", in_path, errs.c_str());
+			return false;
+		}
+
+		save_bin_writer_t out;
+		out.put_value(json);
+		out.finish();
 
+		size_t size;
+		char* wrapped = save_bin_wrap(out.bytes, &size);
+		output.assign(wrapped, size);
+		gi.TagFree(wrapped);
+	}
+
+	std::ofstream out_file(out_path, std::ios::binary | std::ios::trunc);
+
+	if (!out_file || !out_file.write(output.data(), output.size()))
+	{
+		gi.Com_PrintFmt("Couldn't write {}\n", out_path);
+		return false;
+	}
+
+	gi.Com_PrintFmt("Converted {} ({} bytes) to {} ({} bytes)\n", in_path, text.size(), out_path, output.size());
+	return true;
+}
+
+static Json::Value write_game_json(bool autosave)
+{
 	Json::Value json(Json::objectValue);
 
 	json["save_version"] = Json::Value(static_cast<Json::UInt64>(SAVE_FORMAT_VERSION));
@@ -2544,7 +3381,50 @@ char* WriteGameJson(bool autosave, size_t* out_size)
 	}
 	json["clients"] = std::move(clients);
 
-	return saveJson(json, out_size);
+	return json;
+}
+
+static char* write_game_bin(bool autosave, size_t* out_size)
+{
+	save_bin_writer_t out;
+
+	out.put_byte(SBT_OBJECT);
+	out.put_key("save_version");
+	out.put_value(Json::Value(static_cast<Json::UInt64>(SAVE_FORMAT_VERSION)));
+
+	// write game
+	out.put_key("game");
+	game.autosaved = autosave;
+	write_save_struct_bin(&game, &game_locals_t_savestruct, false, out);
+	game.autosaved = false;
+
+	// write clients
+	out.put_key("clients");
+	out.put_byte(SBT_ARRAY);
+	out.put_varint(game.maxclients);
+	for (size_t i = 0; i < game.maxclients; i++)
+		write_save_struct_bin(&game.clients[i], &gclient_t_savestruct, false, out);
+
+	out.end_object();
+	out.finish();
+
+	if (g_save_binary->integer == 2)
+		save_bin_verify(out.bytes, write_game_json(autosave), "game");
+
+	return save_bin_wrap(out.bytes, out_size);
+}
+
+// new entry point for WriteGame.
+// returns pointer to TagMalloc'd JSON string.
+char* WriteGameJson(bool autosave, size_t* out_size)
+{
+	if (!autosave)
+		SaveClientData();
+
+	if (g_save_binary->integer)
+		return write_game_bin(autosave, out_size);
+
+	return saveJson(write_game_json(autosave), out_size);
 }
 
 void G_PrecacheInventoryItems();
@@ -2553,6 +3433,73 @@ static void upgrade_client(gclient_t* client, const Json::Value& json, const uin
 {
 }
 
+// reallocates the game-lifetime entity and client arrays
+// at their current sizes, ready to be loaded into
+static void reset_game_for_load()
+{
+	uint32_t max_entities = game.maxentities;
+	uint32_t max_clients = game.maxclients;
+
+	game = {};
+	g_edicts = (edict_t*)gi.TagMalloc(max_entities * sizeof(g_edicts[0]), TAG_GAME);
+	game.clients = (gclient_t*)gi.TagMalloc(max_clients * sizeof(game.clients[0]), TAG_GAME);
+	globals.edicts = g_edicts;
+}
+
+// positions `in` at the member `name` of a binary save's root object;
+// false if it's missing, which the caller reads as null like a missing JSON key
+static bool read_member_bin(save_bin_reader_t& in, const boost::unordered::unordered_flat_map<std::string_view, const uint8_t*>& members, std::string_view name)
+{
+	auto it = members.find(name);
+
+	if (it == members.end())
+		return false;
+
+	in.pos = it->second;
+	return true;
+}
+
+static void read_game_bin(const std::vector<uint8_t>& bytes)
+{
+	save_bin_reader_t in;
+
+	if (!in.open(bytes))
+		gi.Com_Error("unsupported binary save version");
+
+	const auto members = read_save_members_bin(in);
+
+	// pull version
+	uint32_t save_version = 0;
+	if (read_member_bin(in, members, "save_version"))
+		read_save_type_bin(in, &save_version, &save_version_type, "save_version");
+	else
+		read_save_type_json(Json::Value::nullSingleton(), &save_version, &save_version_type, "save_version");
+
+	reset_game_for_load();
+
+	// read game
+	json_push_stack("game");
+	if (read_member_bin(in, members, "game"))
+		read_save_root_bin(in, &game, &game_locals_t_savestruct);
+	else
+		read_save_struct_json(Json::Value::nullSingleton(), &game, &game_locals_t_savestruct);
+	json_pop_stack();
+
+	// read clients
+	if (!read_member_bin(in, members, "clients") || in.get_byte() != SBT_ARRAY)
+		gi.Com_Error("expected \"clients\" to be array");
+	else if (in.get_varint() != game.maxclients)
+		gi.Com_Error("mismatched client size");
+
+	for (size_t i = 0; i < game.maxclients; i++)
+	{
+		json_push_stack(fmt::format("clients[{}]", i));
+		read_save_root_bin(in, &game.clients[i], &gclient_t_savestruct);
+		upgrade_client(&game.clients[i], Json::Value::nullSingleton(), save_version);
+		json_pop_stack();
+	}
+}
+
 // new entry point for ReadGame.
 // takes in pointer to JSON data. does
 // not store or modify it.
@@ -2560,19 +3507,22 @@ void ReadGameJson(const char* jsonString)
 {
 	gi.FreeTags(TAG_GAME);
 
-	Json::Value json = parseJson(jsonString);
+	std::vector<uint8_t> bytes;
 
-	uint32_t max_entities = game.maxentities;
-	uint32_t max_clients = game.maxclients;
+	if (save_bin_unwrap(jsonString, bytes))
+	{
+		read_game_bin(bytes);
+		G_PrecacheInventoryItems();
+		return;
+	}
+
+	Json::Value json = parseJson(jsonString);
 
 	// pull version
 	uint32_t save_version = 0; // Initialize to 0 to ensure defined behavior if read fails
 	read_save_type_json(json["save_version"], &save_version, &save_version_type, "save_version");
 
-	game = {};
-	g_edicts = (edict_t*)gi.TagMalloc(max_entities * sizeof(g_edicts[0]), TAG_GAME);
-	game.clients = (gclient_t*)gi.TagMalloc(max_clients * sizeof(game.clients[0]), TAG_GAME);
-	globals.edicts = g_edicts;
+	reset_game_for_load();
 
 	// read game
 	json_push_stack("game");
@@ -2601,14 +3551,34 @@ void ReadGameJson(const char* jsonString)
 	G_PrecacheInventoryItems();
 }
 
-// new entry point for WriteLevel.
-// returns pointer to TagMalloc'd JSON string.
-char* WriteLevelJson(bool transition, size_t* out_size)
+// whether entity `i` goes into a level save
+static bool level_saves_edict(uint32_t i, bool transition)
 {
-	// update current level entry now, just so we can
-	// use gamemap to test EOU
-	G_UpdateLevelEntry();
+	if (!globals.edicts[i].inuse)
+		return false;
+	// clear all the client inuse flags before saving so that
+	// when the level is re-entered, the clients will spawn
+	// at spawn points instead of occupying body shells
+	else if (transition && i >= 1 && i <= game.maxclients)
+		return false;
+
+	return true;
+}
+
+static const char* format_edict_number(uint32_t i, char (&number)[16])
+{
+	auto result = std::to_chars(number, number + sizeof(number) - 1, i);
+
+	if (result.ec == std::errc())
+		*result.ptr = '\0';
+	else
+		gi.Com_ErrorFmt("error formatting number: {}", std::make_error_code(result.ec).message());
 
+	return number;
+}
+
+static Json::Value write_level_json(bool transition)
+{
 	Json::Value json(Json::objectValue);
 
 	json["save_version"] = Json::Value(static_cast<Json::UInt64>(SAVE_FORMAT_VERSION));
@@ -2620,29 +3590,63 @@ char* WriteLevelJson(bool transition, size_t* out_size)
 	Json::Value entities(Json::objectValue);
 	char		number[16];
 
+	for (uint32_t i = 0; i < globals.num_edicts; i++)
+		if (level_saves_edict(i, transition))
+			write_save_struct_json(&globals.edicts[i], &edict_t_savestruct, false, entities[format_edict_number(i, number)]);
+
+	json["entities"] = std::move(entities);
+
+	return json;
+}
+
+static char* write_level_bin(bool transition, size_t* out_size)
+{
+	save_bin_writer_t out;
+	char			  number[16];
+
+	out.put_byte(SBT_OBJECT);
+	out.put_key("save_version");
+	out.put_value(Json::Value(static_cast<Json::UInt64>(SAVE_FORMAT_VERSION)));
+
+	// write level
+	out.put_key("level");
+	write_save_struct_bin(&level, &level_locals_t_savestruct, false, out);
+
+	// write entities
+	out.put_key("entities");
+	out.put_byte(SBT_OBJECT);
+
 	for (uint32_t i = 0; i < globals.num_edicts; i++)
 	{
-		if (!globals.edicts[i].inuse)
-			continue;
-		// clear all the client inuse flags before saving so that
-		// when the level is re-entered, the clients will spawn
-		// at spawn points instead of occupying body shells
-		else if (transition && i >= 1 && i <= game.maxclients)
+		if (!level_saves_edict(i, transition))
 			continue;
 
-		auto result = std::to_chars(number, number + sizeof(number) - 1, i);
+		out.put_key(format_edict_number(i, number));
+		write_save_struct_bin(&globals.edicts[i], &edict_t_savestruct, false, out);
+	}
 
-		if (result.ec == std::errc())
-			*result.ptr = '\0';
-		else
-			gi.Com_ErrorFmt("error formatting number: {}", std::make_error_code(result.ec).message());
+	out.end_object();
+	out.end_object();
+	out.finish();
 
-		write_save_struct_json(&globals.edicts[i], &edict_t_savestruct, false, entities[number]);
-	}
+	if (g_save_binary->integer == 2)
+		save_bin_verify(out.bytes, write_level_json(transition), "level");
 
-	json["entities"] = std::move(entities);
+	return save_bin_wrap(out.bytes, out_size);
+}
+
+// new entry point for WriteLevel.
+// returns pointer to TagMalloc'd JSON string.
+char* WriteLevelJson(bool transition, size_t* out_size)
+{
+	// update current level entry now, just so we can
+	// use gamemap to test EOU
+	G_UpdateLevelEntry();
+
+	if (g_save_binary->integer)
+		return write_level_bin(transition, out_size);
 
-	return saveJson(json, out_size);
+	return saveJson(write_level_json(transition), out_size);
 }
 
 static void upgrade_edict(edict_t* ent, const Json::Value& json, const uint32_t& save_version)
@@ -2663,18 +3667,9 @@ static void upgrade_level(const Json::Value& json, const uint32_t& save_version)
 {
 }
 
-// new entry point for ReadLevel.
-// takes in pointer to JSON data. does
-// not store or modify it.
-void ReadLevelJson(const char* jsonString)
+// wipe all the entities
+static void wipe_edicts_for_load()
 {
-	// free any dynamic memory allocated by loading the level
-	// base state
-	gi.FreeTags(TAG_LEVEL);
-
-	Json::Value json = parseJson(jsonString);
-
-	// wipe all the entities
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wclass-memaccess"
@@ -2684,42 +3679,71 @@ void ReadLevelJson(const char* jsonString)
 #pragma GCC diagnostic pop
 #endif
 	globals.num_edicts = game.maxclients + 1;
+}
+
+// prepares entity `number` to be read into
+static edict_t* load_edict_slot(uint32_t number)
+{
+	if (number >= globals.num_edicts)
+		globals.num_edicts = number + 1;
+
+	edict_t* ent = &g_edicts[number];
+	G_InitEdict(ent);
+	return ent;
+}
+
+static void read_level_bin(const std::vector<uint8_t>& bytes)
+{
+	save_bin_reader_t in;
+
+	if (!in.open(bytes))
+		gi.Com_Error("unsupported binary save version");
+
+	const auto members = read_save_members_bin(in);
 
 	// pull version
-	uint32_t save_version = 0; // Initialize to 0 to ensure defined behavior if read fails
-	read_save_type_json(json["save_version"], &save_version, &save_version_type, "save_version");
+	uint32_t save_version = 0;
+	if (read_member_bin(in, members, "save_version"))
+		read_save_type_bin(in, &save_version, &save_version_type, "save_version");
+	else
+		read_save_type_json(Json::Value::nullSingleton(), &save_version, &save_version_type, "save_version");
 
 	// read level
 	json_push_stack("level");
-	read_save_struct_json(json["level"], &level, &level_locals_t_savestruct);
-	upgrade_level(json["level"], save_version);
+	if (read_member_bin(in, members, "level"))
+		read_save_root_bin(in, &level, &level_locals_t_savestruct);
+	else
+		read_save_struct_json(Json::Value::nullSingleton(), &level, &level_locals_t_savestruct);
+	upgrade_level(Json::Value::nullSingleton(), save_version);
 	json_pop_stack();
 
 	// read entities
-	const Json::Value& entities = json["entities"];
-
-	if (!entities.isObject())
+	if (!read_member_bin(in, members, "entities") || in.get_byte() != SBT_OBJECT)
 		gi.Com_Error("expected \"entities\" to be object");
 
-	for (auto it = entities.begin(); it != entities.end(); it++)
+	std::string_view id;
+	uint32_t		 key_id;
+
+	while (in.get_key(id, key_id))
 	{
-		const char* dummy;
-		const char* id = it.memberName(&dummy);
-		const Json::Value& value = *it;
-		uint32_t		   number = strtoul(id, nullptr, 10);
+		uint32_t number = 0;
+		auto result = std::from_chars(id.data(), id.data() + id.size(), number);
 
-		if (number >= globals.num_edicts)
-			globals.num_edicts = number + 1;
+		if (result.ec != std::errc() || number >= game.maxentities)
+			gi.Com_ErrorFmt("invalid entity number \"{}\"", id);
 
-		edict_t* ent = &g_edicts[number];
-		G_InitEdict(ent);
+		edict_t* ent = load_edict_slot(number);
 		json_push_stack(fmt::format("entities[{}]", number));
-		read_save_struct_json(value, ent, &edict_t_savestruct);
-		upgrade_edict(ent, value, save_version);
+		read_save_root_bin(in, ent, &edict_t_savestruct);
+		upgrade_edict(ent, Json::Value::nullSingleton(), save_version);
 		json_pop_stack();
 		gi.linkentity(ent);
 	}
+}
 
+// load time fixups shared by both save formats
+static void finish_level_load()
+{
 	// mark all clients as unconnected
 	for (size_t i = 0; i < game.maxclients; i++)
 	{
@@ -2752,6 +3776,75 @@ void ReadLevelJson(const char* jsonString)
 	cached_imageindex::reset_all();
 
 	G_LoadShadowLights();
+
+	HealRegistry::Rebuild();
+	GibPool::Rebuild();
+	HordePhys::g_radius_index.Invalidate();
+	LagRewind::Reset();
+	TriggerIndex::Rebuild();
+	PushIndex::Rebuild();
+	MonsterTable::Rebuild();
+	PVM_ResetBackpacks();
+	G_InvalidateStats(STATS_ALL);
+	PlayerTrail_Destroy(nullptr);
+	Hook_ResetCandidates();
+}
+
+// new entry point for ReadLevel.
+// takes in pointer to JSON data. does
+// not store or modify it.
+void ReadLevelJson(const char* jsonString)
+{
+	// free any dynamic memory allocated by loading the level
+	// base state
+	gi.FreeTags(TAG_LEVEL);
+
+	std::vector<uint8_t> bytes;
+
+	if (save_bin_unwrap(jsonString, bytes))
+	{
+		wipe_edicts_for_load();
+		read_level_bin(bytes);
+		finish_level_load();
+		return;
+	}
+
+	Json::Value json = parseJson(jsonString);
+
+	wipe_edicts_for_load();
+
+	// pull version
+	uint32_t save_version = 0; // Initialize to 0 to ensure defined behavior if read fails
+	read_save_type_json(json["save_version"], &save_version, &save_version_type, "save_version");
+
+	// read level
+	json_push_stack("level");
+	read_save_struct_json(json["level"], &level, &level_locals_t_savestruct);
+	upgrade_level(json["level"], save_version);
+	json_pop_stack();
+
+	// read entities
+	const Json::Value& entities = json["entities"];
+
+	if (!entities.isObject())
+		gi.Com_Error("expected \"entities\" to be object");
+
+	for (auto it = entities.begin(); it != entities.end(); it++)
+	{
+		const char* dummy;
+		const char* id = it.memberName(&dummy);
+		const Json::Value& value = *it;
+		uint32_t		   number = strtoul(id, nullptr, 10);
+
+		edict_t* ent = load_edict_slot(number);
+		json_push_stack(fmt::format("entities[{}]", number));
+		read_save_struct_json(value, ent, &edict_t_savestruct);
+		upgrade_edict(ent, value, save_version);
+		json_pop_stack();
+		gi.linkentity(ent);
+	}
+
+	finish_level_load();
 }
 
 // [Paril-KEX]
@@ -4,6 +4,14 @@
 #include "g_local.h"
 #include "memory_safety.h"
 #include "horde/horde_ids.h"
+#include "horde/g_heal_registry.h"
+#include "horde/g_horde_phys.h"
+#include "horde/g_gib_pool.h"
+#include "horde/g_lag_rewind.h"
+#include "horde/g_trigger_index.h"
+#include "horde/g_push_index.h"
+#include "horde/g_monster_table.h"
+#include "horde/g_pvm.h"
 #include <boost/container/flat_map.hpp>
 #include <string_view>
 
@@ -683,10 +691,9 @@ static const char* select_replacement_classname(const char* classname, std::span
 
 		std::span<const char* const> available_replacements(repl.replacements.data(), repl.replacement_count);
 
-		// Select a random replacement using the Mersenne Twister engine,
-		// scanning forward if the chosen slot happens to be invalid.
-		std::uniform_int_distribution<size_t> distrib(0, available_replacements.size() - 1);
-		const size_t index = distrib(mt_rand);
+		// Select a random replacement, scanning forward if the chosen
+		// slot happens to be invalid.
+		const size_t index = random_index(available_replacements);
 
 		for (size_t i = 0; i < available_replacements.size(); ++i) {
 			const size_t next_index = (index + i) % available_replacements.size();
@@ -1863,6 +1870,24 @@ void SpawnEntities(const char* mapname, const char* entities, const char* spawnp
 #pragma GCC diagnostic pop
 #endif
 
+	// no entity is left holding a pointer into a config snapshot a reload replaced
+	Config_ReleaseRetiredSnapshots();
+	HealRegistry::Clear();
+	GibPool::Clear();
+	HordePhys::g_radius_index.Invalidate();
+	LagRewind::Reset();
+	TriggerIndex::Reset();
+	PushIndex::Reset();
+	MonsterTable::Reset();
+	PVM_ResetBackpacks();
+	G_InvalidateStats(STATS_ALL);
+	PlayerTrail_Destroy(nullptr);
+	Hook_ResetCandidates();
+
+	// with g_rng_seed set, every map starts its streams over from that seed
+	G_SeedRandom();
+	const rng_scope_t rng_scope(rng_stream_t::spawn);
+
 	// Initialize global spawner limits for spawner monsters in horde mode
 	level.global_spawner_limit = 20;
 	level.global_spawned_count = 0;
@@ -2265,14 +2290,12 @@ static void G_InitStatusbar()
 		sb.story();
 	}
 
-	gi.configstring(CS_STATUSBAR, sb.sb.str().c_str());
+	gi.configstring(CS_STATUSBAR, sb.c_str());
 
-	// Validate the generated statusbar for if/endif balance
-	if (developer && developer->integer)
-	{
-		std::string statusbar_str = sb.sb.str();
-		ValidateLayoutString(statusbar_str, "CS_STATUSBAR");
-	}
+	// the writer tracks if/endif balance as it goes
+	if (developer && developer->integer && (!sb.balanced() || sb.truncated()))
+		gi.Com_PrintFmt("ERROR: CS_STATUSBAR layout is {} ({} bytes)\n",
+			sb.truncated() ? "truncated" : "unbalanced", sb.size());
 }
 
 void InitMonsterSpawnTable()
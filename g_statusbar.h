@@ -1,63 +1,207 @@
 // Copyright (c) ZeniMax Media Inc.
 // Licensed under the GNU General Public License 2.0.
 
-#include <sstream>
+#pragma once
 
-// easy statusbar wrapper
-struct statusbar_t
+#include <charconv>
+#include <string_view>
+
+// max payload for a single svc_layout message; the reliable
+// message it rides in tops out around 1400 bytes
+constexpr size_t MAX_LAYOUT_LENGTH = 1400;
+
+// fixed-capacity layout writer; builds the layout program in place,
+// no heap allocation. if/endif nesting is tracked as tokens are written,
+// so a finished layout is known to be balanced without re-scanning it.
+// a token that doesn't fit is dropped whole, and if it was inside an
+// if/endif block the entire outermost block is dropped with it, so an
+// overflow can never leave a half-written block behind.
+template<size_t N>
+struct layout_writer_t
 {
-	std::stringstream sb;
-
-	inline auto& yb(int32_t offset) { sb << "yb " << offset << ' '; return *this; }
-	inline auto& yt(int32_t offset) { sb << "yt " << offset << ' '; return *this; }
-	inline auto& yv(int32_t offset) { sb << "yv " << offset << ' '; return *this; }
-	inline auto& xl(int32_t offset) { sb << "xl " << offset << ' '; return *this; }
-	inline auto& xr(int32_t offset) { sb << "xr " << offset << ' '; return *this; }
-	inline auto& xv(int32_t offset) { sb << "xv " << offset << ' '; return *this; }
-
-	inline auto& ifstat(player_stat_t stat) { sb << "if " << stat << ' '; return *this; }
-	inline auto& endifstat() { sb << "endif "; return *this; }
-
-	inline auto& pic(player_stat_t stat) { sb << "pic " << stat << ' '; return *this; }
-	inline auto& picn(const char* icon) { sb << "picn " << icon << ' '; return *this; }
-
-	inline auto& anum() { sb << "anum "; return *this; }
-	inline auto& rnum() { sb << "rnum "; return *this; }
-	inline auto& hnum() { sb << "hnum "; return *this; }
-	inline auto& num(int32_t width, player_stat_t stat) { sb << "num " << width << ' ' << stat << ' '; return *this; }
-
-	inline auto& loc_stat_string(player_stat_t stat) { sb << "loc_stat_string " << stat << ' '; return *this; }
-	inline auto& loc_stat_rstring(player_stat_t stat) { sb << "loc_stat_rstring " << stat << ' '; return *this; }
-	inline auto& stat_string(player_stat_t stat) { sb << "stat_string " << stat << ' '; return *this; }
-	inline auto& loc_stat_cstring2(player_stat_t stat) { sb << "loc_stat_cstring2 " << stat << ' '; return *this; }
-	inline auto& string2(const char* str)
-	{
-		if (str[0] != '"' && (strchr(str, ' ') || strchr(str, '\n')))
-			sb << "string2 \"" << str << "\" ";
-		else
-			sb << "string2 " << str << ' ';
-		return *this;
+	layout_writer_t() { buffer[0] = '\0'; }
+
+	layout_writer_t(const layout_writer_t &) = delete;
+	layout_writer_t &operator=(const layout_writer_t &) = delete;
+
+	inline auto& yb(int32_t offset) { return emit("yb ", offset, ' '); }
+	inline auto& yt(int32_t offset) { return emit("yt ", offset, ' '); }
+	inline auto& yv(int32_t offset) { return emit("yv ", offset, ' '); }
+	inline auto& xl(int32_t offset) { return emit("xl ", offset, ' '); }
+	inline auto& xr(int32_t offset) { return emit("xr ", offset, ' '); }
+	inline auto& xv(int32_t offset) { return emit("xv ", offset, ' '); }
+
+	inline auto& ifstat(player_stat_t stat) { open_block(); return emit("if ", stat_index(stat), ' '); }
+	inline auto& ifgef(int64_t frame) { open_block(); return emit("ifgef ", frame, ' '); }
+	inline auto& endifstat() { emit("endif "); return close_block(); }
+	inline auto& endif() { return endifstat(); }
+
+	inline auto& pic(player_stat_t stat) { return emit("pic ", stat_index(stat), ' '); }
+	inline auto& picn(std::string_view icon) { return emit("picn ", icon, ' '); }
+
+	inline auto& anum() { return emit("anum "); }
+	inline auto& rnum() { return emit("rnum "); }
+	inline auto& hnum() { return emit("hnum "); }
+	inline auto& num(int32_t width, player_stat_t stat) { return emit("num ", width, ' ', stat_index(stat), ' '); }
+
+	inline auto& loc_stat_string(player_stat_t stat) { return emit("loc_stat_string ", stat_index(stat), ' '); }
+	inline auto& loc_stat_rstring(player_stat_t stat) { return emit("loc_stat_rstring ", stat_index(stat), ' '); }
+	inline auto& stat_string(player_stat_t stat) { return emit("stat_string ", stat_index(stat), ' '); }
+	inline auto& loc_stat_cstring2(player_stat_t stat) { return emit("loc_stat_cstring2 ", stat_index(stat), ' '); }
+	inline auto& string2(std::string_view str) { return emit("string2 ", maybe_quoted{ str }, ' '); }
+	inline auto& string(std::string_view str) { return emit("string ", maybe_quoted{ str }, ' '); }
+	inline auto& cstring2(std::string_view str) { return emit("cstring2 ", maybe_quoted{ str }, ' '); }
+	inline auto& loc_rstring(std::string_view str) { return emit("loc_rstring 0 ", maybe_quoted{ str }, ' '); }
+
+	// localized text with one argument, eg. `loc_string2 1 "$key" "arg"`;
+	// `alt` selects the highlighted (2) variant of `cmd`
+	inline auto& loc_text(std::string_view cmd, bool alt, std::string_view text, std::string_view arg)
+	{
+		return emit(cmd, alt ? "2 1 " : " 1 ", quoted{ text }, ' ', quoted{ arg }, ' ');
 	}
-	inline auto& string(const char* str)
+	inline auto& loc_text(std::string_view cmd, bool alt, std::string_view text)
 	{
-		if (str[0] != '"' && (strchr(str, ' ') || strchr(str, '\n')))
-			sb << "string \"" << str << "\" ";
-		else
-			sb << "string " << str << ' ';
-		return *this;
+		return emit(cmd, alt ? "2 0 " : " 0 ", quoted{ text }, ' ');
 	}
-	inline auto& loc_rstring(const char* str)
+
+	inline auto& lives_num(player_stat_t stat) { return emit("lives_num ", stat_index(stat), ' '); }
+	inline auto& stat_pname(player_stat_t stat) { return emit("stat_pname ", stat_index(stat), ' '); }
+
+	inline auto& client(int32_t x, int32_t y, int32_t clientnum, int32_t score, int32_t ping, int32_t time)
 	{
-		if (str[0] != '"' && (strchr(str, ' ') || strchr(str, '\n')))
-			sb << "loc_rstring 0 \"" << str << "\" ";
-		else
-			sb << "loc_rstring 0 " << str << ' ';
+		return emit("client ", x, ' ', y, ' ', clientnum, ' ', score, ' ', ping, ' ', time, ' ');
+	}
+	inline auto& dogtag(int32_t clientnum) { return emit("dogtag ", clientnum, ' '); }
+	inline auto& time_limit(int64_t frame) { return emit("time_limit ", frame, ' '); }
+
+	inline auto& health_bars() { return emit("health_bars "); }
+	inline auto& story() { return emit("story "); }
+
+	// raw program text; must not open or close if/endif blocks
+	inline auto& raw(std::string_view text) { return emit(text); }
+
+	// drop everything written after `mark` (an earlier size()); only
+	// valid outside of blocks, eg. to take back a partially written row
+	inline void rewind(size_t mark)
+	{
+		if (depth || mark > length)
+			return;
+		length = mark;
+		buffer[length] = '\0';
+	}
+
+	// results
+	[[nodiscard]] inline const char *c_str() const { return buffer; }
+	[[nodiscard]] inline std::string_view str() const { return { buffer, length }; }
+	[[nodiscard]] inline size_t size() const { return length; }
+	[[nodiscard]] inline bool empty() const { return !length; }
+	[[nodiscard]] inline size_t remaining() const { return N - length; }
+	// every if has its endif; always true once the caller closed its blocks
+	[[nodiscard]] inline bool balanced() const { return !depth && !stray_endif; }
+	// something was dropped for lack of space
+	[[nodiscard]] inline bool truncated() const { return overflowed; }
+
+private:
+	struct quoted { std::string_view str; };
+	struct maybe_quoted { std::string_view str; };
+
+	char    buffer[N + 1];
+	size_t  length = 0;
+	size_t  block_start = 0; // length before the outermost open block
+	int32_t depth = 0;
+	bool    discarding = false; // dropping the rest of an overflowed block
+	bool    overflowed = false;
+	bool    stray_endif = false;
+
+	static inline int32_t stat_index(player_stat_t stat) { return static_cast<int32_t>(stat); }
+
+	inline bool put(std::string_view str)
+	{
+		if (str.size() > N - length)
+			return false;
+		memcpy(buffer + length, str.data(), str.size());
+		length += str.size();
+		return true;
+	}
+	inline bool put(const char *str) { return put(std::string_view(str)); }
+	inline bool put(char c) { return put(std::string_view(&c, 1)); }
+	// the layout parser has no escapes, so an embedded quote
+	// would end the token early; swap it for an apostrophe
+	inline bool put(quoted q)
+	{
+		if (!put('"'))
+			return false;
+		for (size_t pos = 0; pos < q.str.size(); )
+		{
+			const size_t quote = std::min(q.str.find('"', pos), q.str.size());
+			if (!put(q.str.substr(pos, quote - pos)) || (quote < q.str.size() && !put('\'')))
+				return false;
+			pos = quote + 1;
+		}
+		return put('"');
+	}
+	inline bool put(maybe_quoted q)
+	{
+		if (!q.str.empty() && q.str.front() != '"' &&
+			(q.str.find(' ') != std::string_view::npos || q.str.find('\n') != std::string_view::npos))
+			return put(quoted{ q.str });
+		return put(q.str);
+	}
+	template<typename T> requires std::is_integral_v<T>
+	inline bool put(T value)
+	{
+		auto [end, ec] = std::to_chars(buffer + length, buffer + N, value);
+		if (ec != std::errc())
+			return false;
+		length = end - buffer;
+		return true;
+	}
+
+	// writes all parts as one token, or none of them
+	template<typename... Parts>
+	inline layout_writer_t &emit(const Parts &... parts)
+	{
+		if (discarding)
+			return *this;
+
+		const size_t start = length;
+
+		if (!(put(parts) && ...))
+		{
+			length = start;
+			overflowed = true;
+
+			// roll back to before the outermost open block and
+			// swallow the rest of it until it closes
+			if (depth)
+			{
+				length = block_start;
+				discarding = true;
+			}
+		}
+
+		buffer[length] = '\0';
 		return *this;
 	}
 
-	inline auto& lives_num(player_stat_t stat) { sb << "lives_num " << stat << ' '; return *this; }
-	inline auto& stat_pname(player_stat_t stat) { sb << "stat_pname " << stat << ' '; return *this; }
+	inline void open_block()
+	{
+		if (!depth)
+			block_start = length;
+		depth++;
+	}
+
+	inline layout_writer_t &close_block()
+	{
+		if (!depth)
+			stray_endif = true;
+		else if (!--depth)
+			discarding = false;
+		return *this;
+	}
+};
 
-	inline auto& health_bars() { sb << "health_bars "; return *this; }
-	inline auto& story() { sb << "story "; return *this; }
-};
\ No newline at end of file
+// statusbar programs span the whole CS_STATUSBAR configstring range
+using statusbar_t = layout_writer_t<CS_SIZE(CS_STATUSBAR) - 1>;
+// menus and scoreboards sent over svc_layout
+using layout_t = layout_writer_t<MAX_LAYOUT_LENGTH>;
@@ -3,7 +3,18 @@
 
 #include "g_local.h"
 #include "horde/g_character.h"
+#include "horde/horde_spawning.h"
+#include "horde/g_think_idle.h"
+#include "horde/g_effect_queue.h"
+#include "horde/g_gib_pool.h"
+#include "horde/g_metrics.h"
+#include "horde/g_lag_rewind.h"
+#include "horde/g_trigger_index.h"
+#include "horde/g_monster_table.h"
+#include "bots/bot_utils.h"
 #include "shared.h"
+#include "q_vec3_batch.h"
+#include <chrono>
 
 void Svcmd_Test_f()
 {
@@ -332,6 +343,214 @@ void SVCmd_TacticalSpawns_f()
 	gi.LocBroadcast_Print(PRINT_HIGH, "Tactical spawning set to: {} ({})\n", mode, mode_str);
 }
 
+/*
+=================
+SVCmd_SaveConvert_f
+Debug command: sv saveconvert <in> <out>
+Converts a save file between the JSON and binary formats
+=================
+*/
+void SVCmd_SaveConvert_f()
+{
+	if (gi.argc() < 4)
+	{
+		gi.LocClient_Print(nullptr, PRINT_HIGH, "Usage: sv saveconvert <in> <out>\n");
+		return;
+	}
+
+	G_ConvertSaveFile(gi.argv(2), gi.argv(3));
+}
+
+/*
+=================
+SVCmd_RngBench_f
+Debug command: sv rngbench [count]
+Compares the random helpers against the old mt19937 + <random> distributions:
+draws per second, and mean, variance, lag-1 correlation and a 256 bucket
+chi-square of each. Runs on private generators; the game's streams are untouched.
+=================
+*/
+void SVCmd_RngBench_f()
+{
+	const int64_t requested = gi.argc() > 2 ? strtoll(gi.argv(2), nullptr, 10) : 0;
+	const int64_t count = requested > 0 ? requested : 10'000'000;
+
+	struct result_t
+	{
+		double float_ns, int_ns, raw_ns;
+		double mean, variance, correlation, chi_square;
+	};
+
+	// `next_float`, `next_int` and `next_raw` draw from the generator under test
+	auto run = [count](auto&& next_float, auto&& next_int, auto&& next_raw) {
+		using clock = std::chrono::steady_clock;
+		result_t result{};
+		volatile uint64_t sink = 0;
+		uint64_t acc = 0;
+
+		auto start = clock::now();
+		float facc = 0.f;
+		for (int64_t i = 0; i < count; i++)
+			facc += next_float();
+		result.float_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / count;
+		sink = sink + static_cast<uint64_t>(facc);
+
+		start = clock::now();
+		for (int64_t i = 0; i < count; i++)
+			acc += next_int(100);
+		result.int_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / count;
+
+		start = clock::now();
+		for (int64_t i = 0; i < count; i++)
+			acc += next_raw();
+		result.raw_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / count;
+		sink = sink + acc;
+
+		double sum = 0, sum_sq = 0, sum_lag = 0, previous = next_float();
+		for (int64_t i = 0; i < count; i++)
+		{
+			const double value = next_float();
+			sum += value;
+			sum_sq += value * value;
+			sum_lag += (value - 0.5) * (previous - 0.5);
+			previous = value;
+		}
+		result.mean = sum / count;
+		result.variance = sum_sq / count - result.mean * result.mean;
+		result.correlation = (sum_lag / count) / (1.0 / 12.0);
+
+		std::array<int64_t, 256> buckets{};
+		for (int64_t i = 0; i < count; i++)
+			buckets[next_int(256)]++;
+		const double expected = count / 256.0;
+		for (int64_t bucket : buckets)
+			result.chi_square += (bucket - expected) * (bucket - expected) / expected;
+
+		return result;
+	};
+
+	std::mt19937 mt(static_cast<uint32_t>(rng_seed));
+	const result_t old_result = run(
+		[&mt] { return std::uniform_real_distribution<float>()(mt); },
+		[&mt](int32_t max) { return std::uniform_int_distribution<int32_t>(0, max - 1)(mt); },
+		[&mt] { return mt(); });
+
+	pcg32_t bench(rng_seed, 0);
+	pcg32_t* const previous = rng_current;
+	rng_current = &bench;
+	const result_t new_result = run(
+		[] { return frandom(); },
+		[](int32_t max) { return irandom(max); },
+		[] { return irandom(); });
+	rng_current = previous;
+
+	gi.Com_PrintFmt("=== RNG ({} draws each, seed {}, {}) ===\n", count, rng_seed, g_rng_seed->string[0] && strcmp(g_rng_seed->string, "0") ? "g_rng_seed" : "clock");
+	gi.Com_PrintFmt("{:<22} {:>14} {:>14}\n", "", "mt19937", "pcg32");
+	gi.Com_PrintFmt("{:<22} {:>14} {:>14}\n", "state bytes", sizeof(std::mt19937), sizeof(pcg32_t));
+	gi.Com_PrintFmt("{:<22} {:>14.2f} {:>14.2f}\n", "frandom() ns", old_result.float_ns, new_result.float_ns);
+	gi.Com_PrintFmt("{:<22} {:>14.2f} {:>14.2f}\n", "irandom(100) ns", old_result.int_ns, new_result.int_ns);
+	gi.Com_PrintFmt("{:<22} {:>14.2f} {:>14.2f}\n", "raw ns", old_result.raw_ns, new_result.raw_ns);
+	gi.Com_PrintFmt("{:<22} {:>14.6f} {:>14.6f}\n", "mean (0.5)", old_result.mean, new_result.mean);
+	gi.Com_PrintFmt("{:<22} {:>14.6f} {:>14.6f}\n", "variance (0.083333)", old_result.variance, new_result.variance);
+	gi.Com_PrintFmt("{:<22} {:>14.6f} {:>14.6f}\n", "lag-1 correlation (0)", old_result.correlation, new_result.correlation);
+	gi.Com_PrintFmt("{:<22} {:>14.1f} {:>14.1f}\n", "chi-square (255 +-23)", old_result.chi_square, new_result.chi_square);
+}
+
+/*
+=================
+SVCmd_VecBench_f
+Debug command: sv vecbench [passes]
+Checks each batch vec3 test against its scalar body on random points, edge
+cases included, and times both per point for batches the size the culling
+loops see (a handful of grid candidates up to a full trigger list).
+=================
+*/
+void SVCmd_VecBench_f()
+{
+	using clock = std::chrono::steady_clock;
+
+	const int64_t requested = gi.argc() > 2 ? strtoll(gi.argv(2), nullptr, 10) : 0;
+	const int64_t passes = requested > 0 ? requested : 20'000;
+
+	pcg32_t rng(rng_seed, 13);
+	auto random_in = [&rng](float lo, float hi) { return lo + (hi - lo) * (static_cast<float>(rng() >> 8) * 0x1p-24f); };
+
+	gi.Com_PrintFmt("=== Batch vec3 ({} path, {} passes) ===\n", batch_vec3_path(), passes);
+	gi.Com_PrintFmt("{:>6} {:<16} {:>10} {:>10}\n", "points", "test", "batch ns", "scalar ns");
+
+	for (size_t count : { 7u, 64u, 1024u })
+	{
+		std::vector<vec3_t> points(count), maxs(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			points[i] = { random_in(-1024, 1024), random_in(-1024, 1024), random_in(-1024, 1024) };
+			maxs[i] = points[i] + vec3_t{ random_in(0, 128), random_in(0, 128), random_in(0, 128) };
+		}
+
+		// the apex itself, and points exactly on the sphere and box faces
+		const vec3_t center{ 0, 0, 0 }, dir{ 1, 0, 0 }, box_mins{ -256, -256, -256 }, box_maxs{ 256, 256, 256 };
+		points[0] = center;
+		points[1 % count] = { 512, 0, 0 };
+		points[2 % count] = { -300, 0, 0 };
+		maxs[2 % count] = { box_mins.x, 10, 10 };
+
+		std::vector<float> distances(count), scalar_distances(count);
+		std::vector<uint32_t> indices(count), scalar_indices(count);
+		bool agree = true;
+
+		batch_distance_squared(points, center, distances.data());
+		batch_distance_squared_scalar(points, center, scalar_distances.data());
+		agree &= distances == scalar_distances;
+
+		for (float min_dot : { -0.5f, 0.f, 0.5f, 0.98f })
+		{
+			const size_t n = batch_in_cone(points, center, dir, min_dot, 1024.f * 1024.f, indices.data());
+			const size_t scalar_n = batch_in_cone_scalar(points, center, dir, min_dot, 1024.f * 1024.f, scalar_indices.data());
+			agree &= n == scalar_n && std::equal(indices.begin(), indices.begin() + n, scalar_indices.begin());
+		}
+
+		size_t n = batch_in_sphere(points, center, 512.f * 512.f, indices.data());
+		size_t scalar_n = batch_in_sphere_scalar(points, center, 512.f * 512.f, scalar_indices.data());
+		agree &= n == scalar_n && std::equal(indices.begin(), indices.begin() + n, scalar_indices.begin());
+
+		n = batch_boxes_intersect(points, maxs, box_mins, box_maxs, indices.data());
+		scalar_n = batch_boxes_intersect_scalar(points, maxs, box_mins, box_maxs, scalar_indices.data());
+		agree &= n == scalar_n && std::equal(indices.begin(), indices.begin() + n, scalar_indices.begin());
+
+		if (!agree)
+			gi.Com_PrintFmt("WARNING: batch and scalar results differ for {} points\n", count);
+
+		// `test` runs one pass; ns per point
+		uint64_t sink = 0;
+		auto time = [&](auto&& test) {
+			const auto began = clock::now();
+			for (int64_t pass = 0; pass < passes; pass++)
+				sink += test();
+			return std::chrono::duration<double, std::nano>(clock::now() - began).count() / (passes * count);
+		};
+
+		auto report = [&](const char* name, auto&& batch, auto&& scalar) {
+			const double batch_ns = time(batch), scalar_ns = time(scalar);
+			gi.Com_PrintFmt("{:>6} {:<16} {:>10.2f} {:>10.2f}\n", count, name, batch_ns, scalar_ns);
+		};
+
+		report("distance",
+			[&] { batch_distance_squared(points, center, distances.data()); return distances[0] > 0; },
+			[&] { batch_distance_squared_scalar(points, center, distances.data()); return distances[0] > 0; });
+		report("sphere",
+			[&] { return batch_in_sphere(points, center, 512.f * 512.f, indices.data()); },
+			[&] { return batch_in_sphere_scalar(points, center, 512.f * 512.f, indices.data()); });
+		report("cone",
+			[&] { return batch_in_cone(points, center, dir, 0.5f, 1024.f * 1024.f, indices.data()); },
+			[&] { return batch_in_cone_scalar(points, center, dir, 0.5f, 1024.f * 1024.f, indices.data()); });
+		report("box overlap",
+			[&] { return batch_boxes_intersect(points, maxs, box_mins, box_maxs, indices.data()); },
+			[&] { return batch_boxes_intersect_scalar(points, maxs, box_mins, box_maxs, indices.data()); });
+
+		(void) sink;
+	}
+}
+
 /*
 =================
 ServerCommand
@@ -548,6 +767,38 @@ void ServerCommand()
 		SVCmd_ResetPlayer_f();
 	else if (Q_strcasecmp(cmd, "tacticspawns") == 0)
 		SVCmd_TacticalSpawns_f();
+	else if (Q_strcasecmp(cmd, "pickstats") == 0)
+		Horde_PrintMonsterSelectionStats();
+	else if (Q_strcasecmp(cmd, "spawnpool") == 0)
+		Horde_PrintSpawnPositionPoolStats();
+	else if (Q_strcasecmp(cmd, "saveconvert") == 0)
+		SVCmd_SaveConvert_f();
+	else if (Q_strcasecmp(cmd, "radiusstats") == 0)
+		G_PrintRadiusStats();
+	else if (Q_strcasecmp(cmd, "thinkstats") == 0)
+		ThinkIdle::PrintStats();
+	else if (Q_strcasecmp(cmd, "testats") == 0)
+		EffectQueue::PrintStats();
+	else if (Q_strcasecmp(cmd, "gibstats") == 0)
+		GibPool::PrintStats();
+	else if (Q_strcasecmp(cmd, "rngbench") == 0)
+		SVCmd_RngBench_f();
+	else if (Q_strcasecmp(cmd, "vecbench") == 0)
+		SVCmd_VecBench_f();
+	else if (Q_strcasecmp(cmd, "metrics") == 0)
+		Metrics::PrintStats();
+	else if (Q_strcasecmp(cmd, "lagbench") == 0)
+		LagRewind::Bench();
+	else if (Q_strcasecmp(cmd, "pushbench") == 0)
+		SV_PushBench();
+	else if (Q_strcasecmp(cmd, "triggerstats") == 0)
+		TriggerIndex::PrintStats();
+	else if (Q_strcasecmp(cmd, "statestats") == 0)
+		Entity_PrintStateStats();
+	else if (Q_strcasecmp(cmd, "hudstats") == 0)
+		G_PrintStatStats();
+	else if (Q_strcasecmp(cmd, "monsterbench") == 0)
+		MonsterTable::Bench();
 	// REMOVED: Asset manager commands (assetstats, assetlist, assetcleanup)
 	else
 		gi.LocClient_Print(nullptr, PRINT_HIGH, "Unknown server command \"{}\"\n", cmd);
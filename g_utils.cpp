@@ -5,6 +5,11 @@
 #include "g_local.h"
 #include "shared.h"
 #include "memory_safety.h"
+#include "horde/g_heal_registry.h"
+#include "horde/g_gib_pool.h"
+#include "horde/g_horde_phys.h"
+#include "horde/g_trigger_index.h"
+#include "horde/g_monster_table.h"
 #include <boost/container/small_vector.hpp>
 
 // Entity spawning and reuse constants
@@ -31,11 +36,6 @@ inline bool IsValidEntity(edict_t* ent) {
 	return ent && ent->inuse;
 }
 
-// Calculates the center point of an entity's bounding box
-inline vec3_t CalculateEntityCenter(const edict_t* ent) {
-	return ent->s.origin + (ent->mins + ent->maxs) * 0.5f;
-}
-
 // Validates a layout string before it is sent to the client. Checks two things:
 //   1. Every if/ifgef has a matching endif (unbalanced conditionals crash the
 //      client-side layout parser).
@@ -225,26 +225,71 @@ edict_t* findradius(edict_t* from, const vec3_t& org, float rad)
 	// Ensure we don't exceed the array bounds
 	const edict_t* const edicts_end = &g_edicts[globals.num_edicts];
 
-	// Iterate through entities
+	// Iterate through entities; G_EntityInRadius is the shared test radius_edicts uses too
 	for (; from < edicts_end; from++) {
-		// Basic entity validation
-		if (!from->inuse || from->solid == SOLID_NOT) {
-			continue;
+		if (G_EntityInRadius(from, org, rad_squared)) {
+			return from;
 		}
+	}
 
-		// Calculate vector from search origin to entity center
-		const vec3_t entity_center = CalculateEntityCenter(from);
-		const vec3_t eorg = org - entity_center;
+	return nullptr;
+}
 
-		// Use squared length comparison to avoid sqrt
-		if (eorg.lengthSquared() > rad_squared) {
-			continue;
-		}
+static uint64_t radius_queries, radius_mismatches;
 
-		return from;
+/*
+=================
+radius_edicts
+
+findradius as a range over the radius index, for
+	for (edict_t* ent : radius_edicts(org, rad))
+Same entities, same order. With g_findradius_check set,
+every query is also run through findradius and any
+difference is printed.
+=================
+*/
+radius_edicts_t radius_edicts(const vec3_t& org, float rad)
+{
+	radius_edicts_t range { {}, org, rad * rad };
+
+	if (!is_valid_vector(org) || rad <= 0.0f)
+		return range;
+
+	HordePhys::g_radius_index.Query(org, rad, range.candidates);
+	radius_queries++;
+
+	if (g_findradius_check->integer)
+	{
+		boost::container::small_vector<edict_t*, 64> linear;
+
+		for (edict_t* ent = nullptr; (ent = findradius(ent, org, rad)) != nullptr; )
+			linear.push_back(ent);
+
+		if (!std::equal(linear.begin(), linear.end(), range.candidates.begin(), range.candidates.end()))
+		{
+			radius_mismatches++;
+			gi.Com_PrintFmt("radius_edicts mismatch at {} radius {}: {} indexed, {} by findradius\n", org, rad, range.candidates.size(), linear.size());
+
+			for (edict_t* ent : linear)
+				if (std::find(range.candidates.begin(), range.candidates.end(), ent) == range.candidates.end())
+					gi.Com_PrintFmt("  missing {} ({}) at {}\n", ent->s.number, ent->classname ? ent->classname : "?", ent->s.origin);
+
+			for (edict_t* ent : range.candidates)
+				if (std::find(linear.begin(), linear.end(), ent) == linear.end())
+					gi.Com_PrintFmt("  extra {} ({}) at {}\n", ent->s.number, ent->classname ? ent->classname : "?", ent->s.origin);
+
+			// fall back to the linear answer so a miss doesn't change gameplay while checking
+			range.candidates.assign(linear.begin(), linear.end());
+		}
 	}
 
-	return nullptr;
+	return range;
+}
+
+void G_PrintRadiusStats()
+{
+	gi.Com_PrintFmt("radius_edicts: {} queries, {} findradius mismatches{}\n", radius_queries, radius_mismatches,
+		g_findradius_check->integer ? "" : " (g_findradius_check is off)");
 }
 
 /*
@@ -507,6 +552,7 @@ void G_InitEdict(edict_t* e)
 	e->classname = "noclass";
 	e->gravity = 1.0;
 	e->s.number = e - g_edicts;
+	HordePhys::g_radius_index.NoteMoved(e);
 
 	// PGM - do this before calling the spawn function so it can be overridden.
 	e->gravityVector[0] = 0.0;
@@ -605,7 +651,7 @@ THINK(G_FreeEdict) (edict_t* ed) -> void {
         if (other->target_ent == ed) other->target_ent = nullptr;
         if (other->teammaster == ed) other->teammaster = nullptr;
         if (other->teamchain == ed) other->teamchain = nullptr;
-        if (other->chain == ed) other->chain = nullptr; // Used by player_trail
+        if (other->chain == ed) other->chain = nullptr;
 
         // Check client-specific pointers
         if (other->client) {
@@ -613,10 +659,6 @@ THINK(G_FreeEdict) (edict_t* ed) -> void {
             if (other->client->sight_entity == ed) other->client->sight_entity = nullptr;
             if (other->client->sound_entity == ed) other->client->sound_entity = nullptr;
             if (other->client->sound2_entity == ed) other->client->sound2_entity = nullptr;
-            // The player_trail head/tail pointers are handled in PlayerTrail_Destroy,
-            // but adding them here provides an extra layer of safety.
-            if (other->client->trail_head == ed) other->client->trail_head = nullptr;
-            if (other->client->trail_tail == ed) other->client->trail_tail = nullptr;
         }
 
         // Check monster-specific pointers
@@ -654,6 +696,8 @@ THINK(G_FreeEdict) (edict_t* ed) -> void {
          ed->monsterinfo.bbox_squeeze[2] != 0.f))
         SetMonsterSqueeze(ed, {});
 
+    MonsterTable::Remove(ed);
+
     // Preserve and increment spawn count
     int32_t id = ed->spawn_count + 1;
 
@@ -709,6 +753,10 @@ void G_TouchTriggers(edict_t* ent)
 	if ((ent->client || (ent->svflags & SVF_MONSTER)) && (ent->health <= 0))
 		return;
 
+	// [Horde] bounds that haven't changed, or don't reach any trigger, have nothing to touch
+	if (!TriggerIndex::MayTouch(ent))
+		return;
+
 	num = gi.BoxEdicts(ent->absmin, ent->absmax, touch, MAX_EDICTS, AREA_TRIGGERS, G_TouchTriggers_BoxFilter, nullptr);
 
 	// be careful, it is possible to have an entity in this
@@ -810,6 +858,9 @@ BoxEdictsResult_t KillBox_BoxFilter(edict_t* hit, void*)
 
 bool KillBox(edict_t* ent, bool from_spawning, mod_id_t mod, bool bsp_clipping, bool allow_safety)
 {
+	// whatever is being killboxed for just got put somewhere new
+	HordePhys::g_radius_index.NoteMoved(ent);
+
 	// don't telefrag as spectator...
 	if (ent->movetype == MOVETYPE_NOCLIP)
 		return true;
@@ -997,6 +1048,12 @@ void OnEntityRemoved(edict_t* self){
 	// --- Free Savable Memory ---
 	self->moveinfo.curve_positions.release();
 
+	// --- Drop from the medic/fixbot candidate registry ---
+	HealRegistry::Remove(self);
+
+	// --- Drop from the gib/projectile cleanup lists ---
+	GibPool::Remove(self);
+
 	// --- Free the turret/sentry laser-sight beam ---
 	// The laser sight is a separate RF_BEAM entity stored in target_ent and owned by the turret.
 	// turret2_die() frees it explicitly, but turrets are also removed through paths that bypass
@@ -1015,9 +1072,11 @@ void OnEntityRemoved(edict_t* self){
 }
 
 void CleanupInvalidEntities() {
-	for (uint32_t i = 0; i < (globals.num_edicts); i++) {
-		edict_t* ent = &g_edicts[i];
-		if (ent->inuse && ent->svflags & SVF_MONSTER) {
+	// backwards: freeing a monster moves the last row into its place
+	const MonsterTable::table_t& monsters = MonsterTable::Table();
+	for (size_t row = monsters.size(); row-- > 0; ) {
+		if (row < monsters.size() && monsters.health[row] > 0) {
+			edict_t* ent = monsters.edict(row);
 			if (ent->solid == SOLID_NOT && ent->health > 0) {
 				gi.Com_PrintFmt("PRINT: Removing Bug/Immortal monster: {}\n", ent->classname);
 				ent->health = -1;
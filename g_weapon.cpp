@@ -4,6 +4,8 @@
 #include "memory_safety.h"
 #include "horde/g_horde.h"
 #include "horde/g_horde_benefits.h"
+#include "horde/g_gib_pool.h"
+#include "horde/g_lag_rewind.h"
 #include <boost/container/small_vector.hpp>
 
 // Forward declaration for burn function from g_fire.cpp
@@ -106,6 +108,8 @@ void pierce_trace(const vec3_t& start, const vec3_t& end, edict_t* ignore, pierc
 		// [Horde] squeeze-aware: hitscan also hits a squeezed monster's original (model-sized) box.
 		// Point trace (zero extents) == traceline; note the (start, mins, maxs, end, ...) arg order.
 		pierce.tr = G_TraceSqueezeAware(own_start, vec3_origin, vec3_origin, own_end, ignore, mask);
+		// [Horde] inside G_LagCompensate: hit monsters where the shooter saw them
+		LagRewind::Resolve(pierce.tr, own_start, own_end, ignore, mask);
 
 		// [Horde] point-blank fix: a trace that STARTS inside a damageable entity's bbox
 		// (e.g. player dragged into a brain's box by its tongue) reports startsolid with
@@ -1287,6 +1291,7 @@ void fire_grenade(edict_t* self, const vec3_t& start, const vec3_t& aimdir,
 	}
 
 	gi.linkentity(grenade);
+	GibPool::Add(grenade, GibPool::KIND_PROJECTILE);
 }
 
 void fire_grenade2(edict_t* self, const vec3_t& start, const vec3_t& aimdir, int damage, int speed, gtime_t timer, float damage_radius, bool held, bool from_upgraded_prox, float up_adjust)
@@ -1555,6 +1560,7 @@ edict_t* fire_rocket(edict_t* self, const vec3_t& start, const vec3_t& dir, int
 	rocket->classname = "rocket";
 
 	gi.linkentity(rocket);
+	GibPool::Add(rocket, GibPool::KIND_PROJECTILE);
 
 	return rocket;
 }
@@ -1936,8 +1942,7 @@ THINK(bfg_explode) (edict_t* self) -> void
 		size_t processed_count = 0;
 
 		// Find all entities in the damage radius
-		edict_t* ent = nullptr;
-		while ((ent = findradius(ent, self->s.origin, self->dmg_radius)) != nullptr)
+		for (edict_t* ent : radius_edicts(self->s.origin, self->dmg_radius))
 		{
 
 			bool already_processed = false;
@@ -2175,8 +2180,7 @@ THINK(bfg_think) (edict_t* self) -> void
 	size_t processed_count = 0;
 
 	// Find all entities in range
-	edict_t* ent = nullptr;
-	while ((ent = findradius(ent, self_origin, bfgrange)) != nullptr)
+	for (edict_t* ent : radius_edicts(self_origin, bfgrange))
 	{
 		// Skip entities that can't be damaged
 		if (!ent->takedamage || ent == self || ent == self->owner)
@@ -29,6 +29,7 @@
 #include "g_local.h"
 #include "shared.h"
 #include "g_config.h"
+#include "horde/g_horde_phys.h"
 
 // Legacy cvars - kept for console/config compatibility but values now loaded from g_config
 cvar_t* hook_speed;
@@ -95,6 +96,13 @@ bool Hook_CanChainEntity(edict_t* entity, edict_t* player)
 		return true;
 	}
 
+	// Allied summons and defenses: whatever a teammate summoned or deployed
+	if ((entity->monsterinfo.issummoned ||
+		horde::IsSpecialType(entity, horde::SpecialEntityTypeID::SENTRY_GUN) ||
+		horde::IsSpecialType(entity, horde::SpecialEntityTypeID::TURRET)) &&
+		OnSameTeam(entity, player))
+		return true;
+
 	return false;
 }
 
@@ -107,6 +115,66 @@ namespace HookAutoTarget {
 	constexpr float CLOSE_DISTANCE_SQ = CLOSE_DISTANCE * CLOSE_DISTANCE;
 	constexpr float CLOSE_MIN_DOT = 0.7f;        // Wider cone when close
 	constexpr float SCORING_DOT_WEIGHT = 1000.0f; // Weight for aim accuracy in scoring
+
+	// Per-client candidate sets: what could be chained within reach, from the
+	// entity grid, kept until it's REFRESH old or the player moved MAX_MOVE
+	constexpr gtime_t REFRESH = 250_ms;
+	constexpr float MAX_MOVE = 256.0f;
+	constexpr float MARGIN = 512.0f;             // how far targets may come in meanwhile
+	constexpr float EXTENT = 128.0f;             // the grid files entities by their bbox corners
+}
+
+struct hook_candidates_t
+{
+	gtime_t built = gtime_t::from_ms(-1);
+	vec3_t origin{};
+	boost::container::small_vector<std::pair<edict_t*, int32_t>, 16> entries; // with spawn_count
+};
+
+static std::vector<hook_candidates_t> hook_candidates;
+
+// Cheap test before Hook_CanChainEntity: only these kinds are ever chainable
+static bool Hook_MayBeChainable(const edict_t* ent)
+{
+	return (ent->client && (ent->svflags & SVF_BOT)) || ent->monsterinfo.issummoned ||
+		horde::IsSpecialType(ent, horde::SpecialEntityTypeID::SENTRY_GUN) ||
+		horde::IsSpecialType(ent, horde::SpecialEntityTypeID::TURRET) ||
+		horde::IsSpecialType(ent, horde::SpecialEntityTypeID::DOPPLEGANGER);
+}
+
+static void Hook_BuildCandidates(edict_t* player, hook_candidates_t& cache)
+{
+	cache.built = level.time;
+	cache.origin = player->s.origin;
+	cache.entries.clear();
+
+	auto consider = [&](edict_t* target) {
+		if (target->inuse && Hook_MayBeChainable(target) && Hook_CanChainEntity(target, player))
+			cache.entries.emplace_back(target, target->spawn_count);
+	};
+
+	if (HordePhys::g_entity_grid.IsBuilt())
+	{
+		using HordePhys::EntityGrid;
+		const float reach = HookAutoTarget::MAX_DISTANCE + HookAutoTarget::MARGIN + HookAutoTarget::EXTENT;
+
+		for (edict_t* target : HordePhys::g_entity_grid.QueryRadiusFiltered(cache.origin, reach, EntityGrid::TYPE_PLAYERS | EntityGrid::TYPE_MONSTERS))
+			consider(target);
+	}
+	else
+	{
+		for (edict_t* target : active_players())
+			consider(target);
+		for (edict_t* target : active_monsters())
+			consider(target);
+	}
+
+	// sentries and dopplegangers aren't always filed as monsters; the list is short
+	for (edict_t* target : g_targetable_special_entities)
+	{
+		if (std::find_if(cache.entries.begin(), cache.entries.end(), [target](const auto& entry) { return entry.first == target; }) == cache.entries.end())
+			consider(target);
+	}
 }
 
 // Finds the best chainable entity that the player is aiming at
@@ -121,93 +189,47 @@ edict_t* Hook_FindChainableInView(edict_t* player)
 	AngleVectors(player->client->v_angle, forward, nullptr, nullptr);
 	vec3_t const& viewer_pos = player->s.origin;
 
+	const size_t client_index = player->client - game.clients;
+	if (hook_candidates.size() != game.maxclients)
+		hook_candidates.assign(game.maxclients, {});
+	if (client_index >= hook_candidates.size())
+		return nullptr;
+
+	hook_candidates_t& cache = hook_candidates[client_index];
+	if (cache.built > level.time || level.time - cache.built >= HookAutoTarget::REFRESH ||
+		(viewer_pos - cache.origin).lengthSquared() > HookAutoTarget::MAX_MOVE * HookAutoTarget::MAX_MOVE)
+		Hook_BuildCandidates(player, cache);
+
 	edict_t* best_entity = nullptr;
 	float best_score = -999999.0f;
 
-	// Check all active players (bots)
-	for (edict_t* target : active_players())
+	for (auto [target, spawn_count] : cache.entries)
 	{
-		if (!Hook_CanChainEntity(target, player))
+		if (!target->inuse || target->spawn_count != spawn_count)
 			continue;
 
-		vec3_t dir = target->s.origin - viewer_pos;
+		vec3_t const dir = target->s.origin - viewer_pos;
 		float const dist_sq = dir.lengthSquared();
 
 		if (dist_sq > HookAutoTarget::MAX_DISTANCE_SQ)
 			continue;
 
-		dir.normalize();
-		float const dot = forward.dot(dir);
-
 		// Determine minimum dot product based on distance
 		float const min_dot = (dist_sq < HookAutoTarget::CLOSE_DISTANCE_SQ)
 			? HookAutoTarget::CLOSE_MIN_DOT
 			: HookAutoTarget::MIN_DOT;
 
-		if (dot < min_dot)
-			continue;
-
-		// Score: higher dot = better aim, lower distance = closer
-		float score = (dot * HookAutoTarget::SCORING_DOT_WEIGHT) - dist_sq;
-		if (score > best_score)
-		{
-			best_score = score;
-			best_entity = target;
-		}
-	}
-
-	// Check all active monsters (summoned ones)
-	for (edict_t* target : active_monsters())
-	{
-		if (!Hook_CanChainEntity(target, player))
-			continue;
-
-		vec3_t dir = target->s.origin - viewer_pos;
-		float const dist_sq = dir.lengthSquared();
-
-		if (dist_sq > HookAutoTarget::MAX_DISTANCE_SQ)
-			continue;
-
-		dir.normalize();
-		float const dot = forward.dot(dir);
-
-		float const min_dot = (dist_sq < HookAutoTarget::CLOSE_DISTANCE_SQ)
-			? HookAutoTarget::CLOSE_MIN_DOT
-			: HookAutoTarget::MIN_DOT;
-
-		if (dot < min_dot)
+		// inside the cone without normalizing: along >= min_dot * |dir|
+		float const along = forward.dot(dir);
+		if (along <= 0 || along * along < min_dot * min_dot * dist_sq)
 			continue;
 
-		float score = (dot * HookAutoTarget::SCORING_DOT_WEIGHT) - dist_sq;
-		if (score > best_score)
-		{
-			best_score = score;
-			best_entity = target;
-		}
-	}
-
-	// Check special entities (sentrygun)
-	for (edict_t* target : g_targetable_special_entities)
-	{
+		// ownership may have changed since the set was built
 		if (!Hook_CanChainEntity(target, player))
 			continue;
 
-		vec3_t dir = target->s.origin - viewer_pos;
-		float const dist_sq = dir.lengthSquared();
-
-		if (dist_sq > HookAutoTarget::MAX_DISTANCE_SQ)
-			continue;
-
-		dir.normalize();
-		float const dot = forward.dot(dir);
-
-		float const min_dot = (dist_sq < HookAutoTarget::CLOSE_DISTANCE_SQ)
-			? HookAutoTarget::CLOSE_MIN_DOT
-			: HookAutoTarget::MIN_DOT;
-
-		if (dot < min_dot)
-			continue;
-
+		// Score: higher dot = better aim, lower distance = closer
+		float const dot = along / sqrtf(dist_sq);
 		float score = (dot * HookAutoTarget::SCORING_DOT_WEIGHT) - dist_sq;
 		if (score > best_score)
 		{
@@ -229,6 +251,13 @@ edict_t* Hook_FindChainableInView(edict_t* player)
 	return nullptr;
 }
 
+// The candidate sets hold edict pointers; drop them whenever g_edicts is
+// cleared or reallocated (map change, savegame load)
+void Hook_ResetCandidates()
+{
+	hook_candidates.clear();
+}
+
 void Hook_InitGame(void)
 {
 	// Initialize cvars from g_config values (loaded from JSON)
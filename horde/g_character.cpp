@@ -1,9 +1,11 @@
 #include "g_character.h"
 #include "../g_local.h"
 
+#include "g_metrics.h"
 #include "sqlite3.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <filesystem>
@@ -545,6 +547,7 @@ bool Character_Save(edict_t* player)
     if (IsBotCharacter(player) || !EnsureCharacterDatabase())
         return false;
 
+    const auto start = std::chrono::steady_clock::now();
     const std::string name = GetCharacterKey(player);
     ExecSql("BEGIN IMMEDIATE TRANSACTION;");
 
@@ -671,6 +674,7 @@ bool Character_Save(edict_t* player)
 #undef SAVE_SKILL
 
     ExecSql(ok ? "COMMIT;" : "ROLLBACK;");
+    Metrics::CharacterSaved(ok, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
     return ok;
 }
 
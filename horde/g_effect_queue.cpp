@@ -0,0 +1,289 @@
+#include "g_effect_queue.h"
+#include <cstring>
+#include <vector>
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/unordered/unordered_flat_set.hpp>
+
+namespace EffectQueue {
+
+namespace {
+
+    constexpr int AREA_SHIFT = 9;   // 512 unit areas for the budget
+
+    // one recorded Write* call; the payload follows in s_payload
+    enum op_t : uint8_t {
+        OP_CHAR, OP_BYTE, OP_SHORT, OP_LONG, OP_FLOAT, OP_STRING,
+        OP_POSITION, OP_DIR, OP_ANGLE, OP_ENTITY
+    };
+
+    struct effect_t {
+        uint32_t    offset, length;     // into s_payload
+        uint64_t    hash;               // of the payload
+        vec3_t      origin;
+        multicast_t to;
+        bool        reliable;
+        bool        priority;
+        uint8_t     type;               // temp_event_t
+    };
+
+    // the game's original imports
+    game_import_t s_engine;
+
+    std::vector<uint8_t> s_payload;
+    std::vector<effect_t> s_effects;
+
+    bool s_collecting = false;      // inside the frame, recording
+    bool s_in_message = false;      // a message is being written (to the engine or to us)
+    bool s_recording = false;       // ...and it's a temp entity we're holding on to
+    uint32_t s_record_start = 0;
+    int32_t s_priority_depth = 0;
+
+    // stats
+    uint64_t s_frames = 0, s_queued = 0, s_sent = 0, s_merged = 0, s_dropped = 0;
+    uint32_t s_peak = 0;
+
+    // effects that are a quick puff at one spot; many of them at once in one
+    // place read as one, so past the budget they can go
+    bool IsBudgeted(uint8_t type) {
+        switch (type) {
+            case TE_GUNSHOT: case TE_BLOOD: case TE_BLASTER: case TE_SHOTGUN:
+            case TE_EXPLOSION1: case TE_EXPLOSION2: case TE_ROCKET_EXPLOSION: case TE_GRENADE_EXPLOSION:
+            case TE_SPARKS: case TE_SPLASH: case TE_SCREEN_SPARKS: case TE_SHIELD_SPARKS:
+            case TE_BULLET_SPARKS: case TE_LASER_SPARKS: case TE_ROCKET_EXPLOSION_WATER:
+            case TE_GRENADE_EXPLOSION_WATER: case TE_BFG_EXPLOSION: case TE_WELDING_SPARKS:
+            case TE_GREENBLOOD: case TE_PLASMA_EXPLOSION: case TE_TUNNEL_SPARKS: case TE_BLASTER2:
+            case TE_LIGHTNING: case TE_PLAIN_EXPLOSION: case TE_MOREBLOOD: case TE_HEATBEAM_SPARKS:
+            case TE_CHAINFIST_SMOKE: case TE_ELECTRIC_SPARKS: case TE_TRACKER_EXPLOSION:
+            case TE_TELEPORT_EFFECT: case TE_EXPLOSION1_BIG: case TE_EXPLOSION1_NP: case TE_FLECHETTE:
+            case TE_BLUEHYPERBLASTER: case TE_BERSERK_SLAM: case TE_EXPLOSION1_NL: case TE_EXPLOSION2_NL:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    template<typename T>
+    inline void Put(const T& value) {
+        const size_t at = s_payload.size();
+        s_payload.resize(at + sizeof(T));
+        memcpy(s_payload.data() + at, &value, sizeof(T));
+    }
+
+    template<typename T>
+    inline T Get(const uint8_t*& data) {
+        T value;
+        memcpy(&value, data, sizeof(T));
+        data += sizeof(T);
+        return value;
+    }
+
+    // Send a recorded message's Write* calls to the engine
+    void Replay(uint32_t offset, uint32_t length) {
+        const uint8_t* data = s_payload.data() + offset;
+        const uint8_t* const end = data + length;
+
+        while (data < end) {
+            switch (Get<op_t>(data)) {
+                case OP_CHAR:     s_engine.WriteChar(Get<int32_t>(data)); break;
+                case OP_BYTE:     s_engine.WriteByte(Get<int32_t>(data)); break;
+                case OP_SHORT:    s_engine.WriteShort(Get<int32_t>(data)); break;
+                case OP_LONG:     s_engine.WriteLong(Get<int32_t>(data)); break;
+                case OP_FLOAT:    s_engine.WriteFloat(Get<float>(data)); break;
+                case OP_POSITION: s_engine.WritePosition(Get<vec3_t>(data)); break;
+                case OP_DIR:      s_engine.WriteDir(Get<vec3_t>(data)); break;
+                case OP_ANGLE:    s_engine.WriteAngle(Get<float>(data)); break;
+                case OP_ENTITY:   s_engine.WriteEntity(&g_edicts[Get<uint16_t>(data)]); break;
+                case OP_STRING: {
+                    const char* str = reinterpret_cast<const char*>(data);
+                    s_engine.WriteString(str);
+                    data += strlen(str) + 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Stop holding the current message: hand what was recorded to the engine
+    void StopRecording() {
+        Replay(s_record_start, static_cast<uint32_t>(s_payload.size()) - s_record_start);
+        s_payload.resize(s_record_start);
+        s_recording = false;
+    }
+
+    // Called by every Write*; false = not recording, pass the call to the engine
+    inline bool Record(op_t op) {
+        if (!s_recording) {
+            s_in_message = true;
+            return false;
+        }
+
+        Put(op);
+        return true;
+    }
+
+    void HookWriteChar(int c) { if (Record(OP_CHAR)) Put<int32_t>(c); else s_engine.WriteChar(c); }
+    void HookWriteShort(int c) { if (Record(OP_SHORT)) Put<int32_t>(c); else s_engine.WriteShort(c); }
+    void HookWriteLong(int c) { if (Record(OP_LONG)) Put<int32_t>(c); else s_engine.WriteLong(c); }
+    void HookWriteFloat(float f) { if (Record(OP_FLOAT)) Put(f); else s_engine.WriteFloat(f); }
+    void HookWritePosition(gvec3_cref_t pos) { if (Record(OP_POSITION)) Put<vec3_t>(pos); else s_engine.WritePosition(pos); }
+    void HookWriteDir(gvec3_cref_t dir) { if (Record(OP_DIR)) Put<vec3_t>(dir); else s_engine.WriteDir(dir); }
+    void HookWriteAngle(float f) { if (Record(OP_ANGLE)) Put(f); else s_engine.WriteAngle(f); }
+
+    void HookWriteByte(int c) {
+        // a new message starting with svc_temp_entity while collecting: hold on to it
+        if (!s_in_message && s_collecting && c == svc_temp_entity) {
+            s_in_message = s_recording = true;
+            s_record_start = static_cast<uint32_t>(s_payload.size());
+        }
+
+        if (Record(OP_BYTE))
+            Put<int32_t>(c);
+        else
+            s_engine.WriteByte(c);
+    }
+
+    void HookWriteString(const char* s) {
+        if (Record(OP_STRING))
+            s_payload.insert(s_payload.end(), s, s + strlen(s) + 1);
+        else
+            s_engine.WriteString(s);
+    }
+
+    void HookWriteEntity(const edict_t* e) {
+        const ptrdiff_t index = e - g_edicts;
+
+        // not one of ours; can't be recorded as a number
+        if (s_recording && (index < 0 || index >= static_cast<ptrdiff_t>(globals.max_edicts)))
+            StopRecording();
+
+        if (Record(OP_ENTITY))
+            Put(static_cast<uint16_t>(index));
+        else
+            s_engine.WriteEntity(e);
+    }
+
+    void HookMulticast(gvec3_cref_t origin, multicast_t to, bool reliable) {
+        s_in_message = false;
+
+        if (!s_recording) {
+            s_engine.multicast(origin, to, reliable);
+            return;
+        }
+
+        s_recording = false;
+
+        const uint32_t length = static_cast<uint32_t>(s_payload.size()) - s_record_start;
+
+        // fnv-1a over the recorded calls
+        uint64_t hash = 14695981039346656037ull;
+        for (uint32_t i = s_record_start; i < s_payload.size(); i++)
+            hash = (hash ^ s_payload[i]) * 1099511628211ull;
+
+        // op, then the svc_temp_entity byte, then op and the type byte
+        uint8_t type = 0xFF;
+        if (length >= 2 * (sizeof(op_t) + sizeof(int32_t)))
+            type = static_cast<uint8_t>(s_payload[s_record_start + 2 * sizeof(op_t) + sizeof(int32_t)]);
+
+        s_effects.push_back({ s_record_start, length, hash, origin, to, reliable, reliable || s_priority_depth > 0, type });
+        s_queued++;
+    }
+
+    void HookUnicast(edict_t* ent, bool reliable, uint32_t dupe_key) {
+        s_in_message = false;
+
+        // per-client; nothing to batch
+        if (s_recording)
+            StopRecording();
+
+        s_engine.unicast(ent, reliable, dupe_key);
+    }
+
+    inline uint64_t AreaKey(const effect_t& effect) {
+        const auto axis = [](float v) { return static_cast<uint64_t>(static_cast<int32_t>(v) >> AREA_SHIFT) & 0xFFFFF; };
+        return (axis(effect.origin.x) << 42) | (axis(effect.origin.y) << 22) | (axis(effect.origin.z) << 2) | effect.to;
+    }
+
+} // namespace
+
+void HookImports() {
+    s_engine = gi;
+
+    gi.WriteChar = HookWriteChar;
+    gi.WriteByte = HookWriteByte;
+    gi.WriteShort = HookWriteShort;
+    gi.WriteLong = HookWriteLong;
+    gi.WriteFloat = HookWriteFloat;
+    gi.WriteString = HookWriteString;
+    gi.WritePosition = HookWritePosition;
+    gi.WriteDir = HookWriteDir;
+    gi.WriteAngle = HookWriteAngle;
+    gi.WriteEntity = HookWriteEntity;
+    gi.multicast = HookMulticast;
+    gi.game_import_t::unicast = HookUnicast;
+}
+
+void BeginFrame() {
+    s_collecting = g_te_budget->integer > 0;
+}
+
+void Flush() {
+    s_collecting = false;
+
+    if (s_recording)
+        StopRecording();
+
+    s_frames++;
+
+    if (s_effects.empty())
+        return;
+
+    s_peak = std::max(s_peak, static_cast<uint32_t>(s_effects.size()));
+
+    static boost::unordered_flat_set<uint64_t> sent;
+    static boost::unordered_flat_map<uint64_t, int32_t> area_counts;
+    sent.clear();
+    area_counts.clear();
+
+    const int32_t budget = std::max(g_te_budget->integer, 1);
+
+    for (const effect_t& effect : s_effects) {
+        const uint64_t area = AreaKey(effect);
+
+        if (!sent.insert(effect.hash ^ (area * 0x9E3779B97F4A7C15ull)).second) {
+            s_merged++;
+            continue;
+        }
+
+        if (!effect.priority && IsBudgeted(effect.type) && ++area_counts[area] > budget) {
+            s_dropped++;
+            continue;
+        }
+
+        Replay(effect.offset, effect.length);
+        s_engine.multicast(effect.origin, effect.to, effect.reliable);
+        s_sent++;
+    }
+
+    s_effects.clear();
+    s_payload.clear();
+}
+
+PriorityScope::PriorityScope() {
+    s_priority_depth++;
+}
+
+PriorityScope::~PriorityScope() {
+    s_priority_depth--;
+}
+
+void PrintStats() {
+    const double frames = static_cast<double>(std::max<uint64_t>(s_frames, 1));
+
+    gi.Com_PrintFmt("=== Effect Queue ({}) ===\n", g_te_budget->integer > 0 ? "on" : "off, g_te_budget 0");
+    gi.Com_PrintFmt("budget: {} per area per frame\n", g_te_budget->integer);
+    gi.Com_PrintFmt("{} frames: {} queued, {} sent, {} merged, {} dropped\n", s_frames, s_queued, s_sent, s_merged, s_dropped);
+    gi.Com_PrintFmt("per frame: {:.2f} queued, {:.2f} sent; peak {} queued in one frame\n",
+        s_queued / frames, s_sent / frames, s_peak);
+}
+
+} // namespace EffectQueue
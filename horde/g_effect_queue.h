@@ -0,0 +1,43 @@
+#pragma once
+
+#include "../g_local.h"
+
+// ============================================================================
+// Effect Queue - per-frame temp entity coalescing
+// ============================================================================
+// Chain explosions, tesla arcs and shotgun impacts can put dozens of nearly
+// identical temp entities into the same spot in a single frame. While the
+// frame runs, every svc_temp_entity message that ends in gi.multicast is
+// recorded instead of sent (the Write* and multicast imports are hooked, so
+// none of the call sites change), then Flush sends them in one pass:
+//   - exact duplicates (same payload, origin and multicast) go out once
+//   - impact/explosion style effects past g_te_budget in one 512 unit area
+//     are dropped
+//   - reliable messages, and anything written inside a PriorityScope (boss
+//     death explosions), are never dropped
+// Messages written outside the frame (client commands) and unicast ones are
+// sent right away. g_te_budget 0 turns the queue off.
+
+namespace EffectQueue {
+
+    // Install the message hooks into gi (GetGameAPI)
+    void HookImports();
+
+    // Start recording this frame's temp entities
+    void BeginFrame();
+
+    // Send what was recorded, and stop recording
+    void Flush();
+
+    // Effects written while one of these is alive are never dropped
+    struct PriorityScope {
+        PriorityScope();
+        ~PriorityScope();
+        PriorityScope(const PriorityScope&) = delete;
+        PriorityScope& operator=(const PriorityScope&) = delete;
+    };
+
+    // sv testats
+    void PrintStats();
+
+} // namespace EffectQueue
@@ -0,0 +1,185 @@
+#include "g_gib_pool.h"
+#include <vector>
+
+namespace GibPool {
+
+namespace {
+
+    struct entry_t {
+        uint32_t index;
+        int32_t  spawn_count;   // stale once the slot has been freed
+        int64_t  born_ms;
+    };
+
+    std::array<uint8_t, MAX_EDICTS> s_kinds{};  // Kind bits each edict is tracked under
+
+    // gibs oldest first from s_gib_head; projectiles in no particular order
+    std::vector<entry_t> s_gibs;
+    size_t s_gib_head = 0;
+    std::vector<entry_t> s_projectiles;
+
+    uint32_t s_live_gibs = 0, s_live_projectiles = 0;
+
+    std::vector<edict_t*> s_results;
+
+    // stats
+    uint64_t s_spawned = 0, s_recycled = 0, s_over_limit = 0;
+    uint32_t s_peak_gibs = 0;
+
+    inline bool Trackable(const edict_t* ent) {
+        const ptrdiff_t index = ent - g_edicts;
+        return index > static_cast<ptrdiff_t>(game.maxclients + BODY_QUEUE_SIZE) && index < static_cast<ptrdiff_t>(MAX_EDICTS);
+    }
+
+    inline bool Stale(const entry_t& entry, Kind kind) {
+        return !(s_kinds[entry.index] & kind) || g_edicts[entry.index].spawn_count != entry.spawn_count;
+    }
+
+    // Drop stale entries off the front, and the dead space once it's half the list
+    void TrimGibs() {
+        while (s_gib_head < s_gibs.size() && Stale(s_gibs[s_gib_head], KIND_GIB))
+            s_gib_head++;
+
+        if (s_gib_head > 32 && s_gib_head * 2 > s_gibs.size()) {
+            s_gibs.erase(s_gibs.begin(), s_gibs.begin() + s_gib_head);
+            s_gib_head = 0;
+        }
+    }
+
+    // Stale entries in the middle of the lists pile up as gibs free themselves
+    template<typename T>
+    void CompactIfBloated(std::vector<entry_t>& entries, size_t first, uint32_t live, Kind kind, T&& on_compact) {
+        if (entries.size() - first < 2 * static_cast<size_t>(live) + 64)
+            return;
+
+        std::erase_if(entries, [kind](const entry_t& entry) { return Stale(entry, kind); });
+        on_compact();
+    }
+
+} // namespace
+
+edict_t* Spawn() {
+    const int32_t limit = g_gib_limit->integer;
+
+    s_spawned++;
+
+    if (limit > 0 && s_live_gibs >= static_cast<uint32_t>(limit)) {
+        TrimGibs();
+
+        if (s_gib_head < s_gibs.size() && s_gibs[s_gib_head].born_ms < level.time.milliseconds()) {
+            edict_t* oldest = &g_edicts[s_gibs[s_gib_head++].index];
+
+            G_FreeEdict(oldest);
+            G_InitEdict(oldest);
+            // a different gib now; don't let clients lerp it from the old one
+            oldest->s.event = EV_OTHER_TELEPORT;
+
+            s_recycled++;
+            return oldest;
+        }
+
+        // everything in the pool was thrown this frame
+        s_over_limit++;
+    }
+
+    return G_Spawn();
+}
+
+void Add(edict_t* ent, Kind kind) {
+    if (!ent || !ent->inuse || !Trackable(ent))
+        return;
+
+    const uint32_t index = ent - g_edicts;
+
+    if (s_kinds[index] & kind)
+        return;
+
+    s_kinds[index] |= kind;
+
+    const entry_t entry{ index, ent->spawn_count, level.time.milliseconds() };
+
+    if (kind == KIND_GIB) {
+        s_gibs.push_back(entry);
+        s_peak_gibs = std::max(s_peak_gibs, ++s_live_gibs);
+        CompactIfBloated(s_gibs, s_gib_head, s_live_gibs, KIND_GIB, [] { s_gib_head = 0; });
+    }
+    else {
+        s_projectiles.push_back(entry);
+        s_live_projectiles++;
+        CompactIfBloated(s_projectiles, 0, s_live_projectiles, KIND_PROJECTILE, [] {});
+    }
+}
+
+void Remove(edict_t* ent) {
+    if (!ent || !Trackable(ent))
+        return;
+
+    uint8_t& kinds = s_kinds[ent - g_edicts];
+
+    if (kinds & KIND_GIB)
+        s_live_gibs--;
+    if (kinds & KIND_PROJECTILE)
+        s_live_projectiles--;
+
+    kinds = 0;
+}
+
+void Clear() {
+    s_kinds.fill(0);
+    s_gibs.clear();
+    s_gib_head = 0;
+    s_projectiles.clear();
+    s_live_gibs = s_live_projectiles = 0;
+}
+
+void Rebuild() {
+    Clear();
+
+    for (uint32_t i = game.maxclients + BODY_QUEUE_SIZE + 1; i < globals.num_edicts; i++) {
+        edict_t* ent = &g_edicts[i];
+
+        if (!ent->inuse || !ent->classname)
+            continue;
+
+        if (!strcmp(ent->classname, "gib"))
+            Add(ent, KIND_GIB);
+        else if (!strcmp(ent->classname, "grenade") || !strcmp(ent->classname, "rocket"))
+            Add(ent, KIND_PROJECTILE);
+    }
+
+    // age isn't saved; all of them may be recycled right away
+    for (entry_t& entry : s_gibs)
+        entry.born_ms = 0;
+}
+
+std::span<edict_t* const> Tracked(uint8_t kinds) {
+    s_results.clear();
+
+    if (kinds & KIND_GIB) {
+        TrimGibs();
+
+        for (size_t i = s_gib_head; i < s_gibs.size(); i++)
+            if (!Stale(s_gibs[i], KIND_GIB))
+                s_results.push_back(&g_edicts[s_gibs[i].index]);
+    }
+
+    if (kinds & KIND_PROJECTILE) {
+        std::erase_if(s_projectiles, [](const entry_t& entry) { return Stale(entry, KIND_PROJECTILE); });
+
+        for (const entry_t& entry : s_projectiles)
+            s_results.push_back(&g_edicts[entry.index]);
+    }
+
+    return s_results;
+}
+
+void PrintStats() {
+    gi.Com_PrintFmt("=== Gib Pool ===\n");
+    gi.Com_PrintFmt("limit: {}\n", g_gib_limit->integer > 0 ? std::to_string(g_gib_limit->integer) : "off, g_gib_limit 0");
+    gi.Com_PrintFmt("tracked: {} gibs (peak {}), {} grenades/rockets\n", s_live_gibs, s_peak_gibs, s_live_projectiles);
+    gi.Com_PrintFmt("gibs thrown: {}, {} of them on a recycled edict, {} past the limit (pool all thrown this frame)\n",
+        s_spawned, s_recycled, s_over_limit);
+    gi.Com_PrintFmt("list entries: {} gibs, {} projectiles\n", s_gibs.size() - s_gib_head, s_projectiles.size());
+}
+
+} // namespace GibPool
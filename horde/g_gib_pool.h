@@ -0,0 +1,52 @@
+#pragma once
+
+#include "../g_local.h"
+#include <span>
+
+// ============================================================================
+// Gib Pool - capped, recycled gib and debris edicts
+// ============================================================================
+// A wave of mass kills used to throw a fresh edict per gib, spiking the edict
+// count, and Horde_CleanBodies then had to strcmp its way through every edict
+// to find the gibs and stray projectiles to fade. The pool keeps those in
+// their own lists instead:
+//   gibs        - everything ThrowGib makes (gibs, debris, monster heads),
+//                 oldest first; once g_gib_limit are alive, the oldest one's
+//                 edict is freed and handed straight to the new gib
+//   projectiles - grenades and rockets, so cleanup can find the stuck ones
+// The engine owns the edict array, so the "pool" is the set of edicts already
+// in use by gibs: past the cap the count stops growing rather than every gib
+// taking a new slot. Gibs thrown this frame are never recycled (their thrower
+// may still be using them), and edicts in the client/body queue range are
+// never tracked. g_gib_limit 0 turns the cap off; the lists are kept either way.
+
+namespace GibPool {
+
+    enum Kind : uint8_t {
+        KIND_GIB        = 1 << 0,
+        KIND_PROJECTILE = 1 << 1
+    };
+
+    // An edict for a new gib: the oldest gib's if the pool is full, otherwise G_Spawn()
+    edict_t* Spawn();
+
+    // Track `ent` under `kind`; call once it's set up
+    void Add(edict_t* ent, Kind kind);
+
+    // Stop tracking `ent` (OnEntityRemoved)
+    void Remove(edict_t* ent);
+
+    // Empty the pool (map change)
+    void Clear();
+
+    // Clear, then track the gibs, grenades and rockets in the current edicts (savegame load)
+    void Rebuild();
+
+    // Tracked entities of any of `kinds`, oldest first. The span points into a
+    // buffer reused by the next call.
+    std::span<edict_t* const> Tracked(uint8_t kinds);
+
+    // sv gibstats
+    void PrintStats();
+
+} // namespace GibPool
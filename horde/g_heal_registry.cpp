@@ -0,0 +1,232 @@
+#include "g_heal_registry.h"
+#include <algorithm>
+#include <vector>
+#include <boost/unordered/unordered_flat_map.hpp>
+
+namespace HealRegistry {
+
+namespace {
+
+    constexpr int CELL_SHIFT = 8;        // 256 unit cells; a medic's search spans a handful
+    constexpr int COORD_BIAS = 32768;    // keep shifted coordinates non-negative in normal map bounds
+    constexpr uint8_t ALL_KINDS = KIND_CORPSE | KIND_INJURED | KIND_REPAIR;
+
+    // Membership: which kinds each edict is registered under, and where it sits in s_entries
+    std::array<uint8_t, MAX_EDICTS> s_kinds{};
+    std::array<uint16_t, MAX_EDICTS> s_slot{};   // index into s_entries + 1; 0 = not registered
+    std::vector<edict_t*> s_entries;
+
+    // Spatial index over s_entries, rebuilt on the first query of a frame (or after
+    // membership changed): entries sorted by cell, and each cell's range in that order
+    std::vector<std::pair<uint32_t, edict_t*>> s_sorted;
+    boost::unordered::unordered_flat_map<uint32_t, std::pair<uint32_t, uint32_t>> s_cells;
+    int64_t s_index_time = -1;
+    bool s_index_dirty = true;
+
+    std::vector<edict_t*> s_results;
+
+    inline uint16_t ToCellCoord(float coord) {
+        const int shifted = static_cast<int>(coord) + COORD_BIAS;
+        return static_cast<uint16_t>((static_cast<uint32_t>(std::max(shifted, 0)) >> CELL_SHIFT) & 0xFFFFu);
+    }
+
+    inline uint32_t PackCellKey(uint16_t x, uint16_t y) {
+        return (static_cast<uint32_t>(x) << 16) | static_cast<uint32_t>(y);
+    }
+
+    // same center findradius measures from
+    inline vec3_t EntityCenter(const edict_t* ent) {
+        return ent->s.origin + (ent->mins + ent->maxs) * 0.5f;
+    }
+
+    inline bool IsBodyQue(const edict_t* ent) {
+        const ptrdiff_t index = ent - g_edicts;
+        return index > static_cast<ptrdiff_t>(game.maxclients) &&
+               index <= static_cast<ptrdiff_t>(game.maxclients + BODY_QUEUE_SIZE);
+    }
+
+    // Whether a registered entity still belongs under `kind`
+    bool StillQualifies(const edict_t* ent, Kind kind) {
+        if (!ent->inuse)
+            return false;
+
+        switch (kind) {
+            case KIND_CORPSE:
+                return ent->health <= 0 && ((ent->svflags & SVF_MONSTER) || IsBodyQue(ent));
+            case KIND_INJURED:
+                return (ent->svflags & SVF_MONSTER) && ent->health > 0 && ent->health < ent->max_health;
+            case KIND_REPAIR:
+                return true;
+        }
+
+        return false;
+    }
+
+    void RefreshIndex() {
+        const int64_t now = level.time.milliseconds();
+
+        if (!s_index_dirty && s_index_time == now)
+            return;
+
+        s_sorted.clear();
+        for (edict_t* ent : s_entries) {
+            const vec3_t center = EntityCenter(ent);
+            s_sorted.emplace_back(PackCellKey(ToCellCoord(center.x), ToCellCoord(center.y)), ent);
+        }
+
+        std::sort(s_sorted.begin(), s_sorted.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        s_cells.clear();
+        for (uint32_t begin = 0; begin < s_sorted.size(); ) {
+            uint32_t end = begin + 1;
+            while (end < s_sorted.size() && s_sorted[end].first == s_sorted[begin].first)
+                end++;
+            s_cells.emplace(s_sorted[begin].first, std::make_pair(begin, end));
+            begin = end;
+        }
+
+        s_index_time = now;
+        s_index_dirty = false;
+    }
+
+} // namespace
+
+void Add(edict_t* ent, Kind kind) {
+    if (!ent || !ent->inuse)
+        return;
+
+    const uint32_t number = ent->s.number;
+
+    if (!s_slot[number]) {
+        s_entries.push_back(ent);
+        s_slot[number] = static_cast<uint16_t>(s_entries.size());
+        s_index_dirty = true;
+    }
+
+    s_kinds[number] |= kind;
+}
+
+void NoteHealth(edict_t* ent) {
+    if (ent && !(s_kinds[ent->s.number] & KIND_INJURED) && StillQualifies(ent, KIND_INJURED))
+        Add(ent, KIND_INJURED);
+}
+
+void Remove(edict_t* ent, uint8_t kinds) {
+    if (!ent)
+        return;
+
+    const uint32_t number = ent->s.number;
+
+    if (!s_slot[number])
+        return;
+
+    s_kinds[number] &= ~kinds;
+
+    if (s_kinds[number])
+        return;
+
+    // swap-remove from the dense list
+    const uint16_t slot = s_slot[number] - 1;
+    edict_t* last = s_entries.back();
+    s_entries[slot] = last;
+    s_slot[last->s.number] = slot + 1;
+    s_entries.pop_back();
+    s_slot[number] = 0;
+    s_index_dirty = true;
+}
+
+void Clear() {
+    for (edict_t* ent : s_entries) {
+        s_kinds[ent->s.number] = 0;
+        s_slot[ent->s.number] = 0;
+    }
+
+    s_entries.clear();
+    s_sorted.clear();
+    s_cells.clear();
+    s_index_dirty = true;
+}
+
+void Rebuild() {
+    Clear();
+
+    for (uint32_t i = game.maxclients + 1; i < globals.num_edicts; i++) {
+        edict_t* ent = &g_edicts[i];
+
+        if (!ent->inuse)
+            continue;
+
+        if (IsBodyQue(ent)) {
+            if (ent->health <= 0 && ent->solid != SOLID_NOT)
+                Add(ent, KIND_CORPSE);
+        }
+        else if (ent->svflags & SVF_MONSTER) {
+            if (ent->health <= 0 && ent->think == monster_dead_think)
+                Add(ent, KIND_CORPSE);
+            else if (StillQualifies(ent, KIND_INJURED))
+                Add(ent, KIND_INJURED);
+        }
+        else if (ent->classname && !strcmp(ent->classname, "object_repair")) {
+            Add(ent, KIND_REPAIR);
+        }
+    }
+}
+
+std::span<edict_t* const> Query(const vec3_t& origin, float radius, uint8_t kinds) {
+    s_results.clear();
+
+    if (radius <= 0.0f || s_entries.empty())
+        return {};
+
+    RefreshIndex();
+
+    const float radius_sq = radius * radius;
+    const uint16_t min_x = ToCellCoord(origin.x - radius), max_x = ToCellCoord(origin.x + radius);
+    const uint16_t min_y = ToCellCoord(origin.y - radius), max_y = ToCellCoord(origin.y + radius);
+
+    for (uint32_t x = min_x; x <= max_x; x++) {
+        for (uint32_t y = min_y; y <= max_y; y++) {
+            const auto cell = s_cells.find(PackCellKey(static_cast<uint16_t>(x), static_cast<uint16_t>(y)));
+
+            if (cell == s_cells.end())
+                continue;
+
+            for (uint32_t i = cell->second.first; i < cell->second.second; i++) {
+                edict_t* ent = s_sorted[i].second;
+                const uint8_t wanted = s_kinds[ent->s.number] & kinds;
+
+                // removed since the index was built, or not of a kind we're after
+                if (!wanted)
+                    continue;
+
+                // prune entries that stopped qualifying behind our back
+                uint8_t stale = 0;
+                for (uint8_t kind = KIND_CORPSE; kind & ALL_KINDS; kind <<= 1) {
+                    if ((wanted & kind) && !StillQualifies(ent, static_cast<Kind>(kind)))
+                        stale |= kind;
+                }
+
+                if (stale) {
+                    Remove(ent, stale);
+                    if (!(wanted & ~stale))
+                        continue;
+                }
+
+                if (ent->solid == SOLID_NOT)
+                    continue;
+                if ((origin - EntityCenter(ent)).lengthSquared() > radius_sq)
+                    continue;
+
+                s_results.push_back(ent);
+            }
+        }
+    }
+
+    // edict order, same as findradius, so ties between candidates resolve the same way
+    std::sort(s_results.begin(), s_results.end());
+
+    return s_results;
+}
+
+} // namespace HealRegistry
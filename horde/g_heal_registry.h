@@ -0,0 +1,50 @@
+#pragma once
+
+#include "../g_local.h"
+#include <span>
+
+// ============================================================================
+// Heal Registry - entities medics and fixbots can work on
+// ============================================================================
+// Medics and fixbots used to walk findradius over every edict and strcmp
+// their way down to the few entities they care about. The registry keeps
+// those candidates in one place instead, updated as they come and go:
+//   corpses  - dead monsters once their death animation finished (monster_dead)
+//              and player bodies in the body queue; dropped on gib, revive and free
+//   injured  - living monsters below max health, noted when they take damage and
+//              after every frame they run, so health lost outside T_Damage or a
+//              spawn under a max_health buff registers them too
+//   repair   - func_object_repair entities fixbots weld
+// Entries that stopped qualifying without an explicit hook (healed back to
+// full, revived some other way) are pruned the next time a query sees them.
+// Players aren't tracked; there are few enough to check directly.
+
+namespace HealRegistry {
+
+    enum Kind : uint8_t {
+        KIND_CORPSE  = 1 << 0,
+        KIND_INJURED = 1 << 1,
+        KIND_REPAIR  = 1 << 2
+    };
+
+    // Register `ent` under `kind`; safe to call again for an entity already in it
+    void Add(edict_t* ent, Kind kind);
+
+    // Register `ent` as injured if it's a living monster below max health
+    void NoteHealth(edict_t* ent);
+
+    // Drop `ent` from the given kinds (all of them by default)
+    void Remove(edict_t* ent, uint8_t kinds = KIND_CORPSE | KIND_INJURED | KIND_REPAIR);
+
+    // Empty the registry (map change)
+    void Clear();
+
+    // Clear, then register everything in the current edicts that qualifies (savegame load)
+    void Rebuild();
+
+    // Registered entities of any of `kinds` whose center is within `radius` of origin,
+    // matching findradius (non-solid entities are skipped). The span points into a
+    // buffer reused by the next query.
+    std::span<edict_t* const> Query(const vec3_t& origin, float radius, uint8_t kinds);
+
+} // namespace HealRegistry
@@ -1,6 +1,8 @@
 // Includes y definiciones relevantes
 #include "../shared.h"
 #include "g_horde_phys.h"
+#include "g_gib_pool.h"
+#include "g_monster_table.h"
 #include "../g_local.h"
 #include "g_horde.h"
 #include <set>
@@ -616,6 +618,8 @@ struct PositionValidationResult {
 };
 
 [[nodiscard]] PositionValidationResult IsPositionPhysicallyValid(const vec3_t& position, const vec3_t& monster_mins, const vec3_t& monster_maxs, bool is_flying);
+[[nodiscard]] PositionValidationResult IsPositionGeometryValid(const vec3_t& position, const vec3_t& monster_mins, const vec3_t& monster_maxs, bool is_flying);
+[[nodiscard]] bool IsSpawnVolumeClear(const vec3_t& position, const vec3_t& monster_mins, const vec3_t& monster_maxs);
 bool CheckAndTeleportStuckMonster(edict_t* self, bool force_drowning);
 static void AnnounceIncomingWave(gtime_t duration = 3_sec);
 static edict_t* FindBestPlayerTargetForTeleport();
@@ -1028,6 +1032,7 @@ static void ResizeSpawnPointCaches(size_t spawn_count, const char* validation_co
 
 	g_spawn_system.spawn_points_data.resize(g_num_spawn_points);
 	spawn_point_cache.resize(g_num_spawn_points);
+	Horde_ResetSpawnPositionPool();
 	if (!safe_resize(g_spawn_system.spawn_validation_cache, g_num_spawn_points)) {
 		gi.Com_PrintFmt("ERROR: Failed to resize spawn validation cache{}\n", validation_context);
 	}
@@ -1831,6 +1836,7 @@ cvar_t* g_horde_grid_first;  // Test cvar: prioritize grid spawning
 cvar_t* g_horde_nav_spawn_check;  // 1 = reject ground spawns the navmesh can't reach (anti unreachable-spawn)
 cvar_t* g_horde_spawn_dist_cap;  // 1 = cap how far from players a spawn point may be (anti far/closed-wing spawn)
 cvar_t* g_horde_far_spawn_chance;  // 0..1 chance a normal-wave pick prefers the farthest spawn point (fog waves floor at 0.9)
+cvar_t* g_horde_spawn_pool_budget;  // spawn position pool entries validated ahead of time per frame; 0 = on demand only
 cvar_t* g_horde_precache_max_models;  // soft cap on registered CS_MODELS entries; 0 = no cap
 cvar_t* g_horde_precache_max_sounds;  // soft cap on registered CS_SOUNDS entries; 0 = no cap
 cvar_t* g_horde_precache_limits_enabled;  // 1 = enforce precache budget + family variety cap (default); 0 = uncapped
@@ -3472,7 +3478,24 @@ struct MonsterCache
 	}
 };
 
-static MonsterCache g_monster_picker_internal_cache;
+// Bumped whenever an input of the cached selection tables changes that isn't
+// part of their key: precache flags, the eligible list, the boss minion roster
+// or the PvM random list. See MonsterSelectionTable below.
+static uint32_t g_monster_selection_generation = 0;
+
+// Picker counters, reported by `sv pickstats`
+static struct {
+	uint64_t hits;          // served from a cached table
+	uint64_t misses;        // table (re)built for a new key or generation
+	uint64_t bypasses;      // elite precache attempts, always built uncached
+	uint64_t invalidations;
+} g_monster_selection_stats;
+
+void Horde_InvalidateMonsterSelection()
+{
+	g_monster_selection_generation++;
+	g_monster_selection_stats.invalidations++;
+}
 
 //-----------------------------------------------------
 // Determine if we should try to spawn a higher level monster
@@ -3686,6 +3709,7 @@ static void MarkMonsterTypePrecached(horde::MonsterTypeID typeId, const char* mo
 	g_precached_monster_types_flags[idx] = true;
 	g_precached_monsters_this_map.insert(typeId);
 	MarkFamilyPrecached(GetMonsterAssetFamily(typeId));
+	Horde_InvalidateMonsterSelection();
 
 	if (!model_path)
 		model_path = GetMonsterModelPath(typeId);
@@ -3982,6 +4006,7 @@ static AssetFamilyID PrecacheEliteMonster(
 		if (!already_eligible)
 		{
 			g_eligible_monsters_for_wave.push_back(&family_monster);
+			Horde_InvalidateMonsterSelection();
 			if (developer->integer > 1)
 				gi.Com_PrintFmt("Dynamic Precache: Added '{}' to eligible monsters (minWave {} is elite)\n",
 					horde::MonsterTypeRegistry::GetClassname(family_monster.typeId), family_monster.minWave);
@@ -4452,30 +4477,209 @@ static void BuildMonsterCache(MonsterCache& cache_ref, const MonsterSelectionCon
 }
 
 
-static horde::MonsterTypeID SelectFromCache(const MonsterCache& cache_ref)
+//-----------------------------------------------------
+// Cached selection tables
+//-----------------------------------------------------
+// Every monster in a spawn batch asks for a pick with (nearly) the same
+// context, and BuildMonsterCache only depends on that context, on which
+// families spawn history currently suppresses and on state covered by
+// g_monster_selection_generation. So the finished table is kept per key
+// and rebuilt only when one of those changes. Picks are O(1) through an
+// alias table (Vose) instead of a binary search over cumulative weights.
+static_assert(static_cast<size_t>(AssetFamilyID::MAX_FAMILIES) <= 64, "suppressed family mask is 64 bits");
+
+struct MonsterSelectionKey
+{
+	int32_t currentActualLevel;
+	int32_t effectiveLevel;
+	MonsterWaveType waveTypeForFiltering;
+	MonsterWaveType currentActualWaveType;
+	MonsterWaveType bossMinionTierFloor;
+	horde::MonsterTypeID bossMinionSource;
+	float flyingAdjustmentFactor;
+	uint64_t suppressedFamilies; // families over their spawn-history threshold
+	uint32_t generation;
+	uint8_t flags;
+
+	bool operator==(const MonsterSelectionKey&) const = default;
+};
+
+struct MonsterSelectionTable
 {
-	if (cache_ref.count == 0 || cache_ref.total_weight <= 0.0f)
-		return horde::MonsterTypeID::UNKNOWN;
+	MonsterSelectionKey key{};
+	bool valid = false;
+	MonsterCache cache;
+	std::array<float, MonsterCache::MONSTER_CACHE_SIZE> prob{};
+	std::array<uint8_t, MonsterCache::MONSTER_CACHE_SIZE> alias{};
 
-	const float random_value = frandom() * cache_ref.total_weight;
+	// Vose's alias method: splits the weights into `count` equal columns, each
+	// holding at most two entries (itself and its alias)
+	void BuildAlias()
+	{
+		const size_t n = cache.count;
+		if (!n || cache.total_weight <= 0.0f)
+			return;
 
-	// Use std::lower_bound to find the first entry whose cumulative_weight is not less than random_value.
-	auto it = std::lower_bound(
-		cache_ref.entries.begin(),
-		cache_ref.entries.begin() + cache_ref.count, // Search only the valid range
-		random_value,
-		[](const MonsterCache::Entry& entry, float value)
+		std::array<float, MonsterCache::MONSTER_CACHE_SIZE> scaled;
+		std::array<uint8_t, MonsterCache::MONSTER_CACHE_SIZE> small, large;
+		size_t num_small = 0, num_large = 0;
+
+		const float scale = static_cast<float>(n) / cache.total_weight;
+		for (size_t i = 0; i < n; i++)
 		{
-			return entry.cumulative_weight < value;
-		});
+			scaled[i] = cache.entries[i].weight * scale;
+			if (scaled[i] < 1.0f)
+				small[num_small++] = static_cast<uint8_t>(i);
+			else
+				large[num_large++] = static_cast<uint8_t>(i);
+		}
 
-	// Robustness check: if lower_bound returns the end iterator, fall back to the last valid element.
-	if (it == cache_ref.entries.begin() + cache_ref.count)
+		while (num_small && num_large)
+		{
+			const uint8_t s = small[--num_small];
+			const uint8_t l = large[--num_large];
+
+			prob[s] = scaled[s];
+			alias[s] = l;
+
+			scaled[l] = (scaled[l] + scaled[s]) - 1.0f;
+			if (scaled[l] < 1.0f)
+				small[num_small++] = l;
+			else
+				large[num_large++] = l;
+		}
+
+		// leftovers are 1 up to float error
+		while (num_large)
+		{
+			const uint8_t l = large[--num_large];
+			prob[l] = 1.0f;
+			alias[l] = l;
+		}
+		while (num_small)
+		{
+			const uint8_t s = small[--num_small];
+			prob[s] = 1.0f;
+			alias[s] = s;
+		}
+	}
+
+	// one draw: the integer part picks the column, the fraction flips its coin
+	horde::MonsterTypeID Sample() const
 	{
-		it = std::prev(it);
+		const size_t n = cache.count;
+		if (!n || cache.total_weight <= 0.0f)
+			return horde::MonsterTypeID::UNKNOWN;
+
+		const float u = frandom() * static_cast<float>(n);
+		const size_t column = std::min(static_cast<size_t>(u), n - 1);
+		const float coin = u - static_cast<float>(column);
+
+		return cache.entries[coin < prob[column] ? column : alias[column]].typeId;
+	}
+};
+static_assert(MonsterCache::MONSTER_CACHE_SIZE <= 256, "alias indices are 8 bits");
+
+// a handful of keys are live at once: flying/ground points, retaliation and
+// recovery toggling, elite vs normal effective level
+constexpr size_t MONSTER_SELECTION_TABLE_COUNT = 8;
+static std::array<MonsterSelectionTable, MONSTER_SELECTION_TABLE_COUNT> g_monster_selection_tables;
+static size_t g_monster_selection_next_table = 0;
+// elite precache attempts mutate the inputs while building; never cached
+static MonsterSelectionTable g_monster_selection_uncached;
+
+// Families GetFamilySpawnCountInHistory would currently penalize in
+// ApplyMonsterWeightModifiers, as a bit per family
+static uint64_t GetSuppressedFamilyMask()
+{
+	std::array<uint8_t, static_cast<size_t>(AssetFamilyID::MAX_FAMILIES)> counts{};
+	uint64_t mask = 0;
+
+	for (const auto& entry : g_spawn_history)
+	{
+		const size_t family = static_cast<size_t>(entry.family_id);
+		if (family >= counts.size())
+			continue;
+		if (++counts[family] >= 1 + GetFamilyMemberCount(entry.family_id))
+			mask |= 1ull << family;
 	}
+	return mask;
+}
 
-	return it->typeId;
+static MonsterSelectionKey MakeMonsterSelectionKey(const MonsterSelectionContext& ctx)
+{
+	MonsterSelectionKey key{};
+	key.currentActualLevel = ctx.currentActualLevel;
+	key.effectiveLevel = ctx.effectiveLevel;
+	key.waveTypeForFiltering = ctx.waveTypeForFiltering;
+	key.currentActualWaveType = ctx.currentActualWaveType;
+	key.bossMinionTierFloor = ctx.bossMinionTierFloor;
+	key.bossMinionSource = current_boss_minion_source;
+	key.flyingAdjustmentFactor = ctx.flyingAdjustmentFactor;
+	key.suppressedFamilies = GetSuppressedFamilyMask();
+	key.generation = g_monster_selection_generation;
+	key.flags = (ctx.isSpawnPointFlying ? 1 : 0) |
+		(ctx.isRetaliationActive ? 2 : 0) |
+		(ctx.isRecoveryModeActive ? 4 : 0) |
+		(ctx.isBossWaveMinionPhase ? 8 : 0) |
+		((g_insane->integer || g_chaotic->integer) ? 16 : 0);
+	return key;
+}
+
+static const MonsterSelectionTable& GetMonsterSelectionTable(const MonsterSelectionContext& ctx)
+{
+	// same condition BuildMonsterCache uses to try a dynamic elite precache
+	if (ctx.effectiveLevel > ctx.currentActualLevel && g_dynamic_precache_count_this_wave < 1)
+	{
+		g_monster_selection_stats.bypasses++;
+		BuildMonsterCache(g_monster_selection_uncached.cache, ctx);
+		g_monster_selection_uncached.BuildAlias();
+		return g_monster_selection_uncached;
+	}
+
+	const MonsterSelectionKey key = MakeMonsterSelectionKey(ctx);
+
+	for (const MonsterSelectionTable& table : g_monster_selection_tables)
+	{
+		if (table.valid && table.key == key)
+		{
+			g_monster_selection_stats.hits++;
+			return table;
+		}
+	}
+
+	g_monster_selection_stats.misses++;
+
+	MonsterSelectionTable& table = g_monster_selection_tables[g_monster_selection_next_table];
+	g_monster_selection_next_table = (g_monster_selection_next_table + 1) % MONSTER_SELECTION_TABLE_COUNT;
+
+	BuildMonsterCache(table.cache, ctx);
+	table.BuildAlias();
+	table.key = key;
+	table.valid = true;
+	return table;
+}
+
+void Horde_PrintMonsterSelectionStats()
+{
+	const auto& stats = g_monster_selection_stats;
+	const uint64_t lookups = stats.hits + stats.misses;
+
+	gi.Com_PrintFmt("Monster picker: {} hits, {} misses ({:.1f}% hit), {} elite bypasses, {} invalidations\n",
+		stats.hits, stats.misses, lookups ? 100.0 * stats.hits / lookups : 0.0,
+		stats.bypasses, stats.invalidations);
+
+	for (size_t i = 0; i < MONSTER_SELECTION_TABLE_COUNT; i++)
+	{
+		const MonsterSelectionTable& table = g_monster_selection_tables[i];
+		if (!table.valid)
+			continue;
+
+		gi.Com_PrintFmt("  [{}] wave {} (eff {}), type {:#x}, flags {:#x}, {} monsters{}\n",
+			i, table.key.currentActualLevel, table.key.effectiveLevel,
+			static_cast<uint64_t>(table.key.waveTypeForFiltering), table.key.flags, table.cache.count,
+			table.key.generation == g_monster_selection_generation ? "" : " (stale)");
+	}
 }
 
 static horde::MonsterTypeID EmergencyFallbackSelection(const MonsterSelectionContext& ctx)
@@ -4637,8 +4841,9 @@ horde::MonsterTypeID G_HordePickMonsterType(
 		ctx.bossMinionTierFloor = ComputeBossMinionTierFloor(ctx.effectiveLevel, ctx.isSpawnPointFlying, allowHeavyFloor);
 	}
 
-	// --- 3. Build cache (also precaches + records this wave's elite pick when attempting one) ---
-	BuildMonsterCache(g_monster_picker_internal_cache, ctx);
+	// --- 3. Build or reuse the selection table (also precaches + records this wave's elite pick
+	// when attempting one) ---
+	const MonsterSelectionTable& table = GetMonsterSelectionTable(ctx);
 
 	// If an elite was precached for this wave and it suits this spawn point, spawn THAT exact
 	// candidate. It is chosen by weighted-random among above-wave monsters (so it varies) and is
@@ -4664,7 +4869,7 @@ horde::MonsterTypeID G_HordePickMonsterType(
 	}
 	else
 	{
-		chosen_monster_id = SelectFromCache(g_monster_picker_internal_cache);
+		chosen_monster_id = table.Sample();
 		if (chosen_monster_id == horde::MonsterTypeID::UNKNOWN)
 			chosen_monster_id = EmergencyFallbackSelection(ctx);
 	}
@@ -4685,6 +4890,7 @@ void Horde_PreInit()
 	g_horde_nav_spawn_check = gi.cvar("g_horde_nav_spawn_check", "1", CVAR_NOFLAGS);
 	g_horde_spawn_dist_cap = gi.cvar("g_horde_spawn_dist_cap", "1", CVAR_NOFLAGS);
 	g_horde_far_spawn_chance = gi.cvar("g_horde_far_spawn_chance", "0.65", CVAR_NOFLAGS);
+	g_horde_spawn_pool_budget = gi.cvar("g_horde_spawn_pool_budget", "8", CVAR_NOFLAGS);
 	// Connecting-client hard caps: the Kex client bad_alloc's connecting to a server whose
 	// precache list grows too large. Empirical bracket so far: 240 and 257 models connect
 	// fine, ~304 crashes - exact ceiling (and whether sounds/images contribute) still being
@@ -5093,6 +5299,7 @@ static void PrecacheAllMonsters()
 	}
 	// Reset all flags to false.
 	g_precached_monster_types_flags.fill(false);
+	Horde_InvalidateMonsterSelection();
 
 	if (g_precached_families_this_map.empty())
 	{
@@ -5405,6 +5612,7 @@ void Horde_Init()
 
 	// Initialize PVM random monster selection BEFORE precaching
 	PVM_InitRandomMonsters();
+	Horde_InvalidateMonsterSelection();
 
 	PrecacheAllGameItems();
 	PrecacheWaveSounds();
@@ -5446,15 +5654,18 @@ constexpr int MIN_VERTICAL_VELOCITY = 400;
 // void RestoreFog();
 
 // Asegúrate de limpiar entidades muertas
-// NOTE: This function uses active_or_dead_monsters() iterator for efficient monster iteration.
-// The second loop over all edicts is necessary for gibs/projectiles as they are not monsters.
-// This is only called during wave cleanup/skipwave, not every frame, so performance is acceptable.
+// NOTE: Monsters come from the MonsterTable rows, gibs and projectiles from the GibPool
+// lists, rather than a scan over all edicts.
+// This is only called during wave cleanup/skipwave, not every frame.
 void Horde_CleanBodies()
 {
-	// Clean up dead monsters - uses optimized iterator
-	for (edict_t* ent : active_or_dead_monsters())
+	// Clean up dead monsters
+	const MonsterTable::table_t& monsters = MonsterTable::Table();
+	for (size_t row = 0; row < monsters.size(); row++)
 	{
-		if (ent->deadflag || ent->health <= 0)
+		edict_t* ent = monsters.edict(row);
+
+		if (!monsters.alive(row))
 		{
 			if (!ent->monsterinfo.is_fading_out)
 			{ // Only check once before starting fade
@@ -5467,35 +5678,24 @@ void Horde_CleanBodies()
 		}
 	}
 
-	// Clean up gibs and stuck projectiles
-	// NOTE: This linear scan is necessary as gibs/projectiles are not indexed separately
-	// Start after body queue to avoid trying to free special edicts
-	for (int i = game.maxclients + static_cast<int>(BODY_QUEUE_SIZE) + 1; i < static_cast<int>(globals.num_edicts); i++)
+	// Clean up gibs (bodyque entities are in the protected range and never pooled)
+	for (edict_t* ent : GibPool::Tracked(GibPool::KIND_GIB))
 	{
-		edict_t* ent = &g_edicts[i];
-
-		if (!ent->inuse || !ent->classname)
-			continue;
-
-		// Check for gibs (bodyque entities are in the protected range and handled separately)
-		if (strcmp(ent->classname, "gib") == 0)
+		// Start fade out if not already fading
+		if (!ent->monsterinfo.is_fading_out)
 		{
-			// Start fade out if not already fading
-			if (!ent->monsterinfo.is_fading_out)
-			{
-				StartFadeOut(ent);
-			}
+			StartFadeOut(ent);
 		}
-		// Clean up stuck/old projectiles (grenades, rockets that didn't explode)
-		else if ((strcmp(ent->classname, "grenade") == 0 ||
-			strcmp(ent->classname, "rocket") == 0) &&
-			ent->timestamp > 0_ms &&
-			level.time > ent->timestamp + 5_sec) // 5 seconds past their normal timeout
+	}
+
+	// Clean up stuck/old projectiles (grenades, rockets that didn't explode)
+	for (edict_t* ent : GibPool::Tracked(GibPool::KIND_PROJECTILE))
+	{
+		if (ent->timestamp > 0_ms &&
+			level.time > ent->timestamp + 5_sec && // 5 seconds past their normal timeout
+			!ent->monsterinfo.is_fading_out)
 		{
-			if (!ent->monsterinfo.is_fading_out)
-			{
-				StartFadeOut(ent);
-			}
+			StartFadeOut(ent);
 		}
 	}
 
@@ -5589,6 +5789,7 @@ void AppendHordeMessage_impl(std::string_view message, gtime_t duration)
 
 		gi.configstring(CONFIG_HORDEMSG, msg_buffer);
 	}
+	G_InvalidateStats(STATS_WAVE);
 
 	// Extend or set the duration for the new combined message
 	horde_message_end_time = level.time + duration;
@@ -5600,6 +5801,7 @@ void ClearHordeMessage()
 	if (!current_msg.empty())
 	{
 		gi.configstring(CONFIG_HORDEMSG, "");
+		G_InvalidateStats(STATS_WAVE);
 	}
 	horde_message_end_time = 0_sec;
 }
@@ -5819,6 +6021,7 @@ void ResetGame()
 	g_precached_models_this_map.clear();
 	g_precached_families_this_map.clear();  // Reset family tracking for precache limit
 	g_precached_monster_types_flags.fill(false);
+	Horde_InvalidateMonsterSelection();
 	monsters_precached = false;
 	// A map change resets the engine's configstrings; clear the measured totals so a
 	// previous map's over-budget reading can't block family seeding on the fresh map
@@ -6562,10 +6765,7 @@ static void DisplayWaveMessage(gtime_t duration = 5_sec)
 		"Check Menu -> Upgrading for the new stuff!\n",
 		"You can choose your own path on bonuses/upgrades, check Horde Menu!\n" };
 
-	// Usar distribución uniforme con mt_rand
-	std::uniform_int_distribution<size_t> dist(0, messages.size() - 1);
-	const size_t choice = dist(mt_rand);
-	AppendHordeMessage(messages[choice], duration);
+	AppendHordeMessage(random_element(messages), duration);
 }
 
 static void HandleWaveCleanupMessage(const horde::MapSize& mapSize)
@@ -6844,8 +7044,12 @@ static bool IsPositionNavReachable(const vec3_t& position)
 	}
 }
 
-[[nodiscard]] // FIXED: Clean implementation without historical comments, clear return struct
-PositionValidationResult IsPositionPhysicallyValid(const vec3_t& position, const vec3_t& monster_mins, const vec3_t& monster_maxs, const bool is_flying)
+// World-only half of IsPositionPhysicallyValid: contents, sky, ground and navmesh checks,
+// none of which depend on where monsters or players currently are. The spawn position pool
+// (horde_spawning.cpp) caches this per spawn point and hull and only re-runs
+// IsSpawnVolumeClear when a monster is actually placed.
+[[nodiscard]]
+PositionValidationResult IsPositionGeometryValid(const vec3_t& position, const vec3_t& monster_mins, const vec3_t& monster_maxs, const bool is_flying)
 {
 	PositionValidationResult result = { false, position };
 
@@ -6903,26 +7107,6 @@ PositionValidationResult IsPositionPhysicallyValid(const vec3_t& position, const
 		}
 	}
 
-	// Calculate bbox size to determine if we need extra clearance
-	const float bbox_radius = std::max({ monster_maxs.x - monster_mins.x, monster_maxs.y - monster_mins.y }) * 0.5f;
-	const bool is_large_monster = bbox_radius > 32.0f; // Large monsters (GM Arachnid, Tanks, etc.)
-
-	// Check if the volume is occupied by world geometry or other monsters
-	// For large monsters, add 8 units of padding to prevent tight spawns
-	vec3_t check_mins = monster_mins;
-	vec3_t check_maxs = monster_maxs;
-	if (is_large_monster) {
-		check_mins.x -= 8.0f;
-		check_mins.y -= 8.0f;
-		check_maxs.x += 8.0f;
-		check_maxs.y += 8.0f;
-	}
-
-	const trace_t trace = gi.trace(position, check_mins, check_maxs, position, nullptr, MASK_MONSTERSOLID);
-	if (trace.startsolid) {
-		return result;
-	}
-
 	// For ground units, drop to floor
 	vec3_t final_pos = position;
 	if (!is_flying)
@@ -6956,6 +7140,39 @@ PositionValidationResult IsPositionPhysicallyValid(const vec3_t& position, const
 	return result;
 }
 
+// Occupancy half of IsPositionPhysicallyValid: is the hull at `position` free of world
+// geometry, monsters and players right now.
+[[nodiscard]]
+bool IsSpawnVolumeClear(const vec3_t& position, const vec3_t& monster_mins, const vec3_t& monster_maxs)
+{
+	// Calculate bbox size to determine if we need extra clearance
+	const float bbox_radius = std::max({ monster_maxs.x - monster_mins.x, monster_maxs.y - monster_mins.y }) * 0.5f;
+	const bool is_large_monster = bbox_radius > 32.0f; // Large monsters (GM Arachnid, Tanks, etc.)
+
+	// Check if the volume is occupied by world geometry or other monsters
+	// For large monsters, add 8 units of padding to prevent tight spawns
+	vec3_t check_mins = monster_mins;
+	vec3_t check_maxs = monster_maxs;
+	if (is_large_monster) {
+		check_mins.x -= 8.0f;
+		check_mins.y -= 8.0f;
+		check_maxs.x += 8.0f;
+		check_maxs.y += 8.0f;
+	}
+
+	const trace_t trace = gi.trace(position, check_mins, check_maxs, position, nullptr, MASK_MONSTERSOLID);
+	return !trace.startsolid;
+}
+
+[[nodiscard]] // FIXED: Clean implementation without historical comments, clear return struct
+PositionValidationResult IsPositionPhysicallyValid(const vec3_t& position, const vec3_t& monster_mins, const vec3_t& monster_maxs, const bool is_flying)
+{
+	PositionValidationResult result = IsPositionGeometryValid(position, monster_mins, monster_maxs, is_flying);
+	if (result.is_valid && !IsSpawnVolumeClear(position, monster_mins, monster_maxs))
+		result = { false, position };
+	return result;
+}
+
 // helper function
 static edict_t* FindBestPlayerTargetForTeleport()
 {
@@ -7172,15 +7389,14 @@ static bool ForceKillMostStuckMonster()
 	edict_t* most_stuck = nullptr;
 	int highest_stuck_score = 0;
 
-	for (edict_t* ent : active_monsters())
+	const MonsterTable::table_t& monsters = MonsterTable::Table();
+	for (size_t row = 0; row < monsters.size(); row++)
 	{
-		if (!ent || !ent->inuse || ent->deadflag || ent->health <= 0)
-			continue;
-
 		// Skip bosses - let them be killed normally
-		if (ent->monsterinfo.IS_BOSS)
+		if (!monsters.alive(row) || (monsters.flags[row] & MonsterTable::FLAG_BOSS))
 			continue;
 
+		edict_t* ent = monsters.edict(row);
 		int stuck_score = 0;
 
 		// Critical: Monster is in the void (below map)
@@ -8552,11 +8768,17 @@ static bool FindValidSpawnLocation(
 			return false;
 		};
 
+		const auto hull = HordePhys::SpawnGrid::ClassifyHull(predicted_mins, predicted_maxs);
+
+		// scan the grid once for this placement; attempts draw from the ring without repeats
+		static std::vector<vec3_t> grid_candidates;
+		HordePhys::g_spawn_grid.CollectPositionsForHullNear(base_origin, GRID_MIN_DIST, GRID_MAX_DIST, hull, is_flying, grid_candidates);
+
 		for (int attempt = 0; attempt < GRID_ATTEMPTS; ++attempt)
 		{
 			vec3_t grid_pos;
-			if (!HordePhys::g_spawn_grid.GetRandomPositionNear(base_origin, GRID_MIN_DIST, GRID_MAX_DIST, grid_pos))
-				continue;
+			if (!HordePhys::SpawnGrid::TakeRandomPosition(grid_candidates, grid_pos))
+				break;
 
 			if (grid_pos_too_close_to_player(grid_pos))
 				continue;
@@ -8579,11 +8801,9 @@ static bool FindValidSpawnLocation(
 		}
 	}
 
-	// Attempt Direct Spawn
-	const auto validation = IsPositionPhysicallyValid(base_origin, predicted_mins, predicted_maxs, is_flying);
-	if (validation.is_valid)
+	// Attempt Direct Spawn (geometry comes from the spawn position pool, only occupancy is traced)
+	if (Horde_ValidateSpawnPointOrigin(spawn_point, monster_type, out_origin))
 	{
-		out_origin = validation.adjusted_position;
 		out_angles = base_angles;
 		out_used_alternative = false;
 		//if (developer->integer > 1 && is_flying && is_flying_only_lane)
@@ -9166,15 +9386,17 @@ public:
 		if (ShouldUseFallbackGrid()) {
 			vec3_t grid_pos;
 
-			// Use tactical spawning if enabled (final fallback)
+			// Use tactical spawning if enabled (final fallback); either way only
+			// nodes with room for this monster's hull class are considered
+			const auto hull = HordePhys::SpawnGrid::ClassifyHull(predicted_mins, predicted_maxs);
 			bool got_position = false;
 			if (g_horde_tactical_spawn->integer > 0)
 			{
-				got_position = HordePhys::g_spawn_grid.GetTacticalSpawnPosition(grid_pos, 256.0f, 20);
+				got_position = HordePhys::g_spawn_grid.GetTacticalSpawnPosition(grid_pos, 256.0f, 20, false, hull, is_flying);
 			}
 			else
 			{
-				got_position = HordePhys::g_spawn_grid.GetRandomPosition(grid_pos);
+				got_position = HordePhys::g_spawn_grid.GetRandomPositionForHull(hull, is_flying, grid_pos);
 			}
 
 			if (got_position) {
@@ -9785,6 +10007,7 @@ void Horde_RunFrame()
 		return;
 
 	// --- TIME-SLICED EXECUTION PHASE ---
+	Horde_RefreshSpawnPositionPool();
 	ExecuteSpawnPlan();
 	ExecuteNextSpecialSpawn();
 	// Drop any live-monster count cached during this frame's monster think pass so the
@@ -10144,19 +10367,13 @@ int32_t GetStroggsNum() noexcept
 		return g_strogg_count_cache;
 
 	int32_t live_monster_count = 0;
-	// Use the efficient 'active_monsters' iterator.
-	for (edict_t* ent : active_monsters())
+	const MonsterTable::table_t& monsters = MonsterTable::Table();
+	for (size_t row = 0; row < monsters.size(); row++)
 	{
-		// This is the crucial check you suggested.
-		// If a monster has this flag, it's a temporary entity (like for precaching)
+		// If a monster has AI_DO_NOT_COUNT, it's a temporary entity (like for precaching)
 		// or a special case that shouldn't be counted towards the wave total.
-		if (ent->monsterinfo.aiflags & AI_DO_NOT_COUNT)
-		{
-			continue; // Skip this monster.
-		}
-
-		// The monster is inuse, alive, and meant to be counted.
-		live_monster_count++;
+		if (monsters.alive(row) && !(monsters.flags[row] & MonsterTable::FLAG_UNCOUNTED))
+			live_monster_count++;
 	}
 
 	g_strogg_count_cache_time = level.time;
@@ -10240,6 +10457,7 @@ bool Horde_TeleportMonster(edict_t* self, const vec3_t& destination_origin, cons
 	self->s.renderfx = original_renderfx;
 	self->svflags &= ~SVF_NOCLIENT;
 	gi.linkentity(self);
+	HordePhys::g_radius_index.NoteMoved(self);
 
 	if (play_effects)
 	{
@@ -11243,6 +11461,7 @@ static void Horde_InitLevel(const int32_t lvl)
 	// --- 3. Build eligible monsters list ---
 	g_eligible_monsters_for_wave.clear();
 	g_eligible_item_indices_for_wave.clear();
+	Horde_InvalidateMonsterSelection();
 
 	const horde::MonsterTypeID* pvm_monsters = PVM_GetRandomMonsters();
 	const int pvm_monster_count = PVM_GetRandomMonsterCount();
@@ -11290,6 +11509,10 @@ static void Horde_InitLevel(const int32_t lvl)
 		gi.Com_PrintFmt("JIT Precache: All necessary monsters for wave {} are now in memory.\n", lvl);
 	}
 
+	// Let the per-frame pool refresh validate spawn points for this wave's hulls
+	// during the countdown, before the first batch is planned
+	Horde_PrimeSpawnPositionPool();
+
 	// --- 6. Finalize wave setup ---
 	FinalizeWaveSetup(lvl, numHumanPlayers);
 
@@ -32,6 +32,7 @@ extern cvar_t* g_horde_force_domination;  // Test cvar: force the domination fla
 extern cvar_t* g_horde_nav_spawn_check;  // 1 = reject ground spawns the navmesh can't reach (anti unreachable-spawn)
 extern cvar_t* g_horde_spawn_dist_cap;  // 1 = cap how far from players a spawn point may be (anti far/closed-wing spawn)
 extern cvar_t* g_horde_far_spawn_chance;  // 0..1 chance a normal-wave pick prefers the farthest spawn point (fog waves floor at 0.9)
+extern cvar_t* g_horde_spawn_pool_budget;  // spawn position pool entries validated ahead of time per frame; 0 = on demand only
 extern cvar_t* g_horde_precache_max_models;  // soft cap on registered CS_MODELS entries; 0 = no cap (see PrecacheBudgetExhausted)
 extern cvar_t* g_horde_precache_max_sounds;  // soft cap on registered CS_SOUNDS entries; 0 = no cap
 extern cvar_t* g_horde_precache_limits_enabled;  // 1 = enforce the precache budget + family variety cap (default); 0 = uncapped variety, connecting-client crash risk on long games
@@ -307,6 +308,12 @@ extern size_t g_spawn_history_index;  // Ring buffer index
 int32_t GetFamilySpawnCountInHistory(AssetFamilyID family_id);
 void RecordSpawnInHistory(AssetFamilyID family_id, int32_t wave_number);
 
+// Drops every cached monster selection table. Call after changing anything
+// BuildMonsterCache reads that isn't part of the table key (precache flags,
+// g_eligible_monsters_for_wave, the PvM random list).
+void Horde_InvalidateMonsterSelection();
+void Horde_PrintMonsterSelectionStats();
+
 // --- Operator Overloads for MonsterWaveType ---
 // These are fine to keep in the header as they are small, inline, and constexpr.
 template<typename E>
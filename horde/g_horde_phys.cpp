@@ -2,7 +2,9 @@
 #include "horde_constants.h"  // For HordeConstants
 #include "../g_local.h"
 #include "../memory_safety.h" // For FileGuard
+#include "../profiler.h"
 #include <algorithm> // For std::min/max
+#include <cfloat>
 #include <filesystem> // For path operations
 #ifdef _WIN32
     #ifndef WIN32_LEAN_AND_MEAN
@@ -481,6 +483,133 @@ void ProximityGrid::Reset()
         return { m_filtered_buffer.data(), filtered_count };
     }
 
+    // =======================================================================
+    // RadiusIndex Implementation
+    // =======================================================================
+
+    RadiusIndex g_radius_index;
+
+    int RadiusIndex::CellCoord(float value, float world_min) const noexcept {
+        const float cell = (value - world_min) * m_inv_cell_size;
+        // out-of-bounds (and NaN) positions clamp to the edge cells, where queries near them look too
+        if (!(cell > 0.0f))
+            return 0;
+        return std::min(static_cast<int>(cell), GRID_DIMENSION - 1);
+    }
+
+    void RadiusIndex::NoteMoved(edict_t* ent) {
+        const uint32_t number = ent->s.number;
+
+        if (m_built_time < 0 || number >= MAX_EDICTS || m_is_moved[number])
+            return;
+
+        m_is_moved[number] = true;
+        m_moved.push_back(ent);
+    }
+
+    void RadiusIndex::Rebuild() {
+        PROFILE_SCOPE("RadiusIndex::Rebuild");
+
+        const uint32_t num_edicts = globals.num_edicts;
+
+        // fit the grid to where entities are right now; anything that later leaves
+        // these bounds clamps to the edge cells, which queries near it reach too
+        vec3_t bounds_min{ FLT_MAX, FLT_MAX, 0.0f }, bounds_max{ -FLT_MAX, -FLT_MAX, 0.0f };
+
+        for (uint32_t i = 0; i < num_edicts; i++) {
+            const edict_t* ent = &g_edicts[i];
+
+            if (!ent->inuse)
+                continue;
+
+            const vec3_t center = ent->s.origin + (ent->mins + ent->maxs) * 0.5f;
+            bounds_min.x = std::min(bounds_min.x, center.x);
+            bounds_min.y = std::min(bounds_min.y, center.y);
+            bounds_max.x = std::max(bounds_max.x, center.x);
+            bounds_max.y = std::max(bounds_max.y, center.y);
+        }
+
+        const float extent = std::max({ bounds_max.x - bounds_min.x, bounds_max.y - bounds_min.y, 0.0f });
+        m_grid_mins = bounds_min;
+        m_inv_cell_size = 1.0f / std::max(MIN_CELL_SIZE, extent / GRID_DIMENSION);
+        // entities keep moving after the rebuild; anything within a frame's worth of
+        // sv_maxvelocity of its indexed cell must still be reachable
+        m_slack_cells = 1 + static_cast<int>(std::ceil(std::max(sv_maxvelocity->value, 0.0f) * gi.frame_time_s * m_inv_cell_size));
+
+        // counting sort by cell, walking edicts in order so each cell stays in edict order
+        constexpr uint16_t NO_CELL = 0xFFFF;
+
+        m_cell_start.fill(0);
+        m_entity_cells.resize(num_edicts);
+
+        for (uint32_t i = 0; i < num_edicts; i++) {
+            const edict_t* ent = &g_edicts[i];
+
+            if (!ent->inuse) {
+                m_entity_cells[i] = NO_CELL;
+                continue;
+            }
+
+            const vec3_t center = ent->s.origin + (ent->mins + ent->maxs) * 0.5f;
+            const int cell = CellCoord(center.y, m_grid_mins.y) * GRID_DIMENSION + CellCoord(center.x, m_grid_mins.x);
+            m_entity_cells[i] = static_cast<uint16_t>(cell);
+            m_cell_start[cell + 1]++;
+        }
+
+        for (int c = 0; c < CELL_COUNT; c++)
+            m_cell_start[c + 1] += m_cell_start[c];
+
+        m_entities.resize(m_cell_start[CELL_COUNT]);
+
+        std::array<uint32_t, CELL_COUNT> fill;
+        std::copy_n(m_cell_start.begin(), CELL_COUNT, fill.begin());
+
+        for (uint32_t i = 0; i < num_edicts; i++) {
+            if (m_entity_cells[i] != NO_CELL)
+                m_entities[fill[m_entity_cells[i]]++] = &g_edicts[i];
+        }
+
+        for (edict_t* ent : m_moved)
+            m_is_moved[ent->s.number] = false;
+        m_moved.clear();
+
+        m_built_time = level.time.milliseconds();
+    }
+
+    void RadiusIndex::Query(const vec3_t& org, float rad, boost::container::small_vector_base<edict_t*>& out) {
+        if (m_built_time != level.time.milliseconds())
+            Rebuild();
+
+        const float rad_squared = rad * rad;
+        const size_t first = out.size();
+
+        // widened by the slack for anything that moved since the rebuild
+        const int min_x = std::max(CellCoord(org.x - rad, m_grid_mins.x) - m_slack_cells, 0);
+        const int max_x = std::min(CellCoord(org.x + rad, m_grid_mins.x) + m_slack_cells, GRID_DIMENSION - 1);
+        const int min_y = std::max(CellCoord(org.y - rad, m_grid_mins.y) - m_slack_cells, 0);
+        const int max_y = std::min(CellCoord(org.y + rad, m_grid_mins.y) + m_slack_cells, GRID_DIMENSION - 1);
+
+        for (int y = min_y; y <= max_y; y++) {
+            for (int x = min_x; x <= max_x; x++) {
+                const int cell = y * GRID_DIMENSION + x;
+
+                for (uint32_t i = m_cell_start[cell]; i < m_cell_start[cell + 1]; i++) {
+                    if (G_EntityInRadius(m_entities[i], org, rad_squared))
+                        out.push_back(m_entities[i]);
+                }
+            }
+        }
+
+        for (edict_t* ent : m_moved) {
+            if (G_EntityInRadius(ent, org, rad_squared))
+                out.push_back(ent);
+        }
+
+        // cells come out in cell order; a slot reused since the rebuild can be in both lists
+        std::sort(out.begin() + first, out.end());
+        out.erase(std::unique(out.begin() + first, out.end()), out.end());
+    }
+
     // =======================================================================
     // SpawnGrid Implementation - Ported from Vortex mod
     // =======================================================================
@@ -636,9 +765,141 @@ void ProximityGrid::Reset()
     // Clear the grid
     void SpawnGrid::Clear() {
         m_node_count = 0;
+        m_ground_fit_count.fill(0);
+        m_air_fit_count.fill(0);
         ClearCooldowns();
     }
 
+    // Hull class boxes, relative to a node (nodes sit 24 units above the floor, so mins.z = -24
+    // puts the feet on the ground). Indexed by HullClass; None has no box.
+    struct HullClassBox {
+        vec3_t mins;
+        vec3_t maxs;
+    };
+    static constexpr std::array<HullClassBox, static_cast<size_t>(SpawnGrid::HullClass::Count)> HULL_CLASS_BOXES = {{
+        { { 0, 0, 0 }, { 0, 0, 0 } },
+        { { -16, -16, -24 }, { 16, 16, 32 } },
+        { { -24, -24, -24 }, { 24, 24, 48 } },
+        { { -32, -32, -24 }, { 32, 32, 64 } },
+        { { -64, -64, -24 }, { 64, 64, 112 } }
+    }};
+    // How far above the node the air class is tested (hover room for flyers)
+    static constexpr float HULL_AIR_LIFT = 64.0f;
+
+    SpawnGrid::HullClass SpawnGrid::ClassifyHull(const vec3_t& mins, const vec3_t& maxs) noexcept {
+        const float half_width = std::max({ -mins.x, maxs.x, -mins.y, maxs.y });
+        const float height = maxs.z - mins.z;
+
+        for (size_t c = static_cast<size_t>(HullClass::Small); c < HULL_CLASS_BOXES.size(); c++) {
+            const HullClassBox& box = HULL_CLASS_BOXES[c];
+            if (half_width <= box.maxs.x && height <= box.maxs.z - box.mins.z)
+                return static_cast<HullClass>(c);
+        }
+        return HullClass::Boss;
+    }
+
+    // Largest class that fits standing on the node (box clear + floor under its corners)
+    // and hovering HULL_AIR_LIFT above it (box clear all the way up)
+    uint8_t SpawnGrid::ComputeNodeHulls(const vec3_t& pos) const {
+        uint8_t ground = static_cast<uint8_t>(HullClass::None);
+        for (size_t c = static_cast<size_t>(HullClass::Small); c < HULL_CLASS_BOXES.size(); c++) {
+            const HullClassBox& box = HULL_CLASS_BOXES[c];
+            const trace_t tr = gi.trace(pos, box.mins, box.maxs, pos, nullptr, MASK_WALK_NAV_SOLID);
+            if (tr.startsolid || tr.allsolid || !CheckBottom(pos, box.mins, box.maxs))
+                break;
+            ground = static_cast<uint8_t>(c);
+        }
+
+        uint8_t air = static_cast<uint8_t>(HullClass::None);
+        vec3_t lifted = pos;
+        lifted.z += HULL_AIR_LIFT;
+        for (size_t c = static_cast<size_t>(HullClass::Small); c < HULL_CLASS_BOXES.size(); c++) {
+            const HullClassBox& box = HULL_CLASS_BOXES[c];
+            const trace_t tr = gi.trace(pos, box.mins, box.maxs, lifted, nullptr, MASK_SOLID);
+            if (tr.startsolid || tr.allsolid || tr.fraction < 1.0f)
+                break;
+            air = static_cast<uint8_t>(c);
+        }
+
+        return static_cast<uint8_t>(ground | (air << 4));
+    }
+
+    void SpawnGrid::ComputeAllNodeHulls() {
+        for (int i = 0; i < m_node_count; i++)
+            m_node_hulls[i] = ComputeNodeHulls(m_grid_nodes[i]);
+    }
+
+    // Counting sort of node indices by class, largest first
+    void SpawnGrid::BuildHullOrders() {
+        constexpr size_t CLASS_COUNT = static_cast<size_t>(HullClass::Count);
+
+        auto build = [this](std::array<uint16_t, MAX_GRID_NODES>& order, std::array<int, CLASS_COUNT>& fit_count, int shift) {
+            std::array<int, CLASS_COUNT> per_class{};
+            for (int i = 0; i < m_node_count; i++)
+                per_class[std::min<size_t>((m_node_hulls[i] >> shift) & 0x0F, CLASS_COUNT - 1)]++;
+
+            // fit_count[c] = nodes whose class is >= c
+            int running = 0;
+            for (size_t c = CLASS_COUNT; c-- > 0; ) {
+                running += per_class[c];
+                fit_count[c] = running;
+            }
+
+            // class c's nodes start right after all larger classes
+            std::array<int, CLASS_COUNT> cursor{};
+            for (size_t c = 0; c < CLASS_COUNT; c++)
+                cursor[c] = (c + 1 < CLASS_COUNT) ? fit_count[c + 1] : 0;
+
+            for (int i = 0; i < m_node_count; i++) {
+                const size_t c = std::min<size_t>((m_node_hulls[i] >> shift) & 0x0F, CLASS_COUNT - 1);
+                order[cursor[c]++] = static_cast<uint16_t>(i);
+            }
+        };
+
+        build(m_ground_order, m_ground_fit_count, 0);
+        build(m_air_order, m_air_fit_count, 4);
+    }
+
+    int SpawnGrid::GetNodeCountForHull(HullClass hull, bool in_air) const noexcept {
+        const size_t c = std::min(static_cast<size_t>(hull), static_cast<size_t>(HullClass::Count) - 1);
+        return in_air ? m_air_fit_count[c] : m_ground_fit_count[c];
+    }
+
+    bool SpawnGrid::GetRandomPositionForHull(HullClass hull, bool in_air, vec3_t& out_pos) const {
+        const int fitting = GetNodeCountForHull(hull, in_air);
+        if (fitting < 1)
+            return false;
+
+        out_pos = FittingNode(irandom(fitting), in_air);
+        return true;
+    }
+
+    void SpawnGrid::CollectPositionsForHullNear(const vec3_t& center, float min_dist, float max_dist, HullClass hull, bool in_air, std::vector<vec3_t>& out) const {
+        const int fitting = GetNodeCountForHull(hull, in_air);
+        const float min_dist_sq = min_dist * min_dist;
+        const float max_dist_sq = max_dist * max_dist;
+
+        out.clear();
+        for (int i = 0; i < fitting; i++) {
+            const vec3_t& candidate = FittingNode(i, in_air);
+            const float dist_sq = (candidate - center).lengthSquared();
+            if (dist_sq >= min_dist_sq && dist_sq <= max_dist_sq)
+                out.push_back(candidate);
+        }
+    }
+
+    bool SpawnGrid::TakeRandomPosition(std::vector<vec3_t>& candidates, vec3_t& out_pos) {
+        if (candidates.empty())
+            return false;
+
+        // swap-remove, so a rejected node isn't drawn again by the next attempt
+        const size_t pick = static_cast<size_t>(irandom(static_cast<int32_t>(candidates.size())));
+        out_pos = candidates[pick];
+        candidates[pick] = candidates.back();
+        candidates.pop_back();
+        return true;
+    }
+
     // Mark a position as recently used (adds cooldown)
     void SpawnGrid::MarkPositionUsed(const vec3_t& pos) {
         m_cooldown_positions[m_cooldown_write_index] = pos;
@@ -882,6 +1143,10 @@ void ProximityGrid::Reset()
     done:
         m_node_count = generated_count;
 
+        // Hull classes are computed once here and saved with the nodes
+        ComputeAllNodeHulls();
+        BuildHullOrders();
+
         // DEBUG: Print validation failure statistics
         if (developer->integer > 1) {
             gi.Com_PrintFmt("Grid generation stats:\n");
@@ -896,6 +1161,11 @@ void ProximityGrid::Reset()
             gi.Com_PrintFmt("  Failed sky: {}\n", failed_sky);
             gi.Com_PrintFmt("  Failed nearby: {}\n", failed_nearby);
             gi.Com_PrintFmt("Spawn grid generation complete: {} valid nodes.\n", m_node_count);
+            gi.Com_PrintFmt("  Ground fit small/medium/large/boss: {}/{}/{}/{}, air: {}/{}/{}/{}\n",
+                GetNodeCountForHull(HullClass::Small, false), GetNodeCountForHull(HullClass::Medium, false),
+                GetNodeCountForHull(HullClass::Large, false), GetNodeCountForHull(HullClass::Boss, false),
+                GetNodeCountForHull(HullClass::Small, true), GetNodeCountForHull(HullClass::Medium, true),
+                GetNodeCountForHull(HullClass::Large, true), GetNodeCountForHull(HullClass::Boss, true));
         }
 
         if (m_node_count > 0) {
@@ -970,8 +1240,11 @@ void ProximityGrid::Reset()
     // - Distance checks: Always applied (min distance from players)
     // - Visibility checks: Applied when prefer_out_of_visibility=true (25% chance from caller)
     // The g_horde_tactical_spawn cvar can ENHANCE behavior (mode 2 = always check visibility)
-    bool SpawnGrid::GetTacticalSpawnPosition(vec3_t& out_pos, float min_dist_from_players, int max_attempts, bool prefer_out_of_visibility) const {
-        if (m_node_count < 1)
+    bool SpawnGrid::GetTacticalSpawnPosition(vec3_t& out_pos, float min_dist_from_players, int max_attempts, bool prefer_out_of_visibility,
+        HullClass hull, bool in_air) const {
+        // Candidates are drawn only from nodes with room for the hull
+        const int fitting = GetNodeCountForHull(hull, in_air);
+        if (fitting < 1)
             return false;
 
         // Get tactical spawn mode from cvar (can enhance default behavior)
@@ -989,8 +1262,7 @@ void ProximityGrid::Reset()
             attempts++;
 
             // Get random candidate position
-            const int idx = irandom(m_node_count);
-            const vec3_t& candidate = m_grid_nodes[idx];
+            const vec3_t& candidate = FittingNode(irandom(fitting), in_air);
 
             // ALWAYS check cooldowns (default behavior - prevents spawn clustering)
             if (IsPositionOnCooldown(candidate, HordeConstants::GRID_COOLDOWN_RADIUS)) {
@@ -1035,8 +1307,7 @@ void ProximityGrid::Reset()
         }
 
         for (int i = 0; i < max_attempts / 2; i++) {
-            const int idx = irandom(m_node_count);
-            const vec3_t& candidate = m_grid_nodes[idx];
+            const vec3_t& candidate = FittingNode(irandom(fitting), in_air);
 
             // Only check cooldown in fallback
             if (!IsPositionOnCooldown(candidate, HordeConstants::GRID_COOLDOWN_RADIUS)) {
@@ -1046,7 +1317,7 @@ void ProximityGrid::Reset()
         }
 
         // Final fallback: pure random (no cooldown check)
-        return GetRandomPosition(out_pos);
+        return GetRandomPositionForHull(hull, in_air, out_pos);
     }
 
     // Check if a position is within the playable map boundaries
@@ -1096,12 +1367,12 @@ void ProximityGrid::Reset()
             FileGuard guard(fp);  // RAII: auto-closes on scope exit or exception
 
             // Write header
-            const int32_t version = 1;
-            fwrite(&version, sizeof(int32_t), 1, fp);
+            fwrite(&GRID_FILE_VERSION, sizeof(int32_t), 1, fp);
             fwrite(&m_node_count, sizeof(int32_t), 1, fp);
 
-            // Write node positions
+            // Write node positions, then their hull classes (version 2+)
             fwrite(m_grid_nodes.data(), sizeof(vec3_t), m_node_count, fp);
+            fwrite(m_node_hulls.data(), sizeof(uint8_t), m_node_count, fp);
 
             if (developer->integer > 1)
                 gi.Com_PrintFmt("Spawn grid saved to {}\n", grid_file.string());
@@ -1144,7 +1415,7 @@ void ProximityGrid::Reset()
             fread(&version, sizeof(int32_t), 1, fp);
             fread(&node_count, sizeof(int32_t), 1, fp);
 
-            if (version != 1 || node_count < 1 || node_count > MAX_GRID_NODES) {
+            if (version < 1 || version > GRID_FILE_VERSION || node_count < 1 || node_count > MAX_GRID_NODES) {
                 gi.Com_PrintFmt("Invalid spawn grid file: {}\n", grid_file.string());
                 return false;
             }
@@ -1159,6 +1430,22 @@ void ProximityGrid::Reset()
             }
             m_node_count = node_count;
 
+            // Version 1 files predate hull classes: compute them now and upgrade the file
+            bool needs_upgrade = version < 2;
+            if (!needs_upgrade) {
+                const size_t hulls_read = fread(m_node_hulls.data(), sizeof(uint8_t), node_count, fp);
+                needs_upgrade = hulls_read != static_cast<size_t>(node_count);
+            }
+            if (needs_upgrade)
+                ComputeAllNodeHulls();
+            BuildHullOrders();
+
+            if (needs_upgrade) {
+                fclose(guard.fp);
+                guard.fp = nullptr;
+                SaveToDisk(mapname);
+            }
+
             return true;
 
         } catch (const std::exception&) {
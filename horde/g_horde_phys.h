@@ -130,6 +130,51 @@ namespace HordePhys {
 
     extern EntityGrid g_entity_grid;
 
+    // =======================================================================
+    // Radius Index - grid-backed stand-in for findradius (see radius_edicts)
+    // =======================================================================
+    // EntityGrid only holds combatants and skips triggers, so it can't answer
+    // for findradius, which sees every in-use non-SOLID_NOT entity. This is the
+    // same cell scheme over every in-use entity, bucketed by bbox center and
+    // rebuilt on the first query of a frame. Entities spawned or teleported after
+    // the rebuild are checked directly until the next one, and queries reach a
+    // frame's worth of sv_maxvelocity past the radius to catch anything that
+    // moved since; each candidate is then re-tested exactly, so a query yields
+    // findradius' set.
+    class RadiusIndex {
+    public:
+        static constexpr int GRID_DIMENSION = 64;
+        static constexpr int CELL_COUNT = GRID_DIMENSION * GRID_DIMENSION;
+        static constexpr float MIN_CELL_SIZE = 128.0f;
+
+        // Called for entities that spawned or teleported since the rebuild (G_InitEdict,
+        // KillBox, Horde_TeleportMonster); queries check them on top of the grid
+        void NoteMoved(edict_t* ent);
+
+        // Forget the current grid (map change, savegame load)
+        void Invalidate() noexcept { m_built_time = -1; }
+
+        // Appends every entity passing findradius' test for (org, rad) to out, in edict order
+        void Query(const vec3_t& org, float rad, boost::container::small_vector_base<edict_t*>& out);
+
+    private:
+        void Rebuild();
+        [[nodiscard]] int CellCoord(float value, float world_min) const noexcept;
+
+        std::array<uint32_t, CELL_COUNT + 1> m_cell_start{};  // cell c holds m_entities[start[c], start[c + 1])
+        std::vector<edict_t*> m_entities;                     // bucketed by cell, edict order within a cell
+        std::vector<uint16_t> m_entity_cells;                 // rebuild scratch
+        std::vector<edict_t*> m_moved;                        // spawned/teleported since the rebuild
+        std::array<bool, MAX_EDICTS> m_is_moved{};
+
+        vec3_t m_grid_mins{};
+        float m_inv_cell_size = 0.0f;
+        int m_slack_cells = 1;                                // how far an entity can move in a frame
+        int64_t m_built_time = -1;
+    };
+
+    extern RadiusIndex g_radius_index;
+
     // =======================================================================
     // Spawn Grid System - Pre-validated spawn positions across the map
     // Ported from Vortex mod's grid system to prevent out-of-map spawns
@@ -141,6 +186,22 @@ namespace HordePhys {
         static constexpr int GRID_DIMENSION = 64;   // 64x64x64 grid cells (adaptive to map size)
         static constexpr int GRID_SPACING = 16;     // 16 units between grid points
         static constexpr size_t MAX_COOLDOWN_POSITIONS = 32;  // Ring buffer size for cooldown tracking
+        static constexpr int32_t GRID_FILE_VERSION = 2;      // .grd layout; 2 added per-node hull classes
+
+        // Size classes a node has room for, smallest to largest. Each node stores the largest
+        // class that fits standing on it (ground) and hovering just above it (air), computed
+        // once at generation and saved in the .grd file.
+        enum class HullClass : uint8_t {
+            None,    // node only passed the generator's flat 32x32 probe
+            Small,   // 32x32x56: soldiers, infantry, most flyers
+            Medium,  // 48x48x72: gladiators, berserkers, medics
+            Large,   // 64x64x88: tanks, mutants, arachnids
+            Boss,    // 128x128x136: supertank, jorg, widow, scaled bosses
+            Count
+        };
+
+        // Smallest class whose box contains these bounds (Boss when nothing does)
+        [[nodiscard]] static HullClass ClassifyHull(const vec3_t& mins, const vec3_t& maxs) noexcept;
 
         // Generate the spawn grid for the current map
         // Scans the entire map and validates spawn positions
@@ -156,7 +217,23 @@ namespace HordePhys {
         // min_dist_from_players: Minimum distance from any player
         // prefer_out_of_visibility: If true, strongly prefer positions not visible to players
         // Returns false if no suitable position found after max_attempts
-        bool GetTacticalSpawnPosition(vec3_t& out_pos, float min_dist_from_players = 512.0f, int max_attempts = 20, bool prefer_out_of_visibility = false) const;
+        // hull/in_air restrict candidates to nodes with room for that class (in_air: flyers)
+        bool GetTacticalSpawnPosition(vec3_t& out_pos, float min_dist_from_players = 512.0f, int max_attempts = 20, bool prefer_out_of_visibility = false,
+            HullClass hull = HullClass::None, bool in_air = false) const;
+
+        // Random node with room for `hull`; in_air picks from the hover clearance instead of standing room
+        bool GetRandomPositionForHull(HullClass hull, bool in_air, vec3_t& out_pos) const;
+
+        // Every node with room for `hull` within [min_dist, max_dist] of center, into out.
+        // One scan of the fitting nodes, no traces; collect once per placement and draw
+        // from the list with TakeRandomPosition rather than rescanning per attempt.
+        void CollectPositionsForHullNear(const vec3_t& center, float min_dist, float max_dist, HullClass hull, bool in_air, std::vector<vec3_t>& out) const;
+
+        // Removes a uniformly random entry from candidates into out_pos; false once it's empty
+        static bool TakeRandomPosition(std::vector<vec3_t>& candidates, vec3_t& out_pos);
+
+        // Number of nodes with room for `hull`
+        [[nodiscard]] int GetNodeCountForHull(HullClass hull, bool in_air) const noexcept;
 
         // Mark a grid position as recently used (adds cooldown)
         void MarkPositionUsed(const vec3_t& pos);
@@ -187,6 +264,15 @@ namespace HordePhys {
         // Fixed-capacity grid nodes - no heap allocation, m_node_count tracks active entries.
         std::array<vec3_t, MAX_GRID_NODES> m_grid_nodes{};
         int m_node_count = 0;
+
+        // Per-node hull classes: low nibble = ground class, high nibble = air class
+        std::array<uint8_t, MAX_GRID_NODES> m_node_hulls{};
+        // Node indices ordered by class, largest first, so the nodes fitting class C are
+        // the prefix [0, m_*_fit_count[C]) and a random fitting node is one irandom away
+        std::array<uint16_t, MAX_GRID_NODES> m_ground_order{};
+        std::array<uint16_t, MAX_GRID_NODES> m_air_order{};
+        std::array<int, static_cast<size_t>(HullClass::Count)> m_ground_fit_count{};
+        std::array<int, static_cast<size_t>(HullClass::Count)> m_air_fit_count{};
         vec3_t m_world_mins{};
         vec3_t m_world_maxs{};
         vec3_t m_grid_size{};  // Size per grid cell
@@ -201,6 +287,15 @@ namespace HordePhys {
         bool CheckBottom(const vec3_t& pos, const vec3_t& boxmin, const vec3_t& boxmax) const;
         bool IsNearbyGridNode(const vec3_t& pos, int current_count, float min_distance = 129.0f) const;
 
+        // Hull class computation (generation / v1 file upgrade) and the class orderings
+        uint8_t ComputeNodeHulls(const vec3_t& pos) const;
+        void ComputeAllNodeHulls();
+        void BuildHullOrders();
+        // i'th node in class order; nodes [0, GetNodeCountForHull(C)) all fit class C
+        [[nodiscard]] const vec3_t& FittingNode(int i, bool in_air) const noexcept {
+            return m_grid_nodes[in_air ? m_air_order[i] : m_ground_order[i]];
+        }
+
         // Tactical spawning helper - checks if position is visible to any active player
         bool IsVisibleToPlayers(const vec3_t& pos) const;
 
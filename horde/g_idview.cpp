@@ -1,5 +1,6 @@
 #include "../shared.h"
 #include "g_horde_phys.h"
+#include "../q_vec3_batch.h"
 #include <queue>
 #include <span>
 #include <array> // Included for std::array
@@ -331,9 +332,20 @@ static inline void CheckEntityForTargeting(edict_t* viewer, const vec3_t& viewer
 
     // 2. Monsters: Use spatial grid for O(1) radius query instead of O(N) linear scan
     //    Only checks monsters within MAX_DISTANCE, reducing wasted checks
+    //    The widest cone any of them could pass is culled in one batch first; the
+    //    survivors get the exact per-entity test.
     const auto nearby_monsters = HordePhys::g_entity_grid.QueryRadiusFiltered(viewer_pos, IDViewConfig::MAX_DISTANCE, HordePhys::EntityGrid::TYPE_COMBAT);
-    for (edict_t* who : nearby_monsters) {
-        CheckEntityForTargeting(ent, viewer_pos, forward, who, best);
+    boost::container::small_vector<vec3_t, 64> monster_origins;
+    monster_origins.reserve(nearby_monsters.size());
+    for (const edict_t* who : nearby_monsters) {
+        monster_origins.push_back(who->s.origin);
+    }
+
+    boost::container::small_vector<uint32_t, 64> in_view(nearby_monsters.size());
+    in_view.resize(batch_in_cone(std::span<const vec3_t>(monster_origins.data(), monster_origins.size()), viewer_pos, forward, IDViewConfig::CLOSE_MIN_DOT - 0.01f,
+        IDViewConfig::MAX_DISTANCE * IDViewConfig::MAX_DISTANCE, in_view.data()));
+    for (uint32_t index : in_view) {
+        CheckEntityForTargeting(ent, viewer_pos, forward, nearby_monsters[index], best);
     }
 
     // 3. Iterate through our new, small list of special entities instead of all edicts.
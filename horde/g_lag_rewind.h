@@ -0,0 +1,39 @@
+#pragma once
+
+#include "../g_local.h"
+
+// ============================================================================
+// Lag Rewind - hitscan against where monsters were on the shooter's screen
+// ============================================================================
+// Paril's lag compensation moved every target back and relinked it for each
+// shot (two gi.linkentity calls per monster per shot), which didn't hold up
+// with a horde's worth of monsters, so Horde ran without it. Instead, every
+// frame the absolute bounds of the solid monsters are recorded into a ring,
+// tagged with the server frame. Between G_LagCompensate and G_UnLagCompensate,
+// pierce_trace hands each trace to Resolve, which tests the ray against the
+// boxes from the frame the shooter last saw and, if that puts a different
+// monster (or none) first, rewrites the trace accordingly. Nothing is moved
+// or relinked; the world is only traced again (without monsters) when the
+// live trace stopped on a monster.
+// Gated by g_lag_compensation, and g_lag_monsters (max rewind in ms, 0 = off).
+// "sv lagbench" times Resolve against synthetic hordes of 100-400 monsters.
+
+namespace LagRewind {
+
+    // Forget the recorded frames (map change, savegame load)
+    void Reset();
+
+    // Record this frame's monster bounds; call after the entities ran
+    void Record();
+
+    // Rewind hitscan from `shooter` by `frames_back` server frames until End
+    void Begin(const edict_t* shooter, uint32_t frames_back);
+    void End();
+
+    // Correct a point trace from `start` to `end` for the rewind in effect, if any
+    void Resolve(trace_t& tr, const vec3_t& start, const vec3_t& end, const edict_t* ignore, contents_t mask);
+
+    // sv lagbench [shots]
+    void Bench();
+
+} // namespace LagRewind
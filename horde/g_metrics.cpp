@@ -0,0 +1,217 @@
+#include "g_metrics.h"
+#include "g_horde.h"
+#include "../shared.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <system_error>
+
+namespace fs = std::filesystem;
+
+namespace Metrics {
+
+namespace {
+
+    using clock = std::chrono::steady_clock;
+
+    struct histogram_t {
+        const char*                 name;
+        const char*                 help;
+        std::span<const double>     bounds;
+        std::array<uint64_t, 16>    buckets{};  // per bound, plus +Inf
+        uint64_t                    count = 0;
+        double                      sum = 0;
+
+        void Observe(double value) {
+            size_t bucket = 0;
+            while (bucket < bounds.size() && value > bounds[bucket])
+                bucket++;
+            buckets[bucket]++;
+            count++;
+            sum += value;
+        }
+    };
+
+    constexpr double FRAME_BOUNDS[] = { 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25 };
+    constexpr double TRACE_BOUNDS[] = { 50, 100, 250, 500, 1000, 2500, 5000, 10000 };
+    constexpr double SAVE_BOUNDS[] = { 0.001, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 1 };
+
+    histogram_t s_frame_time{ "horde_frame_seconds", "Wall time of one game frame.", FRAME_BOUNDS };
+    histogram_t s_frame_traces{ "horde_traces_per_frame", "gi.trace calls in one game frame.", TRACE_BOUNDS };
+    histogram_t s_save_time{ "horde_character_save_seconds", "Wall time of one character save.", SAVE_BOUNDS };
+
+    std::array<uint64_t, COUNTER_COUNT> s_counters{};
+    uint64_t s_frames = 0, s_traces = 0, s_frame_trace_start = 0;
+    uint64_t s_saves = 0, s_save_failures = 0;
+
+    // spawns per second is taken between writes
+    uint64_t s_last_spawns = 0;
+    clock::time_point s_last_write{};
+    clock::time_point s_started = clock::now();
+
+    std::string s_game_dir;
+    std::string s_text;
+
+    trace_t (*s_engine_trace)(gvec3_cref_t start, gvec3_cptr_t mins, gvec3_cptr_t maxs, gvec3_cref_t end, const edict_t* passent, contents_t contentmask) = nullptr;
+
+    trace_t HookTrace(gvec3_cref_t start, gvec3_cptr_t mins, gvec3_cptr_t maxs, gvec3_cref_t end, const edict_t* passent, contents_t contentmask) {
+        s_traces++;
+        return s_engine_trace(start, mins, maxs, end, passent, contentmask);
+    }
+
+    void Metric(const char* name, const char* type, const char* help, double value) {
+        fmt::format_to(std::back_inserter(s_text), "# HELP {0} {1}\n# TYPE {0} {2}\n{0} {3}\n", name, help, type, value);
+    }
+
+    void Histogram(const histogram_t& histogram) {
+        fmt::format_to(std::back_inserter(s_text), "# HELP {0} {1}\n# TYPE {0} histogram\n", histogram.name, histogram.help);
+
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < histogram.bounds.size(); i++) {
+            cumulative += histogram.buckets[i];
+            fmt::format_to(std::back_inserter(s_text), "{}_bucket{{le=\"{}\"}} {}\n", histogram.name, histogram.bounds[i], cumulative);
+        }
+        cumulative += histogram.buckets[histogram.bounds.size()];
+
+        fmt::format_to(std::back_inserter(s_text), "{0}_bucket{{le=\"+Inf\"}} {1}\n{0}_sum {2}\n{0}_count {3}\n",
+            histogram.name, cumulative, histogram.sum, histogram.count);
+    }
+
+    // Everything in exposition format into s_text
+    void Render() {
+        const clock::time_point now = clock::now();
+        const double since_write = s_last_write == clock::time_point{} ?
+            std::chrono::duration<double>(now - s_started).count() : std::chrono::duration<double>(now - s_last_write).count();
+        const uint64_t spawns = s_counters[MONSTER_SPAWNS];
+
+        uint32_t in_use = 0;
+        for (uint32_t i = 0; i < globals.num_edicts; i++)
+            if (g_edicts[i].inuse)
+                in_use++;
+
+        uint32_t players = 0;
+        for (auto player : active_players()) {
+            (void) player;
+            players++;
+        }
+
+        s_text.clear();
+
+        Metric("horde_uptime_seconds", "gauge", "Seconds since the game DLL loaded.", std::chrono::duration<double>(now - s_started).count());
+        Metric("horde_frames_total", "counter", "Game frames run.", static_cast<double>(s_frames));
+        Histogram(s_frame_time);
+        Metric("horde_edicts_in_use", "gauge", "Edicts in use.", in_use);
+        Metric("horde_edicts_allocated", "gauge", "Edict slots handed out so far (num_edicts).", globals.num_edicts);
+        Metric("horde_monsters_alive", "gauge", "Live horde monsters.", g_horde->integer ? GetStroggsNum() : 0);
+        Metric("horde_players", "gauge", "Players in game.", players);
+        Metric("horde_wave", "gauge", "Current horde wave.", g_horde_local.level);
+        Metric("horde_monster_spawns_total", "counter", "Monsters spawned by the horde.", static_cast<double>(spawns));
+        Metric("horde_monster_spawns_per_second", "gauge", "Monster spawns per second since the last write.",
+            since_write > 0 ? (spawns - s_last_spawns) / since_write : 0);
+        Metric("horde_traces_total", "counter", "gi.trace calls.", static_cast<double>(s_traces));
+        Histogram(s_frame_traces);
+        Metric("horde_damage_events_total", "counter", "T_Damage calls.", static_cast<double>(s_counters[DAMAGE_EVENTS]));
+        Metric("horde_menu_updates_total", "counter", "Menu layouts sent to clients.", static_cast<double>(s_counters[MENU_UPDATES]));
+        Metric("horde_character_saves_total", "counter", "Character saves.", static_cast<double>(s_saves));
+        Metric("horde_character_save_failures_total", "counter", "Character saves that rolled back.", static_cast<double>(s_save_failures));
+        Histogram(s_save_time);
+
+        s_last_spawns = spawns;
+        s_last_write = now;
+    }
+
+    fs::path OutputPath() {
+        return fs::path(s_game_dir) / (g_metrics_path->string[0] ? g_metrics_path->string : "metrics/horde.prom");
+    }
+
+    bool Write() {
+        Render();
+
+        const fs::path path = OutputPath();
+        fs::path temp_path = path;
+        temp_path += ".tmp";
+
+        std::error_code error;
+        if (path.has_parent_path())
+            fs::create_directories(path.parent_path(), error);
+
+        FILE* fp = fopen(temp_path.string().c_str(), "wb");
+        if (!fp) {
+            if (developer->integer)
+                gi.Com_PrintFmt("Metrics: Could not write {}\n", temp_path.string());
+            return false;
+        }
+
+        const bool written = fwrite(s_text.data(), 1, s_text.size(), fp) == s_text.size();
+        fclose(fp);
+
+        if (written)
+            fs::rename(temp_path, path, error);
+
+        if (!written || error) {
+            if (developer->integer)
+                gi.Com_PrintFmt("Metrics: Could not write {}\n", path.string());
+            fs::remove(temp_path, error);
+            return false;
+        }
+
+        return true;
+    }
+
+} // namespace
+
+void Init(const std::string& game_dir) {
+    s_game_dir = game_dir;
+}
+
+void HookImports() {
+    s_engine_trace = gi.game_import_t::trace;
+    gi.game_import_t::trace = HookTrace;
+}
+
+void Count(Counter counter) {
+    s_counters[counter]++;
+}
+
+void FrameTime(double seconds) {
+    s_frames++;
+    s_frame_time.Observe(seconds);
+}
+
+void CharacterSaved(bool ok, double seconds) {
+    s_saves++;
+    if (!ok)
+        s_save_failures++;
+    s_save_time.Observe(seconds);
+}
+
+void EndFrame() {
+    s_frame_traces.Observe(static_cast<double>(s_traces - s_frame_trace_start));
+    s_frame_trace_start = s_traces;
+
+    const float interval = g_metrics_interval->value;
+
+    if (interval <= 0 || s_game_dir.empty())
+        return;
+
+    if (s_last_write != clock::time_point{} &&
+        clock::now() - s_last_write < std::chrono::duration<float>(interval))
+        return;
+
+    Write();
+}
+
+void PrintStats() {
+    if (s_game_dir.empty()) {
+        gi.Com_Print("Metrics: no game directory yet\n");
+        return;
+    }
+
+    const bool written = Write();
+
+    gi.Com_PrintFmt("{}", s_text);
+    gi.Com_PrintFmt("=== Metrics: {} {} (every {}s) ===\n", written ? "wrote" : "failed to write",
+        OutputPath().string(), g_metrics_interval->value);
+}
+
+} // namespace Metrics
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "../g_local.h"
+#include <string>
+
+// ============================================================================
+// Metrics - counters and histograms for live servers
+// ============================================================================
+// The DLL keeps a handful of counters (frames, monster spawns, traces, damage
+// events, menu sends, character saves) and histograms (frame time, traces per
+// frame, character save latency), and every g_metrics_interval seconds writes
+// them, with a few gauges sampled at write time (edicts, monsters alive,
+// players, wave), to g_metrics_path under the game directory in Prometheus
+// text exposition format. The file is written to a temporary name and renamed
+// into place, so node_exporter's textfile collector never reads half of it.
+// No sockets: scraping is the exporter's job. g_metrics_interval 0 turns the
+// file off; the counters are kept either way.
+
+namespace Metrics {
+
+    enum Counter : uint8_t {
+        MONSTER_SPAWNS,
+        DAMAGE_EVENTS,
+        MENU_UPDATES,
+        COUNTER_COUNT
+    };
+
+    // Remember the game directory the file goes under (InitGame)
+    void Init(const std::string& game_dir);
+
+    // Install the trace counter into gi (GetGameAPI)
+    void HookImports();
+
+    void Count(Counter counter);
+
+    // One G_RunFrame_ took `seconds`
+    void FrameTime(double seconds);
+
+    // Character_Save finished
+    void CharacterSaved(bool ok, double seconds);
+
+    // After the frame: close out per-frame counts, write the file when due
+    void EndFrame();
+
+    // sv metrics: write the file now and print what went into it
+    void PrintStats();
+
+} // namespace Metrics
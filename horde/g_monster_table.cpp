@@ -0,0 +1,315 @@
+#include "g_monster_table.h"
+#include <chrono>
+
+namespace MonsterTable {
+
+namespace {
+
+    table_t s_table;
+    std::array<int32_t, MAX_EDICTS> s_row;      // row in s_table, -1 if none
+
+    void (*s_engine_linkentity)(edict_t* ent) = nullptr;
+    void (*s_engine_unlinkentity)(edict_t* ent) = nullptr;
+
+    template<typename Fn>
+    void ForEachColumn(table_t& table, Fn&& fn) {
+        fn(table.index);
+        fn(table.origin_x); fn(table.origin_y); fn(table.origin_z);
+        fn(table.velocity_x); fn(table.velocity_y); fn(table.velocity_z);
+        fn(table.radius);
+        fn(table.health);
+        fn(table.deadflag);
+        fn(table.enemy);
+        fn(table.type);
+        fn(table.flags);
+        fn(table.moved);
+    }
+
+    size_t RowBytes() {
+        size_t bytes = 0;
+        ForEachColumn(s_table, [&bytes](auto& column) { bytes += sizeof(column[0]); });
+        return bytes;
+    }
+
+    // `ent` into `row`; enemy numbers are relative to `base`
+    void Fill(table_t& table, size_t row, const edict_t* ent, const edict_t* base) {
+        if (table.origin_x[row] != ent->s.origin.x || table.origin_y[row] != ent->s.origin.y || table.origin_z[row] != ent->s.origin.z)
+            table.moved[row] = level.time;
+
+        table.origin_x[row] = ent->s.origin.x;
+        table.origin_y[row] = ent->s.origin.y;
+        table.origin_z[row] = ent->s.origin.z;
+        table.velocity_x[row] = ent->velocity.x;
+        table.velocity_y[row] = ent->velocity.y;
+        table.velocity_z[row] = ent->velocity.z;
+        table.radius[row] = std::max({ ent->maxs.x, -ent->mins.x, ent->maxs.y, -ent->mins.y });
+        table.health[row] = ent->health;
+        table.deadflag[row] = ent->deadflag;
+        table.enemy[row] = ent->enemy ? static_cast<uint32_t>(ent->enemy - base) : 0;
+        table.type[row] = ent->monsterinfo.monster_type_id;
+        table.flags[row] = (ent->monsterinfo.IS_BOSS ? FLAG_BOSS : 0) |
+            (ent->monsterinfo.isfriendlyspawn ? FLAG_FRIENDLY : 0) |
+            ((ent->monsterinfo.aiflags & AI_DO_NOT_COUNT) ? FLAG_UNCOUNTED : 0);
+    }
+
+    size_t Append(table_t& table, const edict_t* ent, const edict_t* base) {
+        const size_t row = table.size();
+        ForEachColumn(table, [](auto& column) { column.emplace_back(); });
+        table.index[row] = static_cast<uint32_t>(ent - base);
+        table.moved[row] = level.time;
+        Fill(table, row, ent, base);
+        return row;
+    }
+
+    void Erase(uint32_t index) {
+        const int32_t row = s_row[index];
+        if (row < 0)
+            return;
+
+        s_row[s_table.index.back()] = row;
+        ForEachColumn(s_table, [row](auto& column) {
+            column[row] = column.back();
+            column.pop_back();
+        });
+        s_row[index] = -1;
+    }
+
+    void Update(const edict_t* ent) {
+        const uint32_t index = ent - g_edicts;
+        if (index >= MAX_EDICTS)
+            return;
+
+        if (!ent->inuse || !(ent->svflags & SVF_MONSTER)) {
+            Erase(index);
+            return;
+        }
+
+        if (s_row[index] < 0)
+            s_row[index] = static_cast<int32_t>(Append(s_table, ent, g_edicts));
+        else
+            Fill(s_table, s_row[index], ent, g_edicts);
+    }
+
+    void LinkEntity(edict_t* ent) {
+        s_engine_linkentity(ent);
+        Update(ent);
+    }
+
+    // an unlinked monster keeps its row; only freeing it or relinking it as something else drops it
+    void UnlinkEntity(edict_t* ent) {
+        s_engine_unlinkentity(ent);
+        Update(ent);
+    }
+
+    // --- sv monsterbench ---
+
+    constexpr size_t PROBES = 8;
+    constexpr float PROBE_RADIUS = 256.f;
+    constexpr uint32_t ATTACKER_SLOTS = 32;
+
+    struct probe_set_t {
+        std::array<vec3_t, PROBES> points;
+    };
+
+    // the passes as they read edicts: every slot from `first`, active_monsters' filter
+    int32_t CountEdicts(std::span<const edict_t> edicts, uint32_t first) {
+        int32_t count = 0;
+        for (uint32_t i = first; i < edicts.size(); i++) {
+            const edict_t& ent = edicts[i];
+            if (ent.inuse && (ent.svflags & SVF_MONSTER) && !ent.deadflag && ent.health > 0 && !(ent.monsterinfo.aiflags & AI_DO_NOT_COUNT))
+                count++;
+        }
+        return count;
+    }
+
+    int32_t AttackersEdicts(std::span<const edict_t> edicts, uint32_t first) {
+        std::array<int32_t, ATTACKER_SLOTS + 1> counts{};
+        for (uint32_t i = first; i < edicts.size(); i++) {
+            const edict_t& ent = edicts[i];
+            if (!ent.inuse || !(ent.svflags & SVF_MONSTER) || ent.deadflag || ent.health <= 0 || ent.monsterinfo.isfriendlyspawn || !ent.enemy)
+                continue;
+            const size_t enemy = ent.enemy - edicts.data();
+            if (enemy >= 1 && enemy <= ATTACKER_SLOTS)
+                counts[enemy]++;
+        }
+        return *std::max_element(counts.begin(), counts.end());
+    }
+
+    int32_t NearEdicts(std::span<const edict_t> edicts, uint32_t first, const probe_set_t& probes) {
+        int32_t count = 0;
+        for (uint32_t i = first; i < edicts.size(); i++) {
+            const edict_t& ent = edicts[i];
+            if (!ent.inuse || !(ent.svflags & SVF_MONSTER) || ent.deadflag || ent.health <= 0)
+                continue;
+            for (const vec3_t& point : probes.points)
+                count += (ent.s.origin - point).lengthSquared() < PROBE_RADIUS * PROBE_RADIUS;
+        }
+        return count;
+    }
+
+    // the same passes over rows
+    int32_t CountRows(const table_t& table) {
+        int32_t count = 0;
+        for (size_t row = 0; row < table.size(); row++)
+            count += table.alive(row) && !(table.flags[row] & FLAG_UNCOUNTED);
+        return count;
+    }
+
+    int32_t AttackersRows(const table_t& table) {
+        std::array<int32_t, ATTACKER_SLOTS + 1> counts{};
+        for (size_t row = 0; row < table.size(); row++) {
+            const uint32_t enemy = table.enemy[row];
+            if (table.alive(row) && !(table.flags[row] & FLAG_FRIENDLY) && enemy >= 1 && enemy <= ATTACKER_SLOTS)
+                counts[enemy]++;
+        }
+        return *std::max_element(counts.begin(), counts.end());
+    }
+
+    int32_t NearRows(const table_t& table, const probe_set_t& probes) {
+        int32_t count = 0;
+        for (size_t row = 0; row < table.size(); row++) {
+            if (!table.alive(row))
+                continue;
+            for (const vec3_t& point : probes.points) {
+                const float dx = table.origin_x[row] - point.x, dy = table.origin_y[row] - point.y, dz = table.origin_z[row] - point.z;
+                count += dx * dx + dy * dy + dz * dz < PROBE_RADIUS * PROBE_RADIUS;
+            }
+        }
+        return count;
+    }
+
+    template<typename Pass>
+    double TimePass(int64_t iterations, int64_t& sink, Pass&& pass) {
+        using clock = std::chrono::steady_clock;
+        const auto began = clock::now();
+        for (int64_t i = 0; i < iterations; i++)
+            sink += pass();
+        return std::chrono::duration<double, std::nano>(clock::now() - began).count() / iterations;
+    }
+
+    void BenchPasses(const char* label, std::span<const edict_t> edicts, uint32_t first, const table_t& table, const probe_set_t& probes, int64_t iterations) {
+        int64_t sink = 0;
+
+        const double count_edicts = TimePass(iterations, sink, [&] { return CountEdicts(edicts, first); });
+        const double count_rows = TimePass(iterations, sink, [&] { return CountRows(table); });
+        const double attackers_edicts = TimePass(iterations, sink, [&] { return AttackersEdicts(edicts, first); });
+        const double attackers_rows = TimePass(iterations, sink, [&] { return AttackersRows(table); });
+        const double near_edicts = TimePass(iterations, sink, [&] { return NearEdicts(edicts, first, probes); });
+        const double near_rows = TimePass(iterations, sink, [&] { return NearRows(table, probes); });
+
+        gi.Com_PrintFmt("{}: {} rows, {} edict slots scanned\n", label, table.size(), edicts.size() - first);
+        gi.Com_PrintFmt("  live count:      {:>8.0f} ns edicts, {:>8.0f} ns rows\n", count_edicts, count_rows);
+        gi.Com_PrintFmt("  attacker counts: {:>8.0f} ns edicts, {:>8.0f} ns rows\n", attackers_edicts, attackers_rows);
+        gi.Com_PrintFmt("  near {} probes:   {:>8.0f} ns edicts, {:>8.0f} ns rows\n", PROBES, near_edicts, near_rows);
+
+        if (CountEdicts(edicts, first) != CountRows(table) || AttackersEdicts(edicts, first) != AttackersRows(table) ||
+            NearEdicts(edicts, first, probes) != NearRows(table, probes))
+            gi.Com_PrintFmt("  WARNING: table and edict passes disagree\n");
+
+        (void) sink;
+    }
+
+} // namespace
+
+void HookImports() {
+    s_row.fill(-1);
+
+    s_engine_linkentity = gi.linkentity;
+    s_engine_unlinkentity = gi.unlinkentity;
+    gi.linkentity = LinkEntity;
+    gi.unlinkentity = UnlinkEntity;
+}
+
+void Reset() {
+    ForEachColumn(s_table, [](auto& column) { column.clear(); });
+    s_row.fill(-1);
+}
+
+void Rebuild() {
+    Reset();
+
+    for (uint32_t i = 1; i < globals.num_edicts; i++)
+        Update(&g_edicts[i]);
+}
+
+void Refresh(const edict_t* ent) {
+    const uint32_t index = ent - g_edicts;
+    if (index < MAX_EDICTS && s_row[index] >= 0)
+        Update(ent);
+}
+
+void Remove(const edict_t* ent) {
+    const uint32_t index = ent - g_edicts;
+    if (index < MAX_EDICTS)
+        Erase(index);
+}
+
+const table_t& Table() {
+    return s_table;
+}
+
+int32_t Row(const edict_t* ent) {
+    const uint32_t index = ent - g_edicts;
+    return index < MAX_EDICTS ? s_row[index] : -1;
+}
+
+void Bench() {
+    const int64_t requested = gi.argc() > 2 ? strtoll(gi.argv(2), nullptr, 10) : 0;
+    const int64_t iterations = requested > 0 ? requested : 10'000;
+
+    gi.Com_PrintFmt("=== Monster Table ({} bytes per row, edict_t stride {} bytes) ===\n", RowBytes(), sizeof(edict_t));
+
+    pcg32_t rng(rng_seed, 11);
+    auto random_in = [&rng](float lo, float hi) { return lo + (hi - lo) * (static_cast<float>(rng() >> 8) * 0x1p-24f); };
+
+    probe_set_t probes;
+    for (vec3_t& point : probes.points)
+        point = { random_in(-1024, 1024), random_in(-1024, 1024), random_in(-256, 256) };
+
+    // synthetic: 200 live monsters spread over 1024 edict slots, as a busy wave leaves them
+    // among items, gibs and projectiles; 32 slots up front stand in for the clients
+    {
+        constexpr uint32_t SLOTS = 1024, FIRST = ATTACKER_SLOTS + 1, MONSTERS = 200;
+        // zeroed like the engine's edict block (edict_t has no default constructor)
+        std::vector<std::byte> storage(SLOTS * sizeof(edict_t));
+        edict_t* const edicts = reinterpret_cast<edict_t*>(storage.data());
+        table_t table;
+
+        for (uint32_t i = 0; i < MONSTERS; i++) {
+            edict_t& ent = edicts[FIRST + i * ((SLOTS - FIRST) / MONSTERS)];
+            ent.inuse = true;
+            ent.svflags = SVF_MONSTER;
+            ent.health = 100;
+            ent.s.origin = { random_in(-1024, 1024), random_in(-1024, 1024), random_in(-256, 256) };
+            ent.mins = { -16, -16, -24 };
+            ent.maxs = { 16, 16, 32 };
+            ent.enemy = &edicts[1 + (rng() % 8)];
+            Append(table, &ent, edicts);
+        }
+
+        BenchPasses("200 monsters in 1024 slots", { edicts, SLOTS }, FIRST, table, probes, iterations);
+    }
+
+    // this map
+    if (globals.num_edicts > 0) {
+        const uint32_t first = game.maxclients + static_cast<uint32_t>(BODY_QUEUE_SIZE) + 1U;
+        if (first < globals.num_edicts)
+            BenchPasses("this map", { g_edicts, globals.num_edicts }, first, s_table, probes, iterations);
+
+        // rows that no longer match their edict; should stay 0
+        uint32_t live = 0, stale = 0;
+        for (edict_t* ent : active_monsters()) {
+            (void) ent;
+            live++;
+        }
+        for (size_t row = 0; row < s_table.size(); row++) {
+            const edict_t* ent = s_table.edict(row);
+            if (!ent->inuse || !(ent->svflags & SVF_MONSTER) || s_table.health[row] != ent->health ||
+                s_table.deadflag[row] != ent->deadflag || s_table.origin(row) != ent->s.origin)
+                stale++;
+        }
+        gi.Com_PrintFmt("{} active monsters, {} rows, {} stale\n", live, s_table.size(), stale);
+    }
+}
+
+} // namespace MonsterTable
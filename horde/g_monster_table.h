@@ -0,0 +1,71 @@
+#pragma once
+
+#include "../g_local.h"
+#include <vector>
+
+// ============================================================================
+// Monster Table - the hot monster fields, one array per field
+// ============================================================================
+// The per-frame horde passes (live strogg count, attacker counts, stuck
+// checks, repulsion neighbours, proximity grid, body cleanup) each walked
+// the edict array and read a few fields out of every multi-kilobyte edict_t,
+// monsters or not. This table keeps the fields those passes filter on in
+// parallel arrays, one row per in-use SVF_MONSTER edict: origin, velocity,
+// horizontal radius, health, deadflag, enemy, type ID, a few flags and the
+// time the monster last moved. Rows are added and refreshed by the hooked
+// gi.linkentity, refreshed after the monster runs its frame and after
+// T_Damage, and dropped when the edict is freed or relinked as something
+// else, so a pass reads only rows and touches an edict only to act on it.
+// Removal swaps the last row into the hole; loops that may free monsters
+// walk the rows backwards.
+// "sv monsterbench" times the passes over the table against edict scans.
+
+namespace MonsterTable {
+
+    // flags
+    constexpr uint8_t FLAG_BOSS = 1;        // monsterinfo.IS_BOSS
+    constexpr uint8_t FLAG_FRIENDLY = 2;    // monsterinfo.isfriendlyspawn
+    constexpr uint8_t FLAG_UNCOUNTED = 4;   // AI_DO_NOT_COUNT
+
+    struct table_t {
+        std::vector<uint32_t> index;                // edict number
+        std::vector<float>    origin_x, origin_y, origin_z;
+        std::vector<float>    velocity_x, velocity_y, velocity_z;
+        std::vector<float>    radius;               // largest horizontal half-extent
+        std::vector<int32_t>  health;
+        std::vector<uint8_t>  deadflag;
+        std::vector<uint32_t> enemy;                // edict number, 0 = none
+        std::vector<uint8_t>  type;                 // horde::MonsterTypeID
+        std::vector<uint8_t>  flags;
+        std::vector<gtime_t>  moved;                // level.time its origin last changed
+
+        inline size_t size() const { return index.size(); }
+        inline bool alive(size_t row) const { return health[row] > 0 && !deadflag[row]; }
+        inline vec3_t origin(size_t row) const { return { origin_x[row], origin_y[row], origin_z[row] }; }
+        inline edict_t* edict(size_t row) const { return &g_edicts[index[row]]; }
+    };
+
+    // Install the linkentity/unlinkentity hooks into gi (GetGameAPI)
+    void HookImports();
+
+    // Drop every row (map change)
+    void Reset();
+
+    // Rows for the monsters of a loaded savegame
+    void Rebuild();
+
+    // Re-read `ent`'s row, if it has one; after it ran its frame or took damage
+    void Refresh(const edict_t* ent);
+
+    // Drop `ent`'s row (G_FreeEdict)
+    void Remove(const edict_t* ent);
+
+    const table_t& Table();
+
+    // `ent`'s row, or -1
+    int32_t Row(const edict_t* ent);
+
+    // sv monsterbench [iterations]
+    void Bench();
+
+} // namespace MonsterTable
@@ -0,0 +1,82 @@
+#include "g_push_index.h"
+
+namespace PushIndex {
+
+namespace {
+
+    std::vector<uint32_t> s_nonsolid;
+    std::array<int32_t, MAX_EDICTS> s_slot;     // position in s_nonsolid, -1 if not indexed
+
+    void (*s_engine_linkentity)(edict_t* ent) = nullptr;
+    void (*s_engine_unlinkentity)(edict_t* ent) = nullptr;
+
+    void Remove(uint32_t index) {
+        if (index >= MAX_EDICTS)
+            return;
+
+        const int32_t slot = s_slot[index];
+        if (slot < 0)
+            return;
+
+        const uint32_t last = s_nonsolid.back();
+        s_slot[last] = slot;
+        s_nonsolid[slot] = last;
+        s_nonsolid.pop_back();
+
+        s_slot[index] = -1;
+    }
+
+    void Update(const edict_t* ent) {
+        const uint32_t index = ent - g_edicts;
+        if (index >= MAX_EDICTS)
+            return;
+
+        if (!ent->inuse || !ent->linked || ent->solid != SOLID_NOT) {
+            Remove(index);
+            return;
+        }
+
+        if (s_slot[index] < 0) {
+            s_slot[index] = static_cast<int32_t>(s_nonsolid.size());
+            s_nonsolid.push_back(index);
+        }
+    }
+
+    void LinkEntity(edict_t* ent) {
+        s_engine_linkentity(ent);
+        Update(ent);
+    }
+
+    void UnlinkEntity(edict_t* ent) {
+        s_engine_unlinkentity(ent);
+        Remove(ent - g_edicts);
+    }
+
+} // namespace
+
+void HookImports() {
+    s_slot.fill(-1);
+
+    s_engine_linkentity = gi.linkentity;
+    s_engine_unlinkentity = gi.unlinkentity;
+    gi.linkentity = LinkEntity;
+    gi.unlinkentity = UnlinkEntity;
+}
+
+void Reset() {
+    s_nonsolid.clear();
+    s_slot.fill(-1);
+}
+
+void Rebuild() {
+    Reset();
+
+    for (uint32_t i = 1; i < globals.num_edicts; i++)
+        Update(&g_edicts[i]);
+}
+
+const std::vector<uint32_t>& NonSolid() {
+    return s_nonsolid;
+}
+
+} // namespace PushIndex
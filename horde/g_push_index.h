@@ -0,0 +1,30 @@
+#pragma once
+
+#include "../g_local.h"
+#include <vector>
+
+// ============================================================================
+// Push Index - the linked SOLID_NOT edicts a mover may have to carry
+// ============================================================================
+// SV_Push finds solid and trigger candidates through area queries, but the
+// engine keeps no area list for SOLID_NOT edicts. This index holds every edict
+// whose last gi.linkentity left it linked as SOLID_NOT, kept current through
+// the hooked gi.linkentity/unlinkentity, so it is never staler than the link
+// state the engine itself uses. Rows are edict numbers, not pointers, so a
+// savegame load that reallocates g_edicts can't leave it dangling.
+
+namespace PushIndex {
+
+    // Install the linkentity/unlinkentity hooks into gi (GetGameAPI)
+    void HookImports();
+
+    // Forget every entry (map change)
+    void Reset();
+
+    // Index the edicts of a loaded savegame
+    void Rebuild();
+
+    // Edict numbers of the linked SOLID_NOT edicts, in no particular order
+    const std::vector<uint32_t>& NonSolid();
+
+} // namespace PushIndex
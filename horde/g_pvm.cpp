@@ -5,6 +5,8 @@
 #include <vector>
 #include <boost/container/small_vector.hpp>
 #include <algorithm>
+#include <array>
+#include <string>
 
 // PvM (Player vs Monster) mode implementation
 // - Backpack drops on death with all weapons/ammo
@@ -16,14 +18,147 @@
 // Backpack despawn time
 constexpr gtime_t BACKPACK_DESPAWN_TIME = 60_sec;
 
+// A death this close to a backpack still on the ground adds to it instead of dropping another
+constexpr float BACKPACK_MERGE_RADIUS = 128.0f;
+
+// Backpacks alive at once; past this the oldest despawns first. The lower cap
+// applies while the level is short of edicts.
+constexpr size_t BACKPACK_MAX = 24;
+constexpr size_t BACKPACK_MAX_UNDER_PRESSURE = 6;
+constexpr float BACKPACK_EDICT_PRESSURE = 0.85f;    // fraction of maxentities in use
+constexpr gtime_t BACKPACK_PRESSURE_CHECK_INTERVAL = 1_sec;
+
 // Default PvM respawn weapon
 constexpr const char *DEFAULT_PVM_WEAPON = "Rocket Launcher";
 constexpr int DEFAULT_PVM_ROCKETS = 10;
 
 // Forward declarations
 extern const char *GetPlayerName(const edict_t *player);
-void PVM_BackpackThink(edict_t *backpack);
-void PVM_BackpackTouch(edict_t *backpack, edict_t *other, const trace_t &tr, bool other_touching_self);
+
+// Backpack registry. The packs are SOLID_NOT edicts with no think or touch of
+// their own: the contents live here, and PVM_RunBackpacks does pickup and
+// despawn for all of them once a frame. That keeps them out of the trigger
+// touch checks and stops each one carrying a whole gclient_t for its inventory.
+namespace
+{
+    struct pvm_backpack_t
+    {
+        edict_t *ent;
+        int32_t spawn_count;                        // ent is still ours while this matches
+        gtime_t dropped;                            // last drop into it; oldest despawns first
+        gtime_t expires;
+        std::array<int32_t, IT_TOTAL> inventory;
+        std::string owner;                          // first dropper
+        int32_t drops;
+    };
+
+    std::vector<pvm_backpack_t> s_backpacks;
+    bool s_edict_pressure = false;
+    gtime_t s_next_pressure_check = 0_ms;
+
+    inline bool BackpackValid(const pvm_backpack_t &pack)
+    {
+        return pack.ent->inuse && pack.ent->spawn_count == pack.spawn_count;
+    }
+
+    bool EdictPressure()
+    {
+        if (level.time < s_next_pressure_check)
+            return s_edict_pressure;
+
+        s_next_pressure_check = level.time + BACKPACK_PRESSURE_CHECK_INTERVAL;
+
+        uint32_t in_use = 0;
+        for (uint32_t i = 0; i < globals.num_edicts; i++)
+            if (g_edicts[i].inuse)
+                in_use++;
+
+        s_edict_pressure = in_use >= static_cast<uint32_t>(game.maxentities * BACKPACK_EDICT_PRESSURE);
+        return s_edict_pressure;
+    }
+
+    // Drop registry entry `i`, freeing its edict if it's still the backpack
+    void RemoveBackpack(size_t i, bool despawn_sound)
+    {
+        pvm_backpack_t &pack = s_backpacks[i];
+        if (BackpackValid(pack))
+        {
+            if (despawn_sound)
+                gi.sound(pack.ent, CHAN_AUTO, gi.soundindex("items/respawn1.wav"), 1, ATTN_IDLE, 0);
+            G_FreeEdict(pack.ent);
+        }
+
+        s_backpacks.erase(s_backpacks.begin() + i);
+    }
+
+    // Despawn oldest-first until at most `max_packs` remain
+    void EnforceBackpackCap(size_t max_packs)
+    {
+        while (s_backpacks.size() > max_packs)
+        {
+            size_t oldest = 0;
+            for (size_t i = 1; i < s_backpacks.size(); i++)
+                if (s_backpacks[i].dropped < s_backpacks[oldest].dropped)
+                    oldest = i;
+
+            RemoveBackpack(oldest, true);
+        }
+    }
+
+    inline size_t BackpackCap()
+    {
+        return EdictPressure() ? BACKPACK_MAX_UNDER_PRESSURE : BACKPACK_MAX;
+    }
+
+    // Give all items from backpack to picker
+    void PickupBackpack(const pvm_backpack_t &pack, edict_t *other)
+    {
+        int weapons_picked = 0;
+        int ammo_picked = 0;
+
+        for (int i = 0; i < IT_TOTAL; i++)
+        {
+            int count = pack.inventory[i];
+            if (count > 0)
+            {
+                const gitem_t *item = GetItemByIndex((item_id_t)i);
+                if (!item)
+                    continue;
+
+                // Skip techs - they should stay in the world as pickups
+                if (item->flags & IF_TECH || item->flags & IF_ARMOR) //||  item->flags & IF_POWERUP)
+                {
+                    //    gi.Com_PrintFmt("PVM: Backpack skipping tech {}\n", item->classname);
+                    continue;
+                }
+
+                // Add to player's inventory
+                other->client->pers.inventory[i] += count;
+
+                // Clamp to max
+                if (item->ammo && item->ammo < IT_TOTAL)
+                {
+                    int max_ammo = other->client->pers.max_ammo[item->ammo];
+                    if (other->client->pers.inventory[i] > max_ammo)
+                        other->client->pers.inventory[i] = max_ammo;
+                    ammo_picked++;
+                }
+                else if (item->flags & IF_WEAPON)
+                {
+                    weapons_picked++;
+                }
+            }
+        }
+
+        // Play pickup sound
+        gi.sound(other, CHAN_AUTO, gi.soundindex("items/pkup.wav"), 1, ATTN_NORM, 0);
+
+        // Notify player
+        // gi.LocClient_Print(other, PRINT_HIGH, nullptr,
+        //                    "Picked up {}'s backpack ({} weapons, {} ammo types)\n",
+        //                    pack.owner, weapons_picked, ammo_picked);
+    }
+} // namespace
 
 // Drop backpack on player death
 void PVM_DropBackpack(edict_t *player)
@@ -31,6 +166,39 @@ void PVM_DropBackpack(edict_t *player)
     if (!player || !player->client)
         return;
 
+    const vec3_t drop_origin = player->s.origin + vec3_t{ 0, 0, 16 }; // Lift it up slightly
+
+    // Add to the nearest backpack already resting on the ground here, if any;
+    // one still in flight could land anywhere, so it drops its own instead
+    pvm_backpack_t *nearest = nullptr;
+    float nearest_dist_sq = BACKPACK_MERGE_RADIUS * BACKPACK_MERGE_RADIUS;
+    for (pvm_backpack_t &pack : s_backpacks)
+    {
+        if (!BackpackValid(pack) || !pack.ent->groundentity)
+            continue;
+
+        const float dist_sq = DistanceSquared(pack.ent->s.origin, drop_origin);
+        if (dist_sq <= nearest_dist_sq)
+        {
+            nearest = &pack;
+            nearest_dist_sq = dist_sq;
+        }
+    }
+
+    if (nearest)
+    {
+        for (int i = 0; i < IT_TOTAL; i++)
+            nearest->inventory[i] += player->client->pers.inventory[i];
+        nearest->drops++;
+        nearest->dropped = level.time;
+        nearest->expires = level.time + BACKPACK_DESPAWN_TIME;
+        //   gi.Com_PrintFmt("PVM: Merged {}'s backpack into {}'s ({} drops)\n", player->client->pers.netname, nearest->owner, nearest->drops);
+        return;
+    }
+
+    // Make room for it first, so the new pack isn't the one that goes
+    EnforceBackpackCap(BackpackCap() - 1);
+
     // Create backpack entity
     edict_t *backpack = G_Spawn();
     if (!backpack)
@@ -40,48 +208,18 @@ void PVM_DropBackpack(edict_t *player)
     }
 
     // Set basic properties
-    backpack->classname = "item_backpack";
+    backpack->classname = "pvm_backpack";
     backpack->s.modelindex = gi.modelindex("models/items/pack/tris.md2");
     backpack->s.effects = EF_GIB; // Only gib effect, no rotate/bob
-    backpack->solid = SOLID_TRIGGER;
+    backpack->solid = SOLID_NOT;  // picked up by PVM_RunBackpacks, not by trigger touch
     backpack->movetype = MOVETYPE_TOSS;
-    backpack->touch = PVM_BackpackTouch;
-    backpack->think = PVM_BackpackThink;
-    backpack->nextthink = level.time + BACKPACK_DESPAWN_TIME;
 
     // Set bounds
     backpack->mins = {-15, -15, -15};
     backpack->maxs = {15, 15, 15};
 
-    // Store owner name for display
-    backpack->message = G_CopyString(player->client->pers.netname, TAG_LEVEL);
-
-    // Copy ALL inventory (weapons and ammo)
-    backpack->client = player->client; // Temporarily link to access inventory
-    for (int i = 0; i < IT_TOTAL; i++)
-    {
-        // Store in backpack's count field (we'll use a custom storage method)
-        // For now, we'll allocate a client structure to store inventory
-    }
-
-    // Create a temporary client structure to store inventory
-    gclient_t *temp_client = (gclient_t *)gi.TagMalloc(sizeof(gclient_t), TAG_LEVEL);
-    if (temp_client)
-    {
-        *temp_client = {};
-        temp_client->pers.inventory = player->client->pers.inventory;
-        backpack->client = temp_client;
-    }
-    else
-    {
-        //     gi.Com_PrintFmt("PVM: Failed to allocate backpack storage\n");
-        G_FreeEdict(backpack);
-        return;
-    }
-
     // Position backpack at player death location
-    backpack->s.origin = player->s.origin;
-    backpack->s.origin[2] += 16; // Lift it up slightly
+    backpack->s.origin = drop_origin;
 
     // Give it some velocity for visual effect
     backpack->velocity[0] = crandom() * 100;
@@ -90,98 +228,68 @@ void PVM_DropBackpack(edict_t *player)
 
     gi.linkentity(backpack);
 
+    // Copy ALL inventory (weapons and ammo)
+    s_backpacks.push_back({ backpack, backpack->spawn_count, level.time, level.time + BACKPACK_DESPAWN_TIME,
+                            player->client->pers.inventory, player->client->pers.netname, 1 });
+
     //   gi.Com_PrintFmt("PVM: Dropped backpack for {}\n", player->client->pers.netname);
 }
 
-// Backpack touch handler (pickup)
-TOUCH(PVM_BackpackTouch)(edict_t *backpack, edict_t *other, const trace_t &tr, bool other_touching_self)->void
+// Backpack pickup and despawn (every frame)
+void PVM_RunBackpacks()
 {
-    if (!other || !other->client)
+    if (s_backpacks.empty())
         return;
 
-    // Don't pick up if dead or spectating
-    if (other->health <= 0 || other->client->resp.spectator)
-        return;
-
-    if (!backpack->client)
+    for (size_t i = s_backpacks.size(); i-- > 0;)
     {
-        //      gi.Com_PrintFmt("PVM: Backpack has no inventory data!\n");
-        G_FreeEdict(backpack);
-        return;
-    }
+        pvm_backpack_t &pack = s_backpacks[i];
 
-    // Give all items from backpack to picker
-    int weapons_picked = 0;
-    int ammo_picked = 0;
+        // freed out from under us (cleanup pass, level reset)
+        if (!BackpackValid(pack))
+        {
+            s_backpacks.erase(s_backpacks.begin() + i);
+            continue;
+        }
 
-    for (int i = 0; i < IT_TOTAL; i++)
-    {
-        int count = backpack->client->pers.inventory[i];
-        if (count > 0)
+        // Despawn after timeout
+        if (level.time >= pack.expires)
         {
-            const gitem_t *item = GetItemByIndex((item_id_t)i);
-            if (!item)
-                continue;
+            RemoveBackpack(i, true);
+            continue;
+        }
 
-            // Skip techs - they should stay in the world as pickups
-            if (item->flags & IF_TECH || item->flags & IF_ARMOR) //||  item->flags & IF_POWERUP)
-            {
-                //    gi.Com_PrintFmt("PVM: Backpack skipping tech {}\n", item->classname);
+        for (edict_t *other : active_players())
+        {
+            // Don't pick up if dead or spectating
+            if (other->health <= 0 || other->client->resp.spectator)
                 continue;
-            }
 
-            // Add to player's inventory
-            other->client->pers.inventory[i] += count;
+            if (!boxes_intersect(other->absmin, other->absmax, pack.ent->absmin, pack.ent->absmax))
+                continue;
 
-            // Clamp to max
-            if (item->ammo && item->ammo < IT_TOTAL)
-            {
-                int max_ammo = other->client->pers.max_ammo[item->ammo];
-                if (other->client->pers.inventory[i] > max_ammo)
-                    other->client->pers.inventory[i] = max_ammo;
-                ammo_picked++;
-            }
-            else if (item->flags & IF_WEAPON)
-            {
-                weapons_picked++;
-            }
+            PickupBackpack(pack, other);
+            RemoveBackpack(i, false);
+            break;
         }
     }
 
-    // Play pickup sound
-    gi.sound(other, CHAN_AUTO, gi.soundindex("items/pkup.wav"), 1, ATTN_NORM, 0);
-
-    // Notify player
-    // const char *owner_name = backpack->message ? backpack->message : "someone";
-    // gi.LocClient_Print(other, PRINT_HIGH, nullptr,
-    //                    "Picked up {}'s backpack ({} weapons, {} ammo types)\n",
-    //                    owner_name, weapons_picked, ammo_picked);
-
-    // Free backpack
-    if (backpack->message)
-        gi.TagFree((void *)backpack->message);
-    if (backpack->client)
-        gi.TagFree(backpack->client);
-
-    G_FreeEdict(backpack);
+    EnforceBackpackCap(BackpackCap());
 }
 
-// Backpack think (despawn after timeout)
-THINK(PVM_BackpackThink)(edict_t *backpack)->void
+// Forget every backpack; a loaded game's packs have no contents to give, so they go too
+void PVM_ResetBackpacks()
 {
-    if (!backpack)
-        return;
-
-    // Despawn effect
-    gi.sound(backpack, CHAN_AUTO, gi.soundindex("items/respawn1.wav"), 1, ATTN_IDLE, 0);
-
-    // Free memory
-    if (backpack->message)
-        gi.TagFree((void *)backpack->message);
-    if (backpack->client)
-        gi.TagFree(backpack->client);
+    s_backpacks.clear();
+    s_edict_pressure = false;
+    s_next_pressure_check = 0_ms;
 
-    G_FreeEdict(backpack);
+    for (uint32_t i = 1; i < globals.num_edicts; i++)
+    {
+        edict_t *ent = &g_edicts[i];
+        if (ent->inuse && ent->classname && !strcmp(ent->classname, "pvm_backpack"))
+            G_FreeEdict(ent);
+    }
 }
 
 // Give player their respawn weapon (called on spawn)
@@ -337,7 +445,7 @@ void PVM_InitRandomMonsters()
     boost::container::small_vector<horde::MonsterTypeID, 16> shuffled = valid_monsters;
     for (int i = 0; i < PVM_RANDOM_MONSTER_COUNT; i++)
     {
-        int j = i + (rand() % (shuffled.size() - i));
+        int j = irandom(i, static_cast<int32_t>(shuffled.size()));
         std::swap(shuffled[i], shuffled[j]);
     }
 
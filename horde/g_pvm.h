@@ -16,9 +16,16 @@
 // Check if PvM mode is active
 bool IsPvMMode();
 
-// Drop backpack on player death (contains all weapons/ammo)
+// Drop backpack on player death (contains all weapons/ammo); a death next to
+// a backpack still on the ground adds to that one instead
 void PVM_DropBackpack(edict_t* player);
 
+// Backpack pickup, despawn and the backpack cap (every frame)
+void PVM_RunBackpacks();
+
+// Forget every backpack and free any left in the level (map change, load)
+void PVM_ResetBackpacks();
+
 // Give player their respawn weapon on spawn
 void PVM_GiveRespawnWeapon(edict_t* player);
 
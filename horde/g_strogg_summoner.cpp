@@ -287,6 +287,7 @@ static edict_t* spawn_strogg_monster(edict_t* player, const vec3_t& origin, cons
 	if (selected_type != horde::MonsterTypeID::UNKNOWN) {
 		g_precached_monster_types_flags[static_cast<size_t>(selected_type)] = true;
 		g_precached_monsters_this_map.insert(selected_type);
+		Horde_InvalidateMonsterSelection();
 	}
 
 	// Verify spawn succeeded
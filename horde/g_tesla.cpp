@@ -3,6 +3,7 @@
 #include "horde_performance.h"
 #include "g_horde_phys.h"
 #include "g_horde_benefits.h"
+#include "../q_vec3_batch.h"
 
 // *************************
 // TESLA - 
@@ -337,24 +338,36 @@ void tesla_chain_lightning(edict_t *self, const tesla_target *tesla_victims, int
 		int chains_from_this_victim = 0;
 		const float max_chain_range_squared = CHAIN_LIGHTNING_RANGE * CHAIN_LIGHTNING_RANGE;
 
+		// Must be a monster to be a chain target. Copied out of the grid's buffer,
+		// since a kill below can run another query over it.
+		boost::container::small_vector<edict_t*, 32> monsters;
+		boost::container::small_vector<vec3_t, 32> monster_origins;
 		for (auto* potential_chain_target : chain_targets)
+		{
+			if (!(potential_chain_target->svflags & SVF_MONSTER))
+				continue;
+
+			monsters.push_back(potential_chain_target);
+			monster_origins.push_back(potential_chain_target->s.origin);
+		}
+
+		// Distance check from victim to potential chain targets
+		boost::container::small_vector<uint32_t, 32> in_range(monsters.size());
+		in_range.resize(batch_in_sphere(std::span<const vec3_t>(monster_origins.data(), monster_origins.size()), victim->s.origin, max_chain_range_squared, in_range.data()));
+
+		for (uint32_t index : in_range)
 		{
 			if (chains_from_this_victim >= MAX_CHAIN_TARGETS_PER_VICTIM)
 				break;
 
-			// Must be a monster to be a chain target
-			if (!(potential_chain_target->svflags & SVF_MONSTER))
+			edict_t* potential_chain_target = monsters[index];
+			if (!potential_chain_target->inuse)
 				continue;
 
 			// Validate the chain target (excludes original tesla targets)
 			if (!is_valid_chain_target(self, potential_chain_target, tesla_victims, num_victims))
 				continue;
 
-			// Distance check from victim to potential chain target
-			float dist_squared = DistanceSquared(victim->s.origin, potential_chain_target->s.origin);
-			if (dist_squared > max_chain_range_squared)
-				continue;
-
 			// Visibility check from victim to chain target
 			if (!visible(victim, potential_chain_target))
 				continue;
@@ -538,8 +551,6 @@ THINK(tesla_think_active)(edict_t* self)->void
 }
 THINK(tesla_activate)(edict_t *self)->void
 {
-	edict_t *search;
-
 	if (gi.pointcontents(self->s.origin) & (CONTENTS_SLIME | CONTENTS_LAVA | CONTENTS_WATER))
 	{
 		tesla_blow(self);
@@ -548,8 +559,7 @@ THINK(tesla_activate)(edict_t *self)->void
 
 	if (G_IsDeathmatch())
 	{
-		search = nullptr;
-		while ((search = findradius(search, self->s.origin, 1.5f * TESLA_DAMAGE_RADIUS)) != nullptr)
+		for (edict_t* search : radius_edicts(self->s.origin, 1.5f * TESLA_DAMAGE_RADIUS))
 		{
 			if (search->classname && ((G_IsDeathmatch() && !g_horde->integer && ((!strncmp(search->classname, "info_player_", 12)) || (!strcmp(search->classname, "misc_teleporter_dest")) || (!strncmp(search->classname, "item_flag_", 10))))) &&
 				(visible(search, self)))
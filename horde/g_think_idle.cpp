@@ -0,0 +1,81 @@
+#include "g_think_idle.h"
+
+namespace ThinkIdle {
+
+namespace {
+
+    // stats
+    uint32_t s_frame_visits = 0, s_frame_idle = 0, s_frame_thinks = 0;
+    uint32_t s_last_visits = 0, s_last_idle = 0, s_last_thinks = 0;
+    uint64_t s_frames = 0, s_total_visits = 0, s_total_idle = 0, s_total_thinks = 0;
+
+    // Whether the per-entity block of the frame walk does nothing for `ent` but
+    // check its nextthink
+    bool ThinkOnly(const edict_t* ent) {
+        if (!ent->inuse || ent->client)
+            return false;
+        if (ent->movetype != MOVETYPE_NONE || ent->prethink || ent->postthink || ent->bmodel_anim.enabled)
+            return false;
+        if (ent->groundentity || ent->takedamage || ent->item)
+            return false;
+        if ((ent->svflags & SVF_MONSTER) || (ent->flags & (FL_TRAP | FL_TRAP_LASER_FIELD)))
+            return false;
+        // the walk copies origin to old_origin; beams keep their end point there
+        return (ent->s.renderfx & RF_BEAM) || ent->s.old_origin == ent->s.origin;
+    }
+
+} // namespace
+
+void BeginFrame() {
+    s_last_visits = s_frame_visits;
+    s_last_idle = s_frame_idle;
+    s_last_thinks = s_frame_thinks;
+    s_total_visits += s_frame_visits;
+    s_total_idle += s_frame_idle;
+    s_total_thinks += s_frame_thinks;
+    s_frame_visits = s_frame_idle = s_frame_thinks = 0;
+    s_frames++;
+}
+
+bool Idle(const edict_t* ent) {
+    if (!g_think_idle->integer)
+        return false;
+
+    // disconnected clients' slots still get their housekeeping
+    if ((ent - g_edicts) <= static_cast<ptrdiff_t>(game.maxclients) || !ThinkOnly(ent))
+        return false;
+
+    // same test SV_RunThink makes
+    const gtime_t thinktime = ent->nextthink;
+    if (thinktime > 0_ms && thinktime <= level.time)
+        return false;
+
+    s_frame_idle++;
+    return true;
+}
+
+void CountVisit() {
+    s_frame_visits++;
+}
+
+void CountThink() {
+    s_frame_thinks++;
+}
+
+void PrintStats() {
+    uint32_t in_use = 0;
+
+    for (uint32_t i = 0; i < globals.num_edicts; i++)
+        if (g_edicts[i].inuse)
+            in_use++;
+
+    const double frames = static_cast<double>(std::max<uint64_t>(s_frames, 1));
+
+    gi.Com_PrintFmt("=== Think Idle ({}) ===\n", g_think_idle->integer ? "on" : "off, g_think_idle 0");
+    gi.Com_PrintFmt("entities: {} in use\n", in_use);
+    gi.Com_PrintFmt("last frame: {} full visits, {} idle, {} thinks\n", s_last_visits, s_last_idle, s_last_thinks);
+    gi.Com_PrintFmt("average over {} frames: {:.1f} full visits, {:.1f} idle, {:.1f} thinks\n",
+        s_frames, s_total_visits / frames, s_total_idle / frames, s_total_thinks / frames);
+}
+
+} // namespace ThinkIdle
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "../g_local.h"
+
+// ============================================================================
+// Think Idle - skip the walk's per-entity block while it would do nothing
+// ============================================================================
+// G_RunFrame_ runs the full per-entity block (ground check, bot state,
+// G_RunEntity) on every edict, every frame, though most of them - triggers,
+// targets, lasers, fading effects - do nothing until their nextthink comes up.
+// The walk still reaches every in-use edict, but one that only thinks
+// (MOVETYPE_NONE, no prethink, postthink or bmodel animation, not a client,
+// monster, item or trap, doesn't take damage, hasn't moved) and whose think
+// isn't due this frame only exports its bot state; the rest of the block
+// would be a no-op for it. The check reads the entity as it is at that point
+// in the walk, so there is no parked state to keep in sync, and thinks still
+// run in edict order on the same frame as before.
+// g_think_idle 0 runs the full block on everything; "sv thinkstats" prints
+// full visits, idle skips and thinks per frame for comparing the two.
+
+namespace ThinkIdle {
+
+    // Roll the per-frame counters; call once before the walk
+    void BeginFrame();
+
+    // Whether the walk's block would do nothing for `ent` this frame beyond its bot state
+    bool Idle(const edict_t* ent);
+
+    // The walk ran the full block on an edict
+    void CountVisit();
+
+    // SV_RunThink ran a think
+    void CountThink();
+
+    // sv thinkstats
+    void PrintStats();
+
+} // namespace ThinkIdle
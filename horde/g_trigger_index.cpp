@@ -0,0 +1,251 @@
+#include "g_trigger_index.h"
+#include <vector>
+
+namespace TriggerIndex {
+
+namespace {
+
+    // fixed columns over the world; anything outside clamps to the edge cells, for
+    // triggers and entities alike, so the exact bounds test still decides
+    constexpr int GRID_DIMENSION = 128;
+    constexpr float CELL_SIZE = 512.0f;
+    constexpr float GRID_MIN = -CELL_SIZE * GRID_DIMENSION / 2;
+    constexpr float INV_CELL_SIZE = 1.0f / CELL_SIZE;
+
+    struct range_t {
+        uint8_t x0, y0, x1, y1;
+    };
+
+    struct trigger_t {
+        vec3_t  absmin, absmax;
+        range_t cells;
+        bool    indexed;
+        bool    movable;
+    };
+
+    struct cell_t {
+        std::vector<uint16_t> fixed;    // brush triggers that haven't moved
+        std::vector<uint16_t> movable;  // items, packs, point triggers, and brushes seen moving
+        uint32_t generation = 0;        // s_clock when a trigger last entered, left or moved in it
+    };
+
+    // what an entity's last check found nothing against
+    struct clear_t {
+        uint32_t clock;         // 0 = nothing cached
+        int32_t  spawn_count;
+        vec3_t   absmin, absmax;
+    };
+
+    std::array<cell_t, GRID_DIMENSION * GRID_DIMENSION> s_cells;
+    std::array<trigger_t, MAX_EDICTS> s_triggers{};
+    std::array<clear_t, MAX_EDICTS> s_clear{};
+    uint32_t s_clock = 1;
+    uint32_t s_count = 0, s_movable_count = 0;
+
+    void (*s_engine_linkentity)(edict_t* ent) = nullptr;
+    void (*s_engine_unlinkentity)(edict_t* ent) = nullptr;
+
+    // stats
+    uint64_t s_calls = 0, s_unchanged = 0, s_clear_moves = 0, s_queries = 0, s_changes = 0;
+
+    inline bool Overlaps(const vec3_t& amin, const vec3_t& amax, const vec3_t& bmin, const vec3_t& bmax) {
+        // inclusive, like the engine's area query
+        return !(amin.x > bmax.x || amin.y > bmax.y || amin.z > bmax.z ||
+                 amax.x < bmin.x || amax.y < bmin.y || amax.z < bmin.z);
+    }
+
+    inline uint8_t CellCoord(float value) {
+        return static_cast<uint8_t>(std::clamp(static_cast<int>(std::floor((value - GRID_MIN) * INV_CELL_SIZE)), 0, GRID_DIMENSION - 1));
+    }
+
+    inline range_t CellRange(const vec3_t& absmin, const vec3_t& absmax) {
+        return { CellCoord(absmin.x), CellCoord(absmin.y), CellCoord(absmax.x), CellCoord(absmax.y) };
+    }
+
+    template<typename Func>
+    inline void ForEachCell(const range_t& range, Func&& func) {
+        for (int y = range.y0; y <= range.y1; y++)
+            for (int x = range.x0; x <= range.x1; x++)
+                func(s_cells[y * GRID_DIMENSION + x]);
+    }
+
+    void Unplace(uint32_t index, const trigger_t& trigger, uint32_t clock) {
+        ForEachCell(trigger.cells, [&](cell_t& cell) {
+            std::vector<uint16_t>& list = trigger.movable ? cell.movable : cell.fixed;
+            for (size_t i = 0; i < list.size(); i++) {
+                if (list[i] == index) {
+                    list[i] = list.back();
+                    list.pop_back();
+                    break;
+                }
+            }
+            cell.generation = clock;
+        });
+    }
+
+    void Place(uint32_t index, const trigger_t& trigger, uint32_t clock) {
+        ForEachCell(trigger.cells, [&](cell_t& cell) {
+            (trigger.movable ? cell.movable : cell.fixed).push_back(static_cast<uint16_t>(index));
+            cell.generation = clock;
+        });
+    }
+
+    void Remove(uint32_t index) {
+        if (index >= MAX_EDICTS)
+            return;
+
+        trigger_t& trigger = s_triggers[index];
+        if (!trigger.indexed)
+            return;
+
+        Unplace(index, trigger, ++s_clock);
+        s_count--;
+        if (trigger.movable)
+            s_movable_count--;
+        trigger.indexed = false;
+        s_changes++;
+    }
+
+    void Update(const edict_t* ent) {
+        const uint32_t index = ent - g_edicts;
+        if (index >= MAX_EDICTS)
+            return;
+
+        if (!ent->inuse || !ent->linked || ent->solid != SOLID_TRIGGER) {
+            Remove(index);
+            return;
+        }
+
+        trigger_t& trigger = s_triggers[index];
+
+        if (trigger.indexed && trigger.absmin == ent->absmin && trigger.absmax == ent->absmax)
+            return;
+
+        const uint32_t clock = ++s_clock;
+
+        if (trigger.indexed) {
+            // it moved; from now on it lives with the movable triggers
+            Unplace(index, trigger, clock);
+            if (!trigger.movable)
+                s_movable_count++;
+            trigger.movable = true;
+        }
+        else {
+            trigger.indexed = true;
+            trigger.movable = !(ent->model && ent->model[0] == '*');
+            s_count++;
+            if (trigger.movable)
+                s_movable_count++;
+        }
+
+        trigger.absmin = ent->absmin;
+        trigger.absmax = ent->absmax;
+        trigger.cells = CellRange(ent->absmin, ent->absmax);
+        Place(index, trigger, clock);
+        s_changes++;
+    }
+
+    bool CellsChangedSince(const range_t& range, uint32_t clock) {
+        for (int y = range.y0; y <= range.y1; y++)
+            for (int x = range.x0; x <= range.x1; x++)
+                if (s_cells[y * GRID_DIMENSION + x].generation > clock)
+                    return true;
+        return false;
+    }
+
+    bool AnyOverlap(const std::vector<uint16_t>& list, const vec3_t& absmin, const vec3_t& absmax) {
+        for (uint16_t index : list) {
+            const trigger_t& trigger = s_triggers[index];
+            if (Overlaps(absmin, absmax, trigger.absmin, trigger.absmax))
+                return true;
+        }
+        return false;
+    }
+
+    void LinkEntity(edict_t* ent) {
+        s_engine_linkentity(ent);
+        Update(ent);
+    }
+
+    void UnlinkEntity(edict_t* ent) {
+        s_engine_unlinkentity(ent);
+        Remove(ent - g_edicts);
+    }
+
+} // namespace
+
+void HookImports() {
+    s_engine_linkentity = gi.linkentity;
+    s_engine_unlinkentity = gi.unlinkentity;
+    gi.linkentity = LinkEntity;
+    gi.unlinkentity = UnlinkEntity;
+}
+
+void Reset() {
+    for (cell_t& cell : s_cells) {
+        cell.fixed.clear();
+        cell.movable.clear();
+        cell.generation = 0;
+    }
+    s_triggers.fill({});
+    s_clear.fill({});
+    s_clock = 1;
+    s_count = s_movable_count = 0;
+}
+
+void Rebuild() {
+    Reset();
+
+    for (uint32_t i = 1; i < globals.num_edicts; i++)
+        Update(&g_edicts[i]);
+}
+
+bool MayTouch(const edict_t* ent) {
+    s_calls++;
+
+    const uint32_t index = ent - g_edicts;
+
+    if (!g_trigger_cache->integer || index >= MAX_EDICTS) {
+        s_queries++;
+        return true;
+    }
+
+    clear_t& clear = s_clear[index];
+    const range_t range = CellRange(ent->absmin, ent->absmax);
+
+    if (clear.clock && clear.spawn_count == ent->spawn_count &&
+        clear.absmin == ent->absmin && clear.absmax == ent->absmax &&
+        !CellsChangedSince(range, clear.clock)) {
+        s_unchanged++;
+        return false;
+    }
+
+    for (int y = range.y0; y <= range.y1; y++) {
+        for (int x = range.x0; x <= range.x1; x++) {
+            const cell_t& cell = s_cells[y * GRID_DIMENSION + x];
+
+            if (AnyOverlap(cell.fixed, ent->absmin, ent->absmax) || AnyOverlap(cell.movable, ent->absmin, ent->absmax)) {
+                clear.clock = 0;
+                s_queries++;
+                return true;
+            }
+        }
+    }
+
+    clear = { s_clock, ent->spawn_count, ent->absmin, ent->absmax };
+    s_clear_moves++;
+    return false;
+}
+
+void PrintStats() {
+    const double calls = s_calls ? static_cast<double>(s_calls) : 1.0;
+
+    gi.Com_PrintFmt("=== Trigger Index ({}) ===\n", g_trigger_cache->integer ? "on" : "off, g_trigger_cache 0");
+    gi.Com_PrintFmt("{} triggers indexed ({} movable), {} changes\n", s_count, s_movable_count, s_changes);
+    gi.Com_PrintFmt("G_TouchTriggers calls: {}\n", s_calls);
+    gi.Com_PrintFmt("  skipped, bounds unchanged:     {} ({:.1f}%)\n", s_unchanged, 100.0 * s_unchanged / calls);
+    gi.Com_PrintFmt("  skipped, no trigger near:      {} ({:.1f}%)\n", s_clear_moves, 100.0 * s_clear_moves / calls);
+    gi.Com_PrintFmt("  box query and touch dispatch:  {} ({:.1f}%)\n", s_queries, 100.0 * s_queries / calls);
+}
+
+} // namespace TriggerIndex
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "../g_local.h"
+
+// ============================================================================
+// Trigger Index - skip G_TouchTriggers for entities nowhere near a trigger
+// ============================================================================
+// G_TouchTriggers ran gi.BoxEdicts over AREA_TRIGGERS for every call, though
+// most calls come from monsters standing still or walking around far from
+// any trigger. Every linked SOLID_TRIGGER edict is kept in a grid of 512 unit
+// columns, built when the map loads and kept current through the hooked
+// gi.linkentity/unlinkentity. Brush triggers sit in each cell's static list;
+// items, dropped packs, point triggers and any brush seen moving sit in a
+// separate movable list, so relinking one only rewrites the short lists of
+// the cells it covers. A change stamps just those cells. Each entity remembers
+// the bounds and stamp of its last check that found no trigger, so a call with
+// unchanged bounds whose cells weren't stamped since skips straight out, and a
+// moved entity only runs the box query and touch dispatch if its bounds now
+// overlap a trigger in its cells. Entities inside a trigger are touched every
+// call, as before. The index may hold more than the engine's trigger list (a
+// trigger without a touch, for one), never less.
+// g_trigger_cache 0 always queries; "sv triggerstats" prints the hit rates.
+
+namespace TriggerIndex {
+
+    // Install the linkentity/unlinkentity hooks into gi (GetGameAPI)
+    void HookImports();
+
+    // Forget every trigger and cached check (map change)
+    void Reset();
+
+    // Index the triggers of a loaded savegame
+    void Rebuild();
+
+    // Whether `ent`'s bounds may overlap a trigger; false means G_TouchTriggers has nothing to do
+    bool MayTouch(const edict_t* ent);
+
+    // sv triggerstats
+    void PrintStats();
+
+} // namespace TriggerIndex
@@ -285,7 +285,10 @@ static void GetBossPlacementBounds(horde::MonsterTypeID typeId, BossSizeCategory
 	maxs *= boss_effect_scale;
 }
 
-static bool GetBossGridCandidate(int32_t attempt, bool prefer_out_of_visibility, vec3_t &candidate)
+// Candidates only come from grid nodes whose stored hull class has room for the boss
+// (standing, or hovering for flyers), so the validation below rarely rejects one.
+static bool GetBossGridCandidate(int32_t attempt, bool prefer_out_of_visibility,
+	HordePhys::SpawnGrid::HullClass hull, bool is_flying, vec3_t &candidate)
 {
 	if (attempt < BOSS_GRID_TACTICAL_ATTEMPTS)
 	{
@@ -293,9 +296,15 @@ static bool GetBossGridCandidate(int32_t attempt, bool prefer_out_of_visibility,
 			candidate,
 			BOSS_GRID_MIN_PLAYER_DISTANCE,
 			BOSS_GRID_TACTICAL_SAMPLE_ATTEMPTS,
-			prefer_out_of_visibility);
+			prefer_out_of_visibility,
+			hull,
+			is_flying);
 	}
 
+	// Nothing on the map has room for the boss's class: fall back to any node and let
+	// the relaxed boss validation decide
+	if (HordePhys::g_spawn_grid.GetRandomPositionForHull(hull, is_flying, candidate))
+		return true;
 	return HordePhys::g_spawn_grid.GetRandomPosition(candidate);
 }
 
@@ -329,10 +338,12 @@ static bool TryBossGridFallbackPosition(const vec3_t &predicted_mins, const vec3
 		return false;
 	}
 
+	const auto hull = HordePhys::SpawnGrid::ClassifyHull(predicted_mins, predicted_maxs);
+
 	for (int32_t attempt = 0; attempt < BOSS_GRID_FALLBACK_ATTEMPTS; ++attempt)
 	{
 		vec3_t candidate;
-		if (!GetBossGridCandidate(attempt, prefer_out_of_visibility, candidate))
+		if (!GetBossGridCandidate(attempt, prefer_out_of_visibility, hull, is_flying, candidate))
 			continue;
 
 		if (!PrepareBossPlacementAt(candidate, predicted_mins, predicted_maxs, is_flying, final_pos))
@@ -365,10 +376,12 @@ static bool TryTeleportBossToGridFallback(edict_t *self, const vec3_t &predicted
 		return false;
 	}
 
+	const auto hull = HordePhys::SpawnGrid::ClassifyHull(predicted_mins, predicted_maxs);
+
 	for (int32_t attempt = 0; attempt < BOSS_GRID_FALLBACK_ATTEMPTS; ++attempt)
 	{
 		vec3_t candidate;
-		if (!GetBossGridCandidate(attempt, false, candidate))
+		if (!GetBossGridCandidate(attempt, false, hull, is_flying, candidate))
 			continue;
 
 		vec3_t final_pos;
@@ -753,10 +766,11 @@ static int32_t CountValidBossPlacements(horde::MonsterTypeID typeId, BossSizeCat
 
 	if (HordePhys::g_spawn_grid.IsGenerated())
 	{
+		const auto hull = HordePhys::SpawnGrid::ClassifyHull(predicted_mins, predicted_maxs);
 		for (int32_t attempt = 0; attempt < BOSS_SPACE_GRID_SAMPLE_ATTEMPTS && valid_count < BOSS_SPACE_VALIDATION_CAP; ++attempt)
 		{
 			vec3_t grid_position;
-			if (!HordePhys::g_spawn_grid.GetRandomPosition(grid_position))
+			if (!HordePhys::g_spawn_grid.GetRandomPositionForHull(hull, is_flying, grid_position))
 				break;
 
 			count_if_valid(grid_position);
@@ -1137,7 +1151,7 @@ void BossDeathHandler(edict_t *boss) noexcept
 
 	// Randomize and drop standard items
 	std::array<item_id_t, standardItemIDs.size()> shuffledIDs = standardItemIDs;
-	std::shuffle(shuffledIDs.begin(), shuffledIDs.end(), mt_rand);
+	std::shuffle(shuffledIDs.begin(), shuffledIDs.end(), rng_stream(rng_stream_t::spawn));
 
 	for (size_t item_slot = 0; item_slot < shuffledIDs.size(); ++item_slot)
 	{
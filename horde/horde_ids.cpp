@@ -562,6 +562,18 @@ namespace horde {
         return MapID::UNKNOWN;
     }
 
+    std::string_view MapOriginRegistry::GetMapName(MapID mapId) {
+        if (!s_initialized) [[unlikely]] {
+            Initialize();
+        }
+
+        for (const auto& [name, id] : s_mapIDMap) {
+            if (id == mapId)
+                return name;
+        }
+        return {};
+    }
+
     bool MapOriginRegistry::GetOrigin(const char* map_name, vec3_t& out_origin) {
         return GetOrigin(GetMapID(map_name), out_origin);
     }
@@ -298,6 +298,9 @@ public:
         // Get map ID from name
         static MapID GetMapID(const char* map_name);
 
+        // First name (in name order) registered for a map ID; empty if none
+        static std::string_view GetMapName(MapID mapId);
+
         // Get origin for a map (returns true if successful)
         static bool GetOrigin(const char* map_name, vec3_t& out_origin);
         static bool GetOrigin(MapID mapId, vec3_t& out_origin);
@@ -5,6 +5,7 @@
 #include "../memory_safety.h"  // For safe memory operations
 #include "../ctf/p_ctf_menu.h" // Menu system definitions and functions
 #include "../ctf/g_ctf.h"	   // For CTF functions like CTFObserver, CTFJoinTeam, CTFBeginElection, etc.
+#include "../g_statusbar.h"	   // layout_writer_t for the scoreboard
 #include "g_horde.h"		   // For GetMapSize
 #include "g_horde_benefits.h"
 #include "g_laser.h"
@@ -2393,7 +2394,7 @@ pmenuhnd_t *CreateHUDMenu(edict_t *ent)
 		entries[count++].SelectFunc = HUDMenuHandler;
 	}
 
-	return PMenu_Open(ent, entries, -1, count, nullptr, nullptr);
+	return PMenu_Open(ent, entries, -1, count, nullptr, nullptr, menu_id_t::hud_options);
 }
 
 // Updates the dynamic text in the HUD menu (ON/OFF status)
@@ -2404,11 +2405,13 @@ void UpdateHUDMenu(edict_t *ent, pmenuhnd_t *p)
 		return;
 	}
 
-	// Update the menu entries using G_Fmt (PMenu_UpdateEntry takes const char*)
-	PMenu_UpdateEntry(p->entries + 2, G_Fmt("Enable/Disable ID [{}]", ent->client->pers.id_state ? "ON" : "OFF").data(), PMENU_ALIGN_LEFT, HUDMenuHandler);
-	PMenu_UpdateEntry(p->entries + 3, G_Fmt("Enable/Disable ID-DMG [{}]", ent->client->pers.iddmg_state ? "ON" : "OFF").data(), PMENU_ALIGN_LEFT, HUDMenuHandler);
+	// Update the menu entries using G_Fmt (PMenu_UpdateEntry takes const char*);
+	// only entries whose text actually changed are flagged dirty
+	bool changed = PMenu_UpdateEntry(p, 2, G_Fmt("Enable/Disable ID [{}]", ent->client->pers.id_state ? "ON" : "OFF").data(), PMENU_ALIGN_LEFT, HUDMenuHandler);
+	changed |= PMenu_UpdateEntry(p, 3, G_Fmt("Enable/Disable ID-DMG [{}]", ent->client->pers.iddmg_state ? "ON" : "OFF").data(), PMENU_ALIGN_LEFT, HUDMenuHandler);
 
-	PMenu_Update(ent);
+	if (changed)
+		ent->client->menudirty = true;
 }
 
 // Handles selections in the HUD options menu
@@ -2472,12 +2475,11 @@ void CheckAndUpdateMenus()
 			continue;
 		}
 
-		// Check if the player is in the HUD menu by comparing the title text
-		// Using strcmp for C-style string comparison
-		if (strcmp(player->client->menu->entries[0].text, "*HUD Options") == 0)
+		// Check if the player is in the HUD menu by its menu ID; UpdateHUDMenu
+		// only flags a refresh when the ON/OFF text actually changed
+		if (player->client->menu->id == menu_id_t::hud_options)
 		{
 			UpdateHUDMenu(const_cast<edict_t *>(player), player->client->menu); // Pass non-const edict_t
-																				// gi.unicast(const_cast<edict_t*>(player), true); // Update might already handle this
 		}
 		// Add checks for other dynamic menus if needed
 	}
@@ -6762,47 +6764,6 @@ constexpr int PLAYER_Y_START = 42;
 constexpr int PLAYER_Y_SPACING = 8;
 constexpr int LAYOUT_SAFETY_MARGIN = 50;
 
-/**
- *  StringBuilder
- * Helper class for efficient string concatenation
- */
-class StringBuilder {
-private:
-	std::string buffer;
-
-public:
-	explicit StringBuilder(size_t reserved_size = 256) {
-		buffer.reserve(reserved_size);
-	}
-
-	StringBuilder& append(std::string_view text) {
-		buffer.append(text);
-		return *this;
-	}
-
-	bool append_checked(std::string_view text, size_t reserve_margin = 0) {
-		if (text.empty())
-			return true;
-
-		const size_t limit = MAX_CTF_STAT_LENGTH;
-		const size_t safe_limit = (limit > (reserve_margin + 1)) ? (limit - reserve_margin - 1) : 0;
-
-		if (buffer.size() + text.size() > safe_limit)
-			return false;
-
-		buffer.append(text);
-		return true;
-	}
-
-	std::string str() const {
-		return buffer;
-	}
-
-	size_t size() const {
-		return buffer.size();
-	}
-};
-
 /**
  * SanitizeLayoutText
  * Returns a copy of `text` safe to embed inside a quoted layout `string "..."`
@@ -6868,16 +6829,27 @@ struct PlayerScore {
  */
 class ScoreboardLayout {
 private:
-	StringBuilder layout_builder;
+	// fixed-size writer, no heap; keeps LAYOUT_SAFETY_MARGIN free below the protocol limit
+	layout_writer_t<MAX_CTF_STAT_LENGTH - LAYOUT_SAFETY_MARGIN - 1> sb;
 	const edict_t* ent;
 	// Increased capacity to handle typical server sizes (avoid heap allocation)
 	boost::container::small_vector<PlayerScore, 32> team_players;  // Typical servers: 16-32 players
 	boost::container::small_vector<PlayerScore, 16> spectators;    // Typical spectators: <16
 	int total_score;
 
+	// names are truncated and stripped of layout-breaking characters
+	static std::string DisplayName(const char* name) {
+		std::string display_name = name;
+		if (display_name.length() > 20) {
+			display_name.resize(17);
+			display_name += "...";
+		}
+		return SanitizeLayoutText(display_name);
+	}
+
 public:
-	ScoreboardLayout(edict_t* player_ent, size_t reserve_size = MAX_CTF_STAT_LENGTH)
-		: layout_builder(reserve_size), ent(player_ent), total_score(0) {
+	explicit ScoreboardLayout(edict_t* player_ent)
+		: ent(player_ent), total_score(0) {
 	}
 
 	void collectPlayers() {
@@ -6917,28 +6889,15 @@ public:
 		{
 			// string2 is better than loc_string2 here it seems
 			// Element 1: Wave Number (aligned left)
-			const std::string wave_line = fmt::format(
-				"xv -140 yv -5 string2 \"Wave: {}\" \n",
-				last_wave_number);
-			if (!layout_builder.append_checked(wave_line, LAYOUT_SAFETY_MARGIN))
-				return;
+			sb.xv(-140).yv(-5).string2(G_Fmt("Wave: {}", last_wave_number));
 
 			// Element 2: Stroggs Remaining (aligned further to the right)
-			const std::string strogg_line = fmt::format(
-				"xv -40 yv -5 string2 \"Stroggs: {}\" \n",
-				GetStroggsNum());
-			if (!layout_builder.append_checked(strogg_line, LAYOUT_SAFETY_MARGIN))
-				return;
+			sb.xv(-40).yv(-5).string2(G_Fmt("Stroggs: {}", GetStroggsNum()));
 		}
 
 		// Time limit remains the same
 		if (timelimit->value)
-		{
-			const std::string time_line = fmt::format(
-				"xv 340 yv -33 time_limit {} \n",
-				gi.ServerFrame() + ((gtime_t::from_min(timelimit->value) - level.time)).milliseconds() / gi.frame_time_ms);
-			(void)layout_builder.append_checked(time_line, LAYOUT_SAFETY_MARGIN);
-		}
+			sb.xv(340).yv(-33).time_limit(gi.ServerFrame() + ((gtime_t::from_min(timelimit->value) - level.time)).milliseconds() / gi.frame_time_ms);
 	}
 
 
@@ -6947,24 +6906,21 @@ public:
 		// Default to the classic Strogg icon; if the host player (client slot 0,
 		// same convention as the "is_host" checks elsewhere in this file) has
 		// picked their own dogtag, show that instead.
-		std::string horde_dogtag_path = "/tags/etqw_strogg.png";
+		std::string_view horde_dogtag_path = "/tags/etqw_strogg.png";
 		const edict_t *host_ent = g_edicts + 1;
 		if (host_ent->inuse && host_ent->client) {
 			const std::string_view host_dogtag = host_ent->client->pers.dogtag;
 			if (IsValidDogtagName(host_dogtag))
-				horde_dogtag_path = fmt::format("/tags/{}.png", host_dogtag);
+				horde_dogtag_path = G_Fmt("/tags/{}.png", host_dogtag);
 		}
 
 		// Display team icon
-		const std::string icon_line = fmt::format(
-			"xv -140 yv 3 picn {} \n", horde_dogtag_path);
-		if (!layout_builder.append_checked(icon_line, LAYOUT_SAFETY_MARGIN))
-			return;
+		sb.xv(-140).yv(3).picn(horde_dogtag_path);
 
 		if (level.intermissiontime)
 		{
-			// Intermission screen - display Strogg team icon (uses stat 26 = STAT_CTF_TEAM2_HEADER, right side)
-			(void)layout_builder.append_checked("if 26 xv 208 yv 8 pic 25 endif \n", LAYOUT_SAFETY_MARGIN);
+			// Intermission screen - display Strogg team icon (right side)
+			sb.ifstat(STAT_CTF_TEAM2_HEADER).xv(208).yv(8).pic(STAT_CTF_TEAM1_HEADER).endifstat();
 		}
 	}
 
@@ -6976,111 +6932,73 @@ public:
 		int header_y = PLAYER_Y_START - PLAYER_Y_SPACING;
 				if (g_vortex->integer)
 		{
-			const std::string header_line = fmt::format(
-				"yv {} xv -140 string2 \"Name\" xv 70 string2 \"Score\" xv 120 string2 \"Lv\" xv 160 string2 \"Ping\" xv 205 string2 \"Deaths\" \n",
-				header_y);
-			if (!layout_builder.append_checked(header_line, LAYOUT_SAFETY_MARGIN))
-				return;
+			sb.yv(header_y).xv(-140).string2("Name").xv(70).string2("Score").xv(120).string2("Lv").xv(160).string2("Ping").xv(205).string2("Deaths");
 		}
 		else
 		{
-			const std::string header_line = fmt::format(
-				"yv {} xv -140 string2 \"Name\" xv 70 string2 \"Score\" xv 120 string2 \"Ping\" xv 160 string2 \"Deaths\" \n",
-				header_y);
-			if (!layout_builder.append_checked(header_line, LAYOUT_SAFETY_MARGIN))
-				return;
+			sb.yv(header_y).xv(-140).string2("Name").xv(70).string2("Score").xv(120).string2("Ping").xv(160).string2("Deaths");
 		}
+		if (sb.truncated())
+			return;
+
+		// Deaths column lines up under the "Deaths" header, which sits
+		// further right in vortex mode to avoid the Lv/Ping labels.
+		const int deaths_x = g_vortex->integer ? 205 : 160;
+
 		bool truncated = false;
 		for (size_t i = 0; i < std::min(team_players.size(), MAX_PLAYERS_TO_DISPLAY); ++i) {
 			const auto& player = team_players[i];
 		edict_t *player_ent = g_edicts + 1 + player.index;
 		const char *player_name = GetPlayerName(player_ent);
 			int y = PLAYER_Y_START + i * PLAYER_Y_SPACING;
+			const size_t row_start = sb.size();
 
 			// Add death indicator if player is dead
-			if (player.is_dead) {
-				const std::string dead_line = fmt::format(
-					"xv -185 yv {} string \"[Dead]\" ", y);
-				if (!layout_builder.append_checked(dead_line, LAYOUT_SAFETY_MARGIN)) {
-					truncated = true;
-					break;
-				}
-			}
+			if (player.is_dead)
+				sb.xv(-185).yv(y).string("[Dead]");
 
 			// Add player information (truncate name to prevent overflow)
-				std::string display_name = player_name;
-				if (display_name.length() > 20) {
-					display_name.resize(17);
-					display_name += "...";
-				}
-				display_name = SanitizeLayoutText(display_name);
-				const std::string player_line = fmt::format(
-					"yv {} xv -140 string \"{}\" xv 70 string \"{}\"  xv 120 string \"{}\" \n",
-					y, display_name, player.score, player.ping);
-				if (!layout_builder.append_checked(player_line, LAYOUT_SAFETY_MARGIN)) {
-					truncated = true;
-					break;
-				}
+			sb.yv(y).xv(-140).string(DisplayName(player_name)).xv(70).string(G_Fmt("{}", player.score)).xv(120).string(G_Fmt("{}", player.ping));
+			sb.xv(deaths_x).yv(y).string(G_Fmt("{}", player.deaths));
 
-				// Deaths column lines up under the "Deaths" header, which sits
-				// further right in vortex mode to avoid the Lv/Ping labels.
-				const int deaths_x = g_vortex->integer ? 205 : 160;
-				const std::string deaths_line = fmt::format(
-					"xv {} yv {} string \"{}\" \n", deaths_x, y, player.deaths);
-				(void)layout_builder.append_checked(deaths_line, LAYOUT_SAFETY_MARGIN);
+			// take back a row that only partly fit
+			if (sb.truncated()) {
+				sb.rewind(row_start);
+				truncated = true;
+				break;
+			}
 		}
 		if (truncated) {
 			const int y = PLAYER_Y_START + static_cast<int>(std::min(team_players.size(), MAX_PLAYERS_TO_DISPLAY)) * PLAYER_Y_SPACING;
-			const std::string more_line = fmt::format(
-				"xv -90 yv {} string2 \"And more...\" \n", y);
-			(void)layout_builder.append_checked(more_line, LAYOUT_SAFETY_MARGIN);
+			sb.xv(-90).yv(y).string2("And more...");
 		}
 	}
 
 	void addSpectators() {
 		// Only add spectators if there's enough space and there are spectators
-		if (layout_builder.size() < MAX_CTF_STAT_LENGTH - LAYOUT_SAFETY_MARGIN && !spectators.empty()) {
+		if (!sb.truncated() && !spectators.empty()) {
 			// Calculate vertical position after team players
 			int y = PLAYER_Y_START + (std::min(team_players.size(), MAX_PLAYERS_TO_DISPLAY) + 2) * PLAYER_Y_SPACING;
 
 			// Add spectator header
-			const std::string spec_header = fmt::format(
-				"xv -90 yv {} loc_string2 0 \"Spectators & AFK\" \n", y);
-			if (!layout_builder.append_checked(spec_header, LAYOUT_SAFETY_MARGIN))
-				return;
+			sb.xv(-90).yv(y).loc_text("loc_string", true, "Spectators & AFK");
 			y += PLAYER_Y_SPACING;
 
 			// Add each spectator
+			// Optimized format: Name, Score, Ping (spectators don't have levels)
+			const int ping_x = g_vortex->integer ? 160 : 120;
 
 			for (const auto& spec : spectators) {
+				if (sb.truncated())
+					break;
 
 				edict_t *spec_ent = g_edicts + 1 + spec.index;
-				const char *spec_name = GetPlayerName(spec_ent);
+				const size_t row_start = sb.size();
 
-				// Truncate spectator names to prevent overflow
-				std::string display_spec_name = spec_name;
-				if (display_spec_name.length() > 20) {
-					display_spec_name.resize(17);
-					display_spec_name += "...";
-				}
-				display_spec_name = SanitizeLayoutText(display_spec_name);
+				sb.yv(y).xv(-140).string2(DisplayName(GetPlayerName(spec_ent))).xv(70).string2(G_Fmt("{}", spec.score)).xv(ping_x).string2(G_Fmt("{}", spec.ping));
 
-				// Optimized format: Name, Score, Ping (spectators don't have levels)
-				if (!g_vortex->integer)
-				{
-					const std::string spec_line = fmt::format(
-					"yv {} xv -140 string2 \"{}\" xv 70 string2 \"{}\" xv 120 string2 \"{}\" \n",
-					y, display_spec_name, spec.score, spec.ping);
-					if (!layout_builder.append_checked(spec_line, LAYOUT_SAFETY_MARGIN))
-						break;
-				}
-				else	{
-				const std::string spec_line = fmt::format(
-					"yv {} xv -140 string2 \"{}\" xv 70 string2 \"{}\" xv 160 string2 \"{}\" \n",
-					y, display_spec_name, spec.score, spec.ping);
-				if (!layout_builder.append_checked(spec_line, LAYOUT_SAFETY_MARGIN))
-					break;
-				}
+				if (sb.truncated())
+					sb.rewind(row_start);
 
 				y += PLAYER_Y_SPACING;
 			}
@@ -7089,18 +7007,18 @@ public:
 
 	void addFooter()
 	{
+		// the help/intermission lines need ~150 bytes; skip them rather than
+		// squeezing them in after the roster already ran out of space
+		if (sb.remaining() < 150 - LAYOUT_SAFETY_MARGIN)
+			return;
+
 		if (!level.intermissiontime)
 		{
 			const char *help_text = (ent->client->resp.ctf_team != CTF_TEAM1)
 										? "Use Inventory <KEY> to toggle Horde Menu."
 										: "Use Horde Menu on Powerup Wheel or press Inventory <KEY> to toggle Horde Menu.";
 
-			// Check if we have enough space for the help text (reserve ~150 bytes)
-			if (layout_builder.size() < MAX_CTF_STAT_LENGTH - 150) {
-				const std::string help_line = fmt::format(
-					"xv 0 yb -55 cstring2 \"{}\" \n", help_text);
-				(void)layout_builder.append_checked(help_line, LAYOUT_SAFETY_MARGIN);
-			}
+			sb.xv(0).yb(-55).cstring2(help_text);
 		}
 		else
 		{
@@ -7109,21 +7027,17 @@ public:
 									  ? "MAKE THEM PAY!"
 									  : "THEY WILL REGRET THIS!";
 
-			// Only add intermission message if we have enough space to avoid truncation
-			// The ifgef block needs ~100 chars, so reserve 150 to be safe
-			if (layout_builder.size() < MAX_CTF_STAT_LENGTH - 150) {
-				// It will display the message after a 5-second delay.
-				const std::string intermission_line = fmt::format(
-					"ifgef {} yb -48 xv 0 loc_cstring2 0 \"{}\" endif \n",
-					level.intermission_server_frame + (5_sec).frames(),
-					message);
-				(void)layout_builder.append_checked(intermission_line, LAYOUT_SAFETY_MARGIN);
-			}
+			// It will display the message after a 5-second delay.
+			sb.ifgef(level.intermission_server_frame + (5_sec).frames()).yb(-48).xv(0).loc_text("loc_cstring", true, message).endif();
 		}
 	}
 
-	std::string build() {
-		return layout_builder.str();
+	[[nodiscard]] bool balanced() const {
+		return sb.balanced();
+	}
+
+	[[nodiscard]] const char* c_str() const {
+		return sb.c_str();
 	}
 };
 
@@ -7153,19 +7067,9 @@ void HordeScoreboardMessage(edict_t* ent, edict_t* killer) {
 	layout.addSpectators();
 	layout.addFooter();
 
-	// Get final layout string
-	std::string final_layout = layout.build();
-
-	// Ensure we don't exceed layout size limits
-	if (final_layout.size() >= MAX_CTF_STAT_LENGTH) {
-		if (developer && developer->integer)
-			gi.Com_PrintFmt("ERROR: Scoreboard layout exceeded size limit ({} >= {}), not sending\n",
-							final_layout.size(), MAX_CTF_STAT_LENGTH);
-		return;
-	}
-
-	// Validate layout before sending to client
-	if (!final_layout.empty() && !ValidateLayoutString(final_layout, "HordeScoreboardMessage")) {
+	// The writer is capped below MAX_CTF_STAT_LENGTH and tracks if/endif
+	// balance itself, so there's nothing left to re-scan here
+	if (!layout.balanced()) {
 		if (developer && developer->integer)
 			gi.Com_Print("ERROR: HordeScoreboardMessage layout failed validation, not sending\n");
 		return;
@@ -7173,7 +7077,7 @@ void HordeScoreboardMessage(edict_t* ent, edict_t* killer) {
 
 	// Send to client
 	gi.WriteByte(svc_layout);
-	gi.WriteString(final_layout.c_str());
+	gi.WriteString(layout.c_str());
 }
 
 // --- END OF FILE horde_menu.cpp ---
@@ -12,7 +12,9 @@
 #include "horde_performance.h"
 #include "../memory_safety.h"
 #include "horde_constants.h"
+#include "g_metrics.h"
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 
 // NOTE: horde_state_t is now defined in g_horde.h
@@ -56,6 +58,8 @@ extern bool IsFlying(horde::MonsterTypeID typeId);
 extern void MarkPositionAsRecentlyUsed(const vec3_t& position);
 extern bool IsPositionTooCloseToRecentSpawn(const vec3_t& position, const horde::MapSize& mapSize);
 extern PositionValidationResult IsPositionPhysicallyValid(const vec3_t& position, const vec3_t& monster_mins, const vec3_t& monster_maxs, bool is_flying);
+extern PositionValidationResult IsPositionGeometryValid(const vec3_t& position, const vec3_t& monster_mins, const vec3_t& monster_maxs, bool is_flying);
+extern bool IsSpawnVolumeClear(const vec3_t& position, const vec3_t& monster_mins, const vec3_t& monster_maxs);
 extern bool ShouldUseFallbackGrid();
 extern cvar_t* g_horde_spawn_dist_cap;
 extern bool Horde_TeleportMonster(edict_t* self, const vec3_t& dest, const vec3_t& angles, bool force_teleport, bool ignore_visibility);
@@ -542,6 +546,7 @@ edict_t* Horde_SpawnMonster(
                 if (sound_spawn1) {
                     gi.sound(monster, CHAN_AUTO, sound_spawn1, 1, ATTN_NORM, 0);
                 }
+                Metrics::Count(Metrics::MONSTER_SPAWNS);
                 return monster;
             }
             // If it's still stuck after the fix, something is very wrong. Fall through to free it.
@@ -566,6 +571,7 @@ edict_t* Horde_SpawnMonster(
     if (sound_spawn1) {
         gi.sound(monster, CHAN_AUTO, sound_spawn1, 1, ATTN_NORM, 0);
     }
+    Metrics::Count(Metrics::MONSTER_SPAWNS);
     return monster;
 }
 
@@ -716,6 +722,17 @@ bool TryAlternativeSpawnPosition(edict_t* spawn_point, horde::MonsterTypeID type
         constexpr float GRID_MIN_DIST = 64.0f;
         constexpr float GRID_MAX_DIST = 512.0f;
 
+        // only grid nodes with room for this monster's hull class are candidates
+        const auto hull = HordePhys::SpawnGrid::ClassifyHull(predicted_mins, predicted_maxs);
+
+        // standard spawning scans the grid once for this placement; attempts draw from the ring without repeats
+        const bool tactical = g_horde_tactical_spawn->integer > 0;
+        static std::vector<vec3_t> grid_candidates;
+        if (tactical)
+            grid_candidates.clear();
+        else
+            HordePhys::g_spawn_grid.CollectPositionsForHullNear(base_origin, GRID_MIN_DIST, GRID_MAX_DIST, hull, is_flying, grid_candidates);
+
         for (int attempt = 0; attempt < GRID_ATTEMPTS; ++attempt)
         {
             vec3_t grid_pos;
@@ -724,15 +741,17 @@ bool TryAlternativeSpawnPosition(edict_t* spawn_point, horde::MonsterTypeID type
             // Mode 1: Distance checks only
             // Mode 2: Distance + visibility checks
             bool got_position = false;
-            if (g_horde_tactical_spawn->integer > 0)
+            if (tactical)
             {
                 // Tactical spawn: check distance from players and optionally visibility
-                got_position = HordePhys::g_spawn_grid.GetTacticalSpawnPosition(grid_pos, 256.0f, 10);
+                got_position = HordePhys::g_spawn_grid.GetTacticalSpawnPosition(grid_pos, 256.0f, 10, false, hull, is_flying);
             }
             else
             {
-                // Standard spawn: just use random position near spawn point
-                got_position = HordePhys::g_spawn_grid.GetRandomPositionNear(base_origin, GRID_MIN_DIST, GRID_MAX_DIST, grid_pos);
+                // Standard spawn: random fitting node near the spawn point
+                got_position = HordePhys::SpawnGrid::TakeRandomPosition(grid_candidates, grid_pos);
+                if (!got_position)
+                    break;
             }
 
             if (!got_position)
@@ -779,6 +798,266 @@ bool TryAlternativeSpawnPosition(edict_t* spawn_point, horde::MonsterTypeID type
     return false;
 }
 
+// ============================================================================
+// SPAWN POSITION POOL
+// ============================================================================
+// Most of IsPositionPhysicallyValid (contents, sky, ground drop, navmesh reach) only
+// depends on the world, so for a spawn point's own origin the answer per monster hull
+// barely ever changes. The pool keeps that geometry result for every (point, hull)
+// pair and refreshes a few stale entries per frame, so by the time a batch is planned
+// and executed its points are already validated: execution only adds the occupancy
+// trace, and planning can skip points whose origin is known not to fit the monster.
+// The engine's trace functions are game-thread only, hence time slicing across
+// frames rather than worker threads.
+
+namespace {
+
+constexpr size_t SPAWN_POOL_MAX_HULLS = 16;
+constexpr gtime_t SPAWN_POOL_MAX_AGE = 15_sec;   // movers can change a point's geometry
+constexpr gtime_t SPAWN_POOL_HULL_IDLE = 60_sec; // unused hulls may be evicted after this
+
+struct SpawnPoolHull {
+    vec3_t mins;
+    vec3_t maxs;
+    bool is_flying;
+    gtime_t last_used;
+};
+
+struct SpawnPoolEntry {
+    vec3_t point_origin;    // spawn point origin the result was computed for
+    vec3_t adjusted_origin; // IsPositionGeometryValid's adjusted position
+    gtime_t validated_at = 0_sec;
+    bool is_valid = false;
+};
+
+struct SpawnPositionPool {
+    std::array<SpawnPoolHull, SPAWN_POOL_MAX_HULLS> hulls{};
+    size_t hull_count = 0;
+    // hull index per monster type, -1 = not registered
+    std::array<int8_t, static_cast<size_t>(horde::MonsterTypeID::MAX_TYPES)> type_hull{};
+    std::array<std::array<SpawnPoolEntry, SPAWN_POOL_MAX_HULLS>, SpawnPointsSoA::MAX_STATE_SPAWN_POINTS> entries{};
+    size_t refresh_cursor = 0;
+
+    // counters for `sv spawnpool`
+    uint64_t hits = 0;        // answered from a fresh entry
+    uint64_t misses = 0;      // validated on demand (stale or never filled)
+    uint64_t refreshed = 0;   // validated ahead of time by the per-frame refresh
+    uint64_t unpooled = 0;    // no hull slot free, validated without the pool
+
+    void Reset()
+    {
+        hull_count = 0;
+        type_hull.fill(-1);
+        for (auto& point_entries : entries)
+            point_entries.fill(SpawnPoolEntry{});
+        refresh_cursor = 0;
+    }
+};
+
+SpawnPositionPool g_spawn_pool;
+bool g_spawn_pool_initialized = false;
+
+void EnsureSpawnPoolInitialized()
+{
+    if (!g_spawn_pool_initialized)
+    {
+        g_spawn_pool.Reset();
+        g_spawn_pool_initialized = true;
+    }
+}
+
+// Returns the hull slot for a monster type, registering it (and evicting the hull idle
+// the longest, if the table is full) when needed. -1 when every slot is still in use.
+int GetSpawnPoolHull(horde::MonsterTypeID typeId)
+{
+    EnsureSpawnPoolInitialized();
+
+    const size_t type_index = static_cast<size_t>(typeId);
+    if (type_index >= g_spawn_pool.type_hull.size())
+        return -1;
+
+    if (const int cached = g_spawn_pool.type_hull[type_index]; cached >= 0)
+    {
+        g_spawn_pool.hulls[cached].last_used = level.time;
+        return cached;
+    }
+
+    SpawnPoolHull hull{};
+    GetPredictedScaledBounds(typeId, hull.mins, hull.maxs);
+    hull.is_flying = IsFlying(typeId);
+    hull.last_used = level.time;
+
+    // types sharing bounds share a hull
+    for (size_t i = 0; i < g_spawn_pool.hull_count; ++i)
+    {
+        const SpawnPoolHull& existing = g_spawn_pool.hulls[i];
+        if (existing.is_flying == hull.is_flying && existing.mins == hull.mins && existing.maxs == hull.maxs)
+        {
+            g_spawn_pool.type_hull[type_index] = static_cast<int8_t>(i);
+            g_spawn_pool.hulls[i].last_used = level.time;
+            return static_cast<int>(i);
+        }
+    }
+
+    size_t slot = g_spawn_pool.hull_count;
+    if (slot >= SPAWN_POOL_MAX_HULLS)
+    {
+        slot = 0;
+        for (size_t i = 1; i < SPAWN_POOL_MAX_HULLS; ++i)
+            if (g_spawn_pool.hulls[i].last_used < g_spawn_pool.hulls[slot].last_used)
+                slot = i;
+
+        if (level.time - g_spawn_pool.hulls[slot].last_used < SPAWN_POOL_HULL_IDLE)
+            return -1;
+
+        // drop the evicted hull's results and every type mapped to it
+        for (auto& hull_index : g_spawn_pool.type_hull)
+            if (hull_index == static_cast<int8_t>(slot))
+                hull_index = -1;
+        for (auto& point_entries : g_spawn_pool.entries)
+            point_entries[slot] = SpawnPoolEntry{};
+    }
+    else
+    {
+        g_spawn_pool.hull_count++;
+    }
+
+    g_spawn_pool.hulls[slot] = hull;
+    g_spawn_pool.type_hull[type_index] = static_cast<int8_t>(slot);
+    return static_cast<int>(slot);
+}
+
+bool IsSpawnPoolEntryFresh(const SpawnPoolEntry& entry, const vec3_t& point_origin)
+{
+    return entry.validated_at > 0_sec &&
+           level.time - entry.validated_at < SPAWN_POOL_MAX_AGE &&
+           (entry.point_origin - point_origin).lengthSquared() <= 1.0f;
+}
+
+void FillSpawnPoolEntry(SpawnPoolEntry& entry, const SpawnPoolHull& hull, const vec3_t& point_origin)
+{
+    const auto validation = IsPositionGeometryValid(point_origin, hull.mins, hull.maxs, hull.is_flying);
+    entry.point_origin = point_origin;
+    entry.adjusted_origin = validation.adjusted_position;
+    entry.is_valid = validation.is_valid;
+    // never store 0, that means "not filled"
+    entry.validated_at = std::max(level.time, 1_ms);
+}
+
+} // namespace
+
+bool Horde_ValidateSpawnPointOrigin(edict_t* spawn_point, horde::MonsterTypeID typeId, vec3_t& out_origin)
+{
+    vec3_t mins, maxs;
+    GetPredictedScaledBounds(typeId, mins, maxs);
+    const bool is_flying = IsFlying(typeId);
+    const vec3_t& point_origin = spawn_point->s.origin;
+
+    const uint16_t point_index = GetSpawnPointIndexSafe(spawn_point);
+    const int hull_index = GetSpawnPoolHull(typeId);
+    if (point_index >= SpawnPointsSoA::MAX_STATE_SPAWN_POINTS || hull_index < 0)
+    {
+        g_spawn_pool.unpooled++;
+        const auto validation = IsPositionPhysicallyValid(point_origin, mins, maxs, is_flying);
+        out_origin = validation.adjusted_position;
+        return validation.is_valid;
+    }
+
+    SpawnPoolEntry& entry = g_spawn_pool.entries[point_index][hull_index];
+    if (IsSpawnPoolEntryFresh(entry, point_origin))
+    {
+        g_spawn_pool.hits++;
+    }
+    else
+    {
+        g_spawn_pool.misses++;
+        FillSpawnPoolEntry(entry, g_spawn_pool.hulls[hull_index], point_origin);
+    }
+
+    if (!entry.is_valid || !IsSpawnVolumeClear(point_origin, mins, maxs))
+        return false;
+
+    out_origin = entry.adjusted_origin;
+    return true;
+}
+
+bool Horde_SpawnPointKnownBlocked(const edict_t* spawn_point, horde::MonsterTypeID typeId)
+{
+    const uint16_t point_index = GetSpawnPointIndexSafe(spawn_point);
+    const int hull_index = GetSpawnPoolHull(typeId);
+    if (point_index >= SpawnPointsSoA::MAX_STATE_SPAWN_POINTS || hull_index < 0)
+        return false;
+
+    const SpawnPoolEntry& entry = g_spawn_pool.entries[point_index][hull_index];
+    return IsSpawnPoolEntryFresh(entry, spawn_point->s.origin) && !entry.is_valid;
+}
+
+void Horde_PrimeSpawnPositionPool()
+{
+    for (const MonsterTypeInfo* monster_info : g_eligible_monsters_for_wave)
+        GetSpawnPoolHull(monster_info->typeId);
+}
+
+void Horde_RefreshSpawnPositionPool()
+{
+    PROFILE_SCOPE("RefreshSpawnPositionPool");
+
+    const int budget = g_horde_spawn_pool_budget ? g_horde_spawn_pool_budget->integer : 0;
+    if (budget <= 0 || !g_spawn_pool_initialized || !g_spawn_pool.hull_count)
+        return;
+
+    const size_t point_count = std::min<size_t>(g_spawn_point_list.size(), SpawnPointsSoA::MAX_STATE_SPAWN_POINTS);
+    const size_t total = point_count * g_spawn_pool.hull_count;
+    if (!total)
+        return;
+
+    // walk at most one full lap looking for stale entries; fresh ones cost a compare
+    int validated = 0;
+    for (size_t scanned = 0; scanned < total && validated < budget; ++scanned)
+    {
+        if (g_spawn_pool.refresh_cursor >= total)
+            g_spawn_pool.refresh_cursor = 0;
+
+        const size_t cursor = g_spawn_pool.refresh_cursor++;
+        const size_t point_index = cursor % point_count;
+        const size_t hull_index = cursor / point_count;
+
+        const edict_t* spawn_point = g_spawn_point_list[point_index];
+        if (!spawn_point || !spawn_point->inuse)
+            continue;
+
+        const SpawnPoolHull& hull = g_spawn_pool.hulls[hull_index];
+        // flying-only lanes never take ground monsters
+        if (spawn_point->style == 1 && !hull.is_flying)
+            continue;
+
+        SpawnPoolEntry& entry = g_spawn_pool.entries[point_index][hull_index];
+        if (IsSpawnPoolEntryFresh(entry, spawn_point->s.origin))
+            continue;
+
+        FillSpawnPoolEntry(entry, hull, spawn_point->s.origin);
+        g_spawn_pool.refreshed++;
+        validated++;
+    }
+}
+
+void Horde_ResetSpawnPositionPool()
+{
+    g_spawn_pool.Reset();
+    g_spawn_pool_initialized = true;
+}
+
+void Horde_PrintSpawnPositionPoolStats()
+{
+    const uint64_t lookups = g_spawn_pool.hits + g_spawn_pool.misses;
+    gi.Com_PrintFmt("Spawn position pool: {} hulls, {} points, budget {}/frame\n",
+        g_spawn_pool.hull_count, g_spawn_point_list.size(),
+        g_horde_spawn_pool_budget ? g_horde_spawn_pool_budget->integer : 0);
+    gi.Com_PrintFmt("  {} hits, {} misses ({:.1f}% hit), {} refreshed ahead, {} unpooled\n",
+        g_spawn_pool.hits, g_spawn_pool.misses, lookups ? 100.0 * g_spawn_pool.hits / lookups : 0.0,
+        g_spawn_pool.refreshed, g_spawn_pool.unpooled);
+}
+
 // ============================================================================
 // SPAWN BATCH PLANNING AND EXECUTION
 // ============================================================================
@@ -798,6 +1077,9 @@ void PlanMonsterSpawnBatch(
     if (num_to_plan <= 0)
         return;
 
+    PROFILE_SCOPE("PlanMonsterSpawnBatch");
+    const auto plan_start = std::chrono::steady_clock::now();
+
     // Optimized reserve: only allocate if capacity insufficient (avoids reallocation)
     size_t reserve_size = std::min(static_cast<size_t>(num_to_plan), MAX_ENTITIES_PER_FRAME);
     if (g_spawn_system.spawn_plan.capacity() < reserve_size) {
@@ -822,6 +1104,7 @@ void PlanMonsterSpawnBatch(
     int planned_count = 0;
     int failed_validation = 0;
     int failed_monster_pick = 0;
+    int skipped_blocked = 0;
     bool plan_capacity_exhausted = false;
 
     // Points already assigned within THIS planning batch. The round-robin prefers points not yet
@@ -967,6 +1250,15 @@ void PlanMonsterSpawnBatch(
                 continue;
             }
 
+            // The pool already knows this monster doesn't fit on the point itself; execution
+            // would only fall through to the alternative-position search. Prefer another point.
+            // Still eligible through the oldest-cooldown fallbacks above.
+            if (Horde_SpawnPointKnownBlocked(spawn_point, monster_type_id))
+            {
+                skipped_blocked++;
+                continue;
+            }
+
             if (developer->integer > 2 && monster_is_flying)
             {
                 gi.Com_PrintFmt("FLYING SPAWN POINT: using {} bucket at {}.\n",
@@ -1038,6 +1330,7 @@ void PlanMonsterSpawnBatch(
 
     auto try_plan_next_monster = [&]() -> bool
     {
+        PROFILE_SCOPE("PlanMonsterSpawnBatch/monster");
         monster_pick_attempts++;
         horde::MonsterTypeID monster_type_id = G_HordePickMonsterType(
             nullptr, currentLevel_param, current_actual_wave_type_param,
@@ -1079,12 +1372,16 @@ void PlanMonsterSpawnBatch(
         try_plan_next_monster();
     }
 
-/*    if (developer->integer > 1)
+    if (developer->integer > 1)
     {
-        gi.Com_PrintFmt("SPAWN PLAN: Target={}, Planned={}, FailedValidation={}, FailedPick={}, PointsChecked={}/{} (Remaining: {})\n",
-                        num_to_plan, planned_count, failed_validation, failed_monster_pick,
-                        points_checked, max_points_to_check, g_horde_local.num_to_spawn);
-    }*/
+        const auto plan_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - plan_start).count();
+        gi.Com_PrintFmt("SPAWN PLAN: Planned={}/{} in {}us ({:.1f}us/monster), FailedValidation={}, FailedPick={}, SkippedBlocked={}, PointsChecked={}/{}\n",
+                        planned_count, num_to_plan, plan_us,
+                        planned_count ? static_cast<double>(plan_us) / planned_count : 0.0,
+                        failed_validation, failed_monster_pick, skipped_blocked,
+                        points_checked, max_points_to_check);
+    }
 }
 
 void PlanNextSpawnBatch()
@@ -1191,7 +1488,7 @@ void RebuildSpawnPointCacheIfNeeded()
 
         if (!g_spawn_system.potential_spawn_points.empty())
         {
-            std::shuffle(g_spawn_system.potential_spawn_points.begin(), g_spawn_system.potential_spawn_points.end(), mt_rand);
+            std::shuffle(g_spawn_system.potential_spawn_points.begin(), g_spawn_system.potential_spawn_points.end(), rng_stream(rng_stream_t::spawn));
         }
 
         g_spawn_system.spawn_point_shuffle_index = 0;
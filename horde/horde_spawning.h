@@ -227,6 +227,32 @@ bool TryAlternativeSpawnPosition(
     vec3_t& final_origin,
     vec3_t& final_angles);
 
+// ============================================================================
+// SPAWN POSITION POOL
+// ============================================================================
+
+// Validates a spawn point's own origin for a monster type: pooled world-geometry
+// result plus a fresh occupancy trace. Same answer as IsPositionPhysicallyValid
+// at the point origin; out_origin receives the floor-adjusted position.
+bool Horde_ValidateSpawnPointOrigin(edict_t* spawn_point, horde::MonsterTypeID typeId, vec3_t& out_origin);
+
+// True when the pool already knows the point's origin can't fit this monster type.
+// Never traces; points that haven't been validated yet report false.
+bool Horde_SpawnPointKnownBlocked(const edict_t* spawn_point, horde::MonsterTypeID typeId);
+
+// Registers the hulls of this wave's eligible monsters so the refresh fills them
+// before the first batch needs them
+void Horde_PrimeSpawnPositionPool();
+
+// Validates up to g_horde_spawn_pool_budget stale pool entries; called once per frame
+void Horde_RefreshSpawnPositionPool();
+
+// Drops every pooled result (spawn point indices changed)
+void Horde_ResetSpawnPositionPool();
+
+// Prints pool counters (sv spawnpool)
+void Horde_PrintSpawnPositionPoolStats();
+
 // ============================================================================
 // SPAWN BATCH PLANNING AND EXECUTION
 // ============================================================================
@@ -3,6 +3,7 @@
 #include "../m_flash.h"
 #include "../bots/bot_includes.h"
 #include "g_horde_benefits.h"
+#include "g_gib_pool.h"
 #include "horde_ids.h"
 #include <array>
 #include <bitset>
@@ -112,6 +113,7 @@ static void FireSmartRocket(edict_t* ent, const vec3_t& start, const vec3_t& dir
     //     check_dodge(ent, rocket->s.origin, dir, speed);
 
     gi.linkentity(rocket);
+    GibPool::Add(rocket, GibPool::KIND_PROJECTILE);
 }
 
 static void FlyerAttackHyperblaster(edict_t* ent, flyer_data_t* data) {
@@ -314,11 +314,10 @@ T_RadiusDamage
 void T_SlamRadiusDamage(vec3_t point, edict_t* inflictor, edict_t* attacker, float damage, float kick, edict_t* ignore, float radius, mod_t mod)
 {
 	float	 points;
-	edict_t* ent = nullptr;
 	vec3_t	 v;
 	vec3_t	 dir;
 
-	while ((ent = findradius(ent, inflictor->s.origin, radius * 2.f)) != nullptr)
+	for (edict_t* ent : radius_edicts(inflictor->s.origin, radius * 2.f))
 	{
 		if (ent == ignore)
 			continue;
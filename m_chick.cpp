@@ -450,8 +450,7 @@ THINK(heat_chick_think) (edict_t* self) -> void
 		acquire = nullptr;
 		vec3_t const fwd = AngleVectors(self->s.angles).forward;
 
-		edict_t* target = nullptr;
-		while ((target = findradius(target, self->s.origin, 1024)) != nullptr)
+		for (edict_t* target : radius_edicts(self->s.origin, 1024))
 		{
 			// Look for enemies (not clients like turret does)
 			if (self->owner == target || !target->takedamage || !target->inuse || target->health <= 0 || !visible(self, target))
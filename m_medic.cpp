@@ -13,6 +13,7 @@ MEDIC
 #include "m_flash.h"
 #include "shared.h"
 #include "monster_constants.h"
+#include "horde/g_heal_registry.h"
 #include <boost/container/small_vector.hpp>
 
 // Add these prototypes near the top
@@ -662,41 +663,36 @@ static bool PlayerNeedsArmor(edict_t *player)
 
 edict_t *healFindMonster(edict_t *self, float radius)
 {
-	edict_t *ent = nullptr;
 	edict_t *best_dead = nullptr;
 	edict_t *best_injured_teammate = nullptr;
 	edict_t *best_player_needs_armor = nullptr;
 	int best_player_armor_value = 0;
 
-	while ((ent = findradius(ent, self->s.origin, radius)) != nullptr)
+	// candidates are monsters, bodyque entities and players: dead and injured
+	// monsters come from the heal registry, players are few enough to check directly
+	auto consider = [&](edict_t *ent)
 	{
 		if (ent == self)
-			continue;
-		// Check for monsters, bodyque entities, and players
-		if (!(ent->svflags & SVF_MONSTER) && strcmp(ent->classname, "bodyque") != 0 && !ent->client)
-			continue;
+			return;
 		if (ent->monsterinfo.aiflags & AI_GOOD_GUY)
-			continue;
+			return;
 		// check to make sure we haven't bailed on this guy already
 		if ((ent->monsterinfo.badMedic1 == self) || (ent->monsterinfo.badMedic2 == self))
-			continue;
+			return;
 		if (ent->monsterinfo.healer)
 			// FIXME - this is correcting a bug that is somewhere else
 			// if the healer is a monster, and it's in medic mode .. continue .. otherwise
 			//   we will override the healer, if it passes all the other tests
 			if ((ent->monsterinfo.healer->inuse) && (ent->monsterinfo.healer->health > 0) &&
 				(ent->monsterinfo.healer->svflags & SVF_MONSTER) && (ent->monsterinfo.healer->monsterinfo.aiflags & AI_MEDIC))
-				continue;
+				return;
 
 		// FIXME - there's got to be a better way ..
 		// make sure we don't spawn people right on top of us
 		if (realrange(self, ent) <= MEDIC_MIN_DISTANCE)
-			continue;
+			return;
 		if (!visible(self, ent))
-			continue;
-		// Skip player_noise entities but allow actual players
-		if (!strcmp(ent->classname, "player_noise"))
-			continue;
+			return;
 
 		// Figure out what this entity might need
 		bool needs_health = ent->health > 0 && ent->health < ent->max_health;
@@ -715,7 +711,7 @@ edict_t *healFindMonster(edict_t *self, float radius)
 		if (ent->health > 0)
 		{
 			if (!needs_health && !needs_player_armor)
-				continue;
+				return;
 
 			// Determine if this is a valid heal target
 			bool can_heal = false;
@@ -765,24 +761,40 @@ edict_t *healFindMonster(edict_t *self, float radius)
 				}
 			}
 
-			continue; // Don't consider alive entities for revival
+			return; // Don't consider alive entities for revival
 		}
 
 		// Dead entity handling (for revival) - revive ANY dead corpse
 		if ((ent->nextthink) && (ent->think != monster_dead_think))
-			continue;
+			return;
 
 		// Skip gibbed monsters - they cannot be resurrected
 		if (ent->gib_health && ent->health < ent->gib_health)
-			continue;
+			return;
 
 		// For dead entities, pick the best one regardless of team (we'll assign them to our team)
 		if (!best_dead || ent->max_health > best_dead->max_health)
 		{
 			best_dead = ent;
 		}
+	};
+
+	// players first, so candidates are seen in edict order like findradius did
+	const float radius_sq = radius * radius;
+
+	for (edict_t *player : active_players())
+	{
+		if (player->solid == SOLID_NOT)
+			continue;
+		if ((self->s.origin - (player->s.origin + (player->mins + player->maxs) * 0.5f)).lengthSquared() > radius_sq)
+			continue;
+
+		consider(player);
 	}
 
+	for (edict_t *ent : HealRegistry::Query(self->s.origin, radius, HealRegistry::KIND_CORPSE | HealRegistry::KIND_INJURED))
+		consider(ent);
+
 	// Priority order:
 	// Friendly/summoned medics should heal living allies before resurrecting corpses,
 	// so they don't ignore hurt players standing near a body.
@@ -1958,10 +1970,9 @@ void medic_hook_retract(edict_t *self)
 // Search for nearby enemies (used to interrupt healing if threat appears)
 bool mymedic_findenemy(edict_t *self)
 {
-	edict_t *target = nullptr;
 	float search_radius = 1024.0f;
 
-	while ((target = findradius(target, self->s.origin, search_radius)) != nullptr)
+	for (edict_t* target : radius_edicts(self->s.origin, search_radius))
 	{
 		// Check if this is a valid enemy target
 		if (target == self)
@@ -6,6 +6,8 @@
 #include "horde/horde_ids.h"
 #include "horde/p_flyer_morph.h"
 #include "horde/g_horde_phys.h"
+#include "horde/g_monster_table.h"
+#include "q_vec3_batch.h"
 
 // ============================================================================
 // Movement Constants - Extracted for performance and maintainability
@@ -192,28 +194,43 @@ static vec3_t CalculateMonsterRepulsion(edict_t* ent)
 		? HordePhys::g_entity_grid.QueryRadiusFiltered(ent->s.origin, search_radius, HordePhys::EntityGrid::TYPE_COMBAT)
 		: std::span<edict_t* const>{};
 
+	const MonsterTable::table_t& monsters = MonsterTable::Table();
+
+	// Skip self, non-monsters, and dead things; the monster table answers without
+	// reading the neighbor's edict, which is only touched once it's in range
+	boost::container::small_vector<int32_t, 64> neighbor_rows;
+	boost::container::small_vector<vec3_t, 64> neighbor_origins;
 	for (edict_t* other : nearby_entities)
 	{
-		// Skip self, non-monsters, and dead things
-		if (other == ent || !other->inuse || !(other->svflags & SVF_MONSTER))
+		const int32_t row = MonsterTable::Row(other);
+		if (other == ent || row < 0 || !monsters.alive(row))
 			continue;
 
-		if (other->health <= 0 || other->deadflag)
-			continue;
+		neighbor_rows.push_back(row);
+		neighbor_origins.push_back(monsters.origin(row));
+	}
+
+	// Calculate distance using squared distance for performance, all neighbors at once
+	boost::container::small_vector<float, 64> neighbor_dist_sq(neighbor_rows.size());
+	batch_distance_squared(std::span<const vec3_t>(neighbor_origins.data(), neighbor_origins.size()), ent->s.origin, neighbor_dist_sq.data());
+
+	for (size_t i = 0; i < neighbor_rows.size(); i++)
+	{
+		const int32_t row = neighbor_rows[i];
+		edict_t* other = monsters.edict(row);
 
 		//// Skip repulsion between summoned Stroggs - they can walk through each other
 		//if (ent->monsterinfo.issummoned && other->monsterinfo.issummoned)
 		//	continue;
 
-		// Calculate distance using squared distance for performance
-		vec3_t diff = ent->s.origin - other->s.origin;
-		const float dist_sq = diff.lengthSquared();
+		vec3_t diff = ent->s.origin - neighbor_origins[i];
+		const float dist_sq = neighbor_dist_sq[i];
 
 		// Per-pair engagement: keep their bboxes from overlapping. Engage out to the sum of both
 		// horizontal radii (+margin) so neither comes to rest inside the other's box, but never below
 		// this monster's personal space. Repulsion only nudges the move vector - monsters stay non-solid
 		// and can still pass THROUGH each other; they just won't settle stacked on one spot.
-		const float other_radius = std::max({ other->maxs.x, -other->mins.x, other->maxs.y, -other->mins.y });
+		const float other_radius = monsters.radius[row];
 		const float pair_space = std::max(personal_space, ent_radius + other_radius + BBOX_SEPARATION_MARGIN);
 		const float pair_space_sq = pair_space * pair_space;
 
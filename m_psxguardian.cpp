@@ -594,8 +594,7 @@ THINK(heat_guardianpsx_think) (edict_t* self) -> void
 		vec3_t const fwd = AngleVectors(self->s.angles).forward;
 
 		// The findradius loop now runs much less frequently.
-		edict_t* target = nullptr;
-		while ((target = findradius(target, self->s.origin, 1024)) != nullptr)
+		for (edict_t* target : radius_edicts(self->s.origin, 1024))
 		{
 			if (self->owner == target || !target->client || !target->inuse || target->health <= 0)
 				continue;
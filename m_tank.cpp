@@ -2692,7 +2692,7 @@ void Monster_MoveSpawn(edict_t* self) {
 	}
 
 	// Shuffle direction order for variety
-	std::shuffle(direction_indices.begin(), direction_indices.end(), mt_rand);
+	std::shuffle(direction_indices.begin(), direction_indices.end(), *rng_current);
 
 	for (int attempt = 0; attempt < MAX_ATTEMPTS && attempt < NUM_SPAWN_DIRECTIONS; attempt++) {
 		const int direction_idx = direction_indices[attempt];
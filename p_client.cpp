@@ -7,6 +7,7 @@
 #include "horde/g_laser.h"
 #include "horde/g_horde_benefits.h"
 #include "horde/g_horde.h"
+#include "horde/g_heal_registry.h"
 #include "horde/horde_ids.h"
 #include "horde/p_flyer_morph.h"
 #include "horde/p_brain_morph.h"
@@ -1868,7 +1869,7 @@ select_spawn_result_t SelectDeathmatchSpawnPoint(bool farthest, bool force_spawn
 	{
 		// Random spawn selection (avoid the 2 closest to any player)
 		if (spawn_points.size() > 2)
-			std::shuffle(spawn_points.begin() + 2, spawn_points.end(), mt_rand);
+			std::shuffle(spawn_points.begin() + 2, spawn_points.end(), rng_stream(rng_stream_t::spawn));
 
 		// Pick first clear spawn from shuffled list
 		if (spawn_points.size() > 2)
@@ -2377,13 +2378,17 @@ void CopyToBodyQue(edict_t* ent)
 	// Don't link if body would be crushed immediately
 	trace_t tr = gi.trace(body->s.origin, body->mins, body->maxs, body->s.origin, body, MASK_SOLID);
 	if (!tr.startsolid)
+	{
 		gi.linkentity(body);
+		HealRegistry::Add(body, HealRegistry::KIND_CORPSE);
+	}
 	else
 	{
 		// Body would spawn in solid - just disable it
 		body->solid = SOLID_NOT;
 		body->takedamage = false;
 		body->s.modelindex = 0;
+		HealRegistry::Remove(body);
 	}
 }
 
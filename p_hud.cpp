@@ -449,7 +449,8 @@ void BeginIntermission(edict_t* targ)
 }
 
 constexpr size_t MAX_SCOREBOARD_SIZE = 1024;
-constexpr size_t SCOREBOARD_ENTRY_RESERVE_SIZE = 128; 
+// kept free of player rows for the fraglimit/timelimit lines
+constexpr size_t SCOREBOARD_TAIL_RESERVE = 100;
 
 /*
 ==================
@@ -459,12 +460,6 @@ DeathmatchScoreboardMessage
 */
 void DeathmatchScoreboardMessage(edict_t* ent, edict_t* killer)
 {
-	std::string entry_buffer;
-	std::string layout_string_buffer; // Renamed to avoid conflict with 'string' from <string>
-	
-	entry_buffer.reserve(SCOREBOARD_ENTRY_RESERVE_SIZE); 
-	layout_string_buffer.reserve(MAX_SCOREBOARD_SIZE);
-
 	int x, y;
 	gclient_t* cl;
 	// edict_t* cl_ent; // Will get this from PlayerScoreInfo
@@ -515,8 +510,15 @@ void DeathmatchScoreboardMessage(edict_t* ent, edict_t* killer)
 
 	size_t players_to_display_count = std::min(sorted_players_info.size(), (size_t)16);
 
+	// fixed-size writer; anything past the limit is dropped whole,
+	// never cut in the middle of a token or an if/endif block
+	layout_writer_t<MAX_SCOREBOARD_SIZE> sb;
+
+	bool rows_truncated = false;
+
 	for (size_t i = 0; i < players_to_display_count; i++)
 	{
+		const size_t row_start = sb.size();
 		const auto& p_info = sorted_players_info[i];
 		cl = &game.clients[p_info.client_idx]; 
 
@@ -531,65 +533,37 @@ void DeathmatchScoreboardMessage(edict_t* ent, edict_t* killer)
 				DMGame.DogTag(p_info.entity, killer, &tag);
 		}
 
-		entry_buffer.clear(); 
+		sb.xv(x + 32).yv(y);
 		if (tag)
-		{
-			fmt::format_to(std::back_inserter(entry_buffer), FMT_STRING("xv {} yv {} picn {} "), x + 32, y, tag);
-		}
+			sb.picn(tag);
 		else
-		{
-			fmt::format_to(std::back_inserter(entry_buffer), FMT_STRING("xv {} yv {} dogtag {} "), x + 32, y, p_info.client_idx);
-		}
-		
-		if (layout_string_buffer.length() + entry_buffer.length() > MAX_SCOREBOARD_SIZE)
-			break;
-		layout_string_buffer += entry_buffer;
-		
-		entry_buffer.clear();
-		fmt::format_to(std::back_inserter(entry_buffer),
-			FMT_STRING("client {} {} {} {} {} {} "),
-			x, y, p_info.client_idx, cl->resp.score, cl->ping, (int32_t)(level.time - cl->resp.entertime).minutes());
+			sb.dogtag(p_info.client_idx);
 
-		if (layout_string_buffer.length() + entry_buffer.length() > MAX_SCOREBOARD_SIZE)
-			break;
-		layout_string_buffer += entry_buffer;
-	}
+		sb.client(x, y, p_info.client_idx, cl->resp.score, cl->ping, (int32_t)(level.time - cl->resp.entertime).minutes());
 
-	// Add remaining info with overflow protection
-	if (fraglimit->integer && layout_string_buffer.length() < MAX_SCOREBOARD_SIZE - 100)
-	{
-		fmt::format_to(std::back_inserter(layout_string_buffer), FMT_STRING("xv -20 yv -10 loc_string2 1 $g_score_frags \"{}\" "), fraglimit->integer);
-	}
-	if (timelimit->value && !level.intermissiontime && layout_string_buffer.length() < MAX_SCOREBOARD_SIZE - 100)
-	{
-		fmt::format_to(std::back_inserter(layout_string_buffer), FMT_STRING("xv 340 yv -10 time_limit {} "), gi.ServerFrame() + ((gtime_t::from_min(timelimit->value) - level.time)).milliseconds() / gi.frame_time_ms);
+		// take back a row that only partly fit or ate into the tail reserve
+		if (sb.truncated() || sb.size() > MAX_SCOREBOARD_SIZE - SCOREBOARD_TAIL_RESERVE)
+		{
+			sb.rewind(row_start);
+			rows_truncated = true;
+			break;
+		}
 	}
 
-	if (level.intermissiontime && layout_string_buffer.length() < MAX_SCOREBOARD_SIZE - 150)
-		fmt::format_to(std::back_inserter(layout_string_buffer), FMT_STRING("ifgef {} yb -48 xv 0 loc_cstring2 0 \"$m_eou_press_button\" endif "), (level.intermission_server_frame + (5_sec).frames()));
+	if (fraglimit->integer)
+		sb.xv(-20).yv(-10).loc_text("loc_string", true, "$g_score_frags", G_Fmt("{}", fraglimit->integer));
+	if (timelimit->value && !level.intermissiontime)
+		sb.xv(340).yv(-10).time_limit(gi.ServerFrame() + ((gtime_t::from_min(timelimit->value) - level.time)).milliseconds() / gi.frame_time_ms);
 
-	// Final safety check - DON'T truncate blindly as it could cut in the middle of if/endif blocks
-	// The size checks above with sufficient margins should prevent this, but log if we exceed
-	if (layout_string_buffer.length() >= MAX_SCOREBOARD_SIZE)
-	{
-		if (developer && developer->integer)
-			gi.Com_PrintFmt("ERROR: Scoreboard size {} exceeds MAX_SCOREBOARD_SIZE {}, layout may be corrupted\n",
-				layout_string_buffer.length(), MAX_SCOREBOARD_SIZE);
-		// Don't send corrupted layout - send empty instead
-		layout_string_buffer.clear();
-	}
+	if (level.intermissiontime)
+		sb.ifgef(level.intermission_server_frame + (5_sec).frames()).yb(-48).xv(0).loc_text("loc_cstring", true, "$m_eou_press_button").endif();
 
-	// Validate layout before sending to client
-	if (!layout_string_buffer.empty() && !ValidateLayoutString(layout_string_buffer, "DeathmatchScoreboardMessage"))
-	{
-		// If validation fails, don't send corrupted layout
-		if (developer && developer->integer)
-			gi.Com_Print("ERROR: DeathmatchScoreboardMessage layout failed validation, not sending\n");
-		return;
-	}
+	if ((rows_truncated || sb.truncated()) && developer && developer->integer)
+		gi.Com_PrintFmt("WARNING: Scoreboard truncated at {} bytes (MAX_SCOREBOARD_SIZE {})\n",
+			sb.size(), MAX_SCOREBOARD_SIZE);
 
 	gi.WriteByte(svc_layout);
-	gi.WriteString(layout_string_buffer.c_str());
+	gi.WriteString(sb.c_str());
 }
 /*
 ==================
@@ -872,33 +846,96 @@ struct powerup_info_t
 
 /*
 ===============
-G_SetStats
+Stat groups
+
+Some stats only change with a few inputs, so they're grouped and a group is
+only recomputed when it was invalidated: wave and vote text explicitly, by
+whoever sets their configstrings, health and inventory by comparing against
+the values the group was last computed from. The last result is kept per
+client and copied back into the stats of groups that weren't recomputed, so
+anything that wrote those slots in between (a chasecam copy, a vote notice)
+is undone as a full recompute would.
+g_stats_cache 0 recomputes every group every frame; g_stats_verify 1 runs
+the full recompute alongside and reports any stat that came out different.
 ===============
 */
-void G_SetStats(edict_t* ent)
+struct stat_cache_t
 {
-	gitem_t* item;
-	item_id_t index;
-	int		  cells = 0;
-	item_id_t power_armor_type;
-	unsigned int invIndex;
+	stat_group_t					dirty = STATS_ALL;
+	stat_group_t					every_frame = STATS_NONE; // more than three keys rotate through the HUD
+
+	// what the health and inventory groups were last computed from
+	int32_t							health = 0;
+	int32_t							health_icon = 0;
+	int32_t							horde = 0;
+	ent_flags_t						power_flags = FL_NONE;
+	int32_t							infinite_ammo = 0;
+	bool							deathmatch = false;
+	std::array<int32_t, IT_TOTAL>	inventory{};
+
+	std::array<int16_t, MAX_STATS>	stats{};
+};
 
-	//
-	// health
-	//
+static std::vector<stat_cache_t> stat_caches;
+static std::array<uint64_t, STATS_GROUP_COUNT> stat_recomputes;
+static uint64_t stat_updates, stat_mismatches;
+
+template<typename Fn>
+static void G_ForEachGroupStat(stat_group_t groups, Fn&& fn)
+{
+	if (groups & STATS_HEALTH)
+	{
+		fn(STAT_HEALTH_ICON);
+		fn(STAT_HEALTH);
+	}
+
+	if (groups & STATS_VOTE)
+		fn(STAT_VOTESTRING);
+
+	if (groups & STATS_WAVE)
+		fn(STAT_HORDEMSG);
+
+	if (groups & STATS_INVENTORY)
+	{
+		fn(STAT_WEAPONS_OWNED_1);
+		fn(STAT_WEAPONS_OWNED_2);
+
+		for (int32_t stat = STAT_AMMO_INFO_START; stat <= STAT_AMMO_INFO_END; stat++)
+			fn(static_cast<player_stat_t>(stat));
+		for (int32_t stat = STAT_POWERUP_INFO_START; stat <= STAT_POWERUP_INFO_END; stat++)
+			fn(static_cast<player_stat_t>(stat));
+
+		// keys aren't shown in deathmatch, and the slots are left alone
+		if (!G_IsDeathmatch())
+		{
+			fn(STAT_KEY_A);
+			fn(STAT_KEY_B);
+			fn(STAT_KEY_C);
+		}
+	}
+}
+
+static void G_SetHealthStats(edict_t* ent)
+{
 	if (ent->s.renderfx & RF_USE_DISGUISE)
 		ent->client->ps.stats[STAT_HEALTH_ICON] = level.disguise_icon;
 	else
 		ent->client->ps.stats[STAT_HEALTH_ICON] = level.pic_health;
 	ent->client->ps.stats[STAT_HEALTH] = ent->health;
+}
 
-	if (ctfgame.election != ELECT_NONE) { 
+static void G_SetVoteStats(edict_t* ent)
+{
+	if (ctfgame.election != ELECT_NONE) {
 		ent->client->ps.stats[STAT_VOTESTRING] = CONFIG_VOTE_INFO;
 	}
 	else {
 		ent->client->ps.stats[STAT_VOTESTRING] = 0;
 	}
+}
 
+static void G_SetWaveStats(edict_t* ent)
+{
 	// Horde Status
 	if (g_horde->integer && gi.get_configstring(CONFIG_HORDEMSG)[0] != '\0') {
 		ent->client->ps.stats[STAT_HORDEMSG] = CONFIG_HORDEMSG;
@@ -906,6 +943,262 @@ void G_SetStats(edict_t* ent)
 	else {
 		ent->client->ps.stats[STAT_HORDEMSG] = 0;
 	}
+}
+
+// returns true if the keys shown rotate with time
+static bool G_SetInventoryStats(edict_t* ent)
+{
+	bool rotating = false;
+
+	//
+	// weapons
+	//
+	uint32_t weaponbits = 0;
+
+	for (unsigned int invIndex = IT_WEAPON_GRAPPLE; invIndex <= IT_WEAPON_DISRUPTOR; invIndex++)
+	{
+		if (ent->client->pers.inventory[invIndex])
+		{
+			weaponbits |= 1 << GetItemByIndex((item_id_t)invIndex)->weapon_wheel_index;
+		}
+	}
+
+	ent->client->ps.stats[STAT_WEAPONS_OWNED_1] = (weaponbits & 0xFFFF);
+	ent->client->ps.stats[STAT_WEAPONS_OWNED_2] = (weaponbits >> 16);
+
+	//
+	// ammo
+	//
+	memset(&ent->client->ps.stats[STAT_AMMO_INFO_START], 0, sizeof(uint16_t) * NUM_AMMO_STATS);
+	for (unsigned int ammoIndex = AMMO_BULLETS; ammoIndex < AMMO_MAX; ++ammoIndex)
+	{
+		gitem_t* ammo = GetItemByAmmo((ammo_t)ammoIndex);
+		uint16_t const val = G_CheckInfiniteAmmo(ammo) ? AMMO_VALUE_INFINITE : clamp(ent->client->pers.inventory[ammo->id], 0, AMMO_VALUE_INFINITE - 1);
+		G_SetAmmoStat((uint16_t*)&ent->client->ps.stats[STAT_AMMO_INFO_START], ammo->ammo_wheel_index, val);
+	}
+
+	// owned powerups
+	memset(&ent->client->ps.stats[STAT_POWERUP_INFO_START], 0, sizeof(uint16_t) * NUM_POWERUP_STATS);
+	for (unsigned int powerupIndex = POWERUP_SCREEN; powerupIndex < POWERUP_MAX; ++powerupIndex)
+	{
+		gitem_t* powerup = GetItemByPowerup((powerup_t)powerupIndex);
+		uint16_t val;
+
+		switch (powerup->id)
+		{
+		case IT_ITEM_POWER_SCREEN:
+		case IT_ITEM_POWER_SHIELD:
+			if (!ent->client->pers.inventory[powerup->id])
+				val = 0;
+			else if (ent->flags & FL_POWER_ARMOR)
+				val = 2;
+			else
+				val = 1;
+			break;
+		case IT_ITEM_FLASHLIGHT:
+			if (!ent->client->pers.inventory[powerup->id])
+				val = 0;
+			else if (ent->flags & FL_FLASHLIGHT)
+				val = 2;
+			else
+				val = 1;
+			break;
+		default:
+			val = clamp(ent->client->pers.inventory[powerup->id], 0, 3);
+			break;
+		}
+
+		G_SetPowerupStat((uint16_t*)&ent->client->ps.stats[STAT_POWERUP_INFO_START],
+			powerup->powerup_wheel_index, val);
+	}
+
+	// [Paril-KEX] key display
+	if (!G_IsDeathmatch())
+	{
+		int32_t key_offset = 0;
+		player_stat_t stat = STAT_KEY_A;
+
+		ent->client->ps.stats[STAT_KEY_A] =
+			ent->client->ps.stats[STAT_KEY_B] =
+			ent->client->ps.stats[STAT_KEY_C] = 0;
+
+		// Use static thread_local to avoid per-frame heap allocations
+		static thread_local boost::container::small_vector<item_id_t, 4> keys_held;
+		keys_held.clear();
+
+		for (size_t i = 0; i < IT_TOTAL; ++i) // Iterate using index for global C array
+		{
+            const gitem_t& current_item = itemlist[i];
+			if (!(current_item.flags & IF_KEY))
+				continue;
+			else if (!ent->client->pers.inventory[current_item.id])
+				continue;
+
+			keys_held.push_back(current_item.id);
+		}
+
+		if (!keys_held.empty()) // Proceed only if keys are held
+		{
+			if (keys_held.size() > 3)
+			{
+				key_offset = (int32_t)(level.time.seconds() / 5);
+				rotating = true;
+			}
+
+			for (size_t i = 0; i < std::min(keys_held.size(), (size_t)3); i++, stat = (player_stat_t)(stat + 1))
+			{
+				size_t key_index_to_display = (i + key_offset) % keys_held.size();
+				ent->client->ps.stats[stat] = gi.imageindex(GetItemByIndex(keys_held[key_index_to_display])->icon);
+			}
+		}
+	}
+
+	return rotating;
+}
+
+static void G_SetGroupStats(edict_t* ent, stat_group_t groups, stat_group_t& every_frame)
+{
+	every_frame = STATS_NONE;
+
+	if (groups & STATS_HEALTH)
+		G_SetHealthStats(ent);
+	if (groups & STATS_VOTE)
+		G_SetVoteStats(ent);
+	if (groups & STATS_WAVE)
+		G_SetWaveStats(ent);
+	if ((groups & STATS_INVENTORY) && G_SetInventoryStats(ent))
+		every_frame |= STATS_INVENTORY;
+}
+
+// Invalidate the health and inventory groups if what they're computed from changed
+static void G_CheckStatSources(edict_t* ent, stat_cache_t& cache)
+{
+	const int32_t health_icon = (ent->s.renderfx & RF_USE_DISGUISE) ? level.disguise_icon : level.pic_health;
+
+	if (cache.health != ent->health || cache.health_icon != health_icon)
+	{
+		cache.health = ent->health;
+		cache.health_icon = health_icon;
+		cache.dirty |= STATS_HEALTH;
+	}
+
+	if (cache.horde != g_horde->integer)
+	{
+		cache.horde = g_horde->integer;
+		cache.dirty |= STATS_WAVE;
+	}
+
+	const ent_flags_t power_flags = ent->flags & (FL_POWER_ARMOR | FL_FLASHLIGHT);
+	const bool deathmatch = G_IsDeathmatch();
+
+	if (cache.power_flags != power_flags || cache.infinite_ammo != g_infinite_ammo->integer ||
+		cache.deathmatch != deathmatch || cache.inventory != ent->client->pers.inventory)
+	{
+		cache.power_flags = power_flags;
+		cache.infinite_ammo = g_infinite_ammo->integer;
+		cache.deathmatch = deathmatch;
+		cache.inventory = ent->client->pers.inventory;
+		cache.dirty |= STATS_INVENTORY;
+	}
+}
+
+// g_stats_verify: the groups from scratch must come out the same
+static void G_VerifyGroupStats(edict_t* ent)
+{
+	const std::array<int16_t, MAX_STATS> incremental = ent->client->ps.stats;
+	stat_group_t every_frame;
+
+	G_SetGroupStats(ent, STATS_ALL, every_frame);
+
+	G_ForEachGroupStat(STATS_ALL, [&](player_stat_t stat) {
+		if (ent->client->ps.stats[stat] == incremental[stat])
+			return;
+
+		stat_mismatches++;
+		gi.Com_PrintFmt("G_SetStats: {} stat {} is {}, a full recompute gives {}\n",
+			*ent, static_cast<int32_t>(stat), incremental[stat], ent->client->ps.stats[stat]);
+	});
+}
+
+static void G_UpdateGroupStats(edict_t* ent)
+{
+	const size_t client_index = ent->client - game.clients;
+
+	if (stat_caches.size() != game.maxclients)
+		stat_caches.assign(game.maxclients, {});
+	if (client_index >= stat_caches.size())
+	{
+		stat_group_t every_frame;
+		G_SetGroupStats(ent, STATS_ALL, every_frame);
+		return;
+	}
+
+	stat_cache_t& cache = stat_caches[client_index];
+
+	G_CheckStatSources(ent, cache);
+
+	const stat_group_t recompute = g_stats_cache->integer ? (cache.dirty | cache.every_frame) : STATS_ALL;
+
+	G_SetGroupStats(ent, recompute, cache.every_frame);
+
+	G_ForEachGroupStat(recompute, [&](player_stat_t stat) { cache.stats[stat] = ent->client->ps.stats[stat]; });
+	G_ForEachGroupStat(STATS_ALL & ~recompute, [&](player_stat_t stat) { ent->client->ps.stats[stat] = cache.stats[stat]; });
+
+	cache.dirty = STATS_NONE;
+
+	stat_updates++;
+	for (size_t group = 0; group < STATS_GROUP_COUNT; group++)
+		if (recompute & static_cast<stat_group_t>(1 << group))
+			stat_recomputes[group]++;
+
+	if (g_stats_verify->integer)
+		G_VerifyGroupStats(ent);
+}
+
+void G_InvalidateStats(stat_group_t groups)
+{
+	for (stat_cache_t& cache : stat_caches)
+		cache.dirty |= groups;
+}
+
+void G_InvalidateStats(edict_t* ent, stat_group_t groups)
+{
+	if (!ent || !ent->client)
+		return;
+
+	const size_t client_index = ent->client - game.clients;
+	if (client_index < stat_caches.size())
+		stat_caches[client_index].dirty |= groups;
+}
+
+void G_PrintStatStats()
+{
+	const double updates = stat_updates ? static_cast<double>(stat_updates) : 1.0;
+	constexpr const char* names[STATS_GROUP_COUNT] = { "health", "inventory", "wave", "vote" };
+
+	gi.Com_PrintFmt("=== Stat Groups ({}{}) ===\n", g_stats_cache->integer ? "on" : "off, g_stats_cache 0",
+		g_stats_verify->integer ? ", verifying" : "");
+	gi.Com_PrintFmt("{} client updates, {} verify mismatches\n", stat_updates, stat_mismatches);
+	for (size_t group = 0; group < STATS_GROUP_COUNT; group++)
+		gi.Com_PrintFmt("{:<10} recomputed {} times ({:.1f}%)\n", names[group], stat_recomputes[group], 100.0 * stat_recomputes[group] / updates);
+}
+
+/*
+===============
+G_SetStats
+===============
+*/
+void G_SetStats(edict_t* ent)
+{
+	gitem_t* item;
+	item_id_t index;
+	int		  cells = 0;
+	item_id_t power_armor_type;
+
+	//
+	// health, inventory, wave and vote text, when invalidated
+	//
+	G_UpdateGroupStats(ent);
 
 	// Active bonuses HUD panel: rendered on the statusbar (its own configstring
 	// budget, independent of the scoreboard's/menu's svc_layout), so a long list
@@ -970,19 +1263,6 @@ void G_SetStats(edict_t* ent)
 	//
 	// weapons
 	//
-	uint32_t weaponbits = 0;
-
-	for (invIndex = IT_WEAPON_GRAPPLE; invIndex <= IT_WEAPON_DISRUPTOR; invIndex++)
-	{
-		if (ent->client->pers.inventory[invIndex])
-		{
-			weaponbits |= 1 << GetItemByIndex((item_id_t)invIndex)->weapon_wheel_index;
-		}
-	}
-
-	ent->client->ps.stats[STAT_WEAPONS_OWNED_1] = (weaponbits & 0xFFFF);
-	ent->client->ps.stats[STAT_WEAPONS_OWNED_2] = (weaponbits >> 16);
-
 	ent->client->ps.stats[STAT_ACTIVE_WHEEL_WEAPON] = (ent->client->newweapon ? ent->client->newweapon->weapon_wheel_index :
 		ent->client->pers.weapon ? ent->client->pers.weapon->weapon_wheel_index :
 		-1);
@@ -1013,14 +1293,6 @@ void G_SetStats(edict_t* ent)
 		}
 	}
 
-	memset(&ent->client->ps.stats[STAT_AMMO_INFO_START], 0, sizeof(uint16_t) * NUM_AMMO_STATS);
-	for (unsigned int ammoIndex = AMMO_BULLETS; ammoIndex < AMMO_MAX; ++ammoIndex)
-	{
-		gitem_t* ammo = GetItemByAmmo((ammo_t)ammoIndex);
-		uint16_t const val = G_CheckInfiniteAmmo(ammo) ? AMMO_VALUE_INFINITE : clamp(ent->client->pers.inventory[ammo->id], 0, AMMO_VALUE_INFINITE - 1);
-		G_SetAmmoStat((uint16_t*)&ent->client->ps.stats[STAT_AMMO_INFO_START], ammo->ammo_wheel_index, val);
-	}
-
 	//
 	// armor
 	//
@@ -1055,41 +1327,6 @@ void G_SetStats(edict_t* ent)
 		ent->client->ps.stats[STAT_PICKUP_STRING] = 0;
 	}
 
-	// owned powerups
-	memset(&ent->client->ps.stats[STAT_POWERUP_INFO_START], 0, sizeof(uint16_t) * NUM_POWERUP_STATS);
-	for (unsigned int powerupIndex = POWERUP_SCREEN; powerupIndex < POWERUP_MAX; ++powerupIndex)
-	{
-		gitem_t* powerup = GetItemByPowerup((powerup_t)powerupIndex);
-		uint16_t val;
-
-		switch (powerup->id)
-		{
-		case IT_ITEM_POWER_SCREEN:
-		case IT_ITEM_POWER_SHIELD:
-			if (!ent->client->pers.inventory[powerup->id])
-				val = 0;
-			else if (ent->flags & FL_POWER_ARMOR)
-				val = 2;
-			else
-				val = 1;
-			break;
-		case IT_ITEM_FLASHLIGHT:
-			if (!ent->client->pers.inventory[powerup->id])
-				val = 0;
-			else if (ent->flags & FL_FLASHLIGHT)
-				val = 2;
-			else
-				val = 1;
-			break;
-		default:
-			val = clamp(ent->client->pers.inventory[powerup->id], 0, 3);
-			break;
-		}
-
-		G_SetPowerupStat((uint16_t*)&ent->client->ps.stats[STAT_POWERUP_INFO_START],
-			powerup->powerup_wheel_index, val);
-	}
-
 	ent->client->ps.stats[STAT_TIMER_ICON] = 0;
 	ent->client->ps.stats[STAT_TIMER] = 0;
 
@@ -1231,44 +1468,6 @@ void G_SetStats(edict_t* ent)
 	else
 		ent->client->ps.stats[STAT_LAYOUTS] &= ~LAYOUTS_HIDE_CROSSHAIR;
 
-	// [Paril-KEX] key display
-	if (!G_IsDeathmatch())
-	{
-		int32_t key_offset = 0;
-		player_stat_t stat = STAT_KEY_A;
-
-		ent->client->ps.stats[STAT_KEY_A] =
-			ent->client->ps.stats[STAT_KEY_B] =
-			ent->client->ps.stats[STAT_KEY_C] = 0;
-
-		// Use static thread_local to avoid per-frame heap allocations
-		static thread_local boost::container::small_vector<item_id_t, 4> keys_held;
-		keys_held.clear();
-
-		for (size_t i = 0; i < IT_TOTAL; ++i) // Iterate using index for global C array
-		{
-            const gitem_t& current_item = itemlist[i];
-			if (!(current_item.flags & IF_KEY))
-				continue;
-			else if (!ent->client->pers.inventory[current_item.id])
-				continue;
-
-			keys_held.push_back(current_item.id);
-		}
-
-		if (!keys_held.empty()) // Proceed only if keys are held
-		{
-			if (keys_held.size() > 3)
-				key_offset = (int32_t)(level.time.seconds() / 5);
-
-			for (size_t i = 0; i < std::min(keys_held.size(), (size_t)3); i++, stat = (player_stat_t)(stat + 1))
-			{
-				size_t key_index_to_display = (i + key_offset) % keys_held.size();
-				ent->client->ps.stats[stat] = gi.imageindex(GetItemByIndex(keys_held[key_index_to_display])->icon);
-			}
-		}
-	}
-
 	//
 	// frags
 	//
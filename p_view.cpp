@@ -4,6 +4,7 @@
 #include "g_local.h"
 #include "horde/g_horde_benefits.h"
 #include "horde/p_flyer_morph.h"
+#include "horde/g_lag_rewind.h"
 #include "m_player.h"
 #include "bots/bot_includes.h"
 
@@ -1628,19 +1629,16 @@ void G_LagCompensate(edict_t* from_player, const vec3_t& start, const vec3_t& di
 		(from_player->svflags & SVF_BOT))
 		return;
 
-	// Lag compensation fully disabled for Horde mode (coop, no PvP):
-	// - Player-vs-player compensation unnecessary (no friendly fire)
-	// - Monster lag compensation disabled due to issues with high entity counts:
-	// - Causes monsters to teleport/get stuck in players when many entities exist
-	// - Excessive gi.linkentity() calls (2x per shot per monster) degrade network performance
-	// - Velocity-based estimation is inaccurate for strafing/dodging monsters
-	// Players should lead their shots on moving targets instead (standard Q2 behavior)
+	// [Horde] players aren't moved (coop, no PvP); monsters aren't either: moving and
+	// relinking every monster per shot didn't scale to a horde. pierce_trace resolves
+	// hitscan against the monster bounds recorded for the frame this client last saw.
+	LagRewind::Begin(from_player, current_frame - from_player->client->cmd.server_frame);
 }
 
 // [Paril-KEX] pop everybody's lag compensation values
 void G_UnLagCompensate()
 {
-	// Lag compensation fully disabled for Horde mode (see G_LagCompensate for details)
+	LagRewind::End();
 }
 
 // [Paril-KEX] save the current lag compensation value
@@ -1826,14 +1824,12 @@ void ClientEndServerFrame(edict_t* ent)
 	ent->client->oldgroundentity = ent->groundentity;
 
 	// ZOID
-	if (ent->client->menudirty && ent->client->menutime <= level.time)
+	// menus only go out when their layout changed, and no more
+	// than once per MENU_MIN_REFRESH
+	if (ent->client->menudirty && ent->client->menurefreshtime <= level.time)
 	{
-		if (ent->client->menu)
-		{
-			PMenu_Do_Update(ent);
-			gi.unicast(ent, true);
-		}
-		ent->client->menutime = level.time;
+		if (ent->client->menu && PMenu_Refresh(ent, true))
+			ent->client->menurefreshtime = level.time + MENU_MIN_REFRESH;
 		ent->client->menudirty = false;
 	}
 	// ZOID
@@ -1844,13 +1840,15 @@ void ClientEndServerFrame(edict_t* ent)
 		// ZOID
 		if (ent->client->menu)
 		{
-			PMenu_Do_Update(ent);
+			PMenu_Refresh(ent, false, true);
 			ent->client->menudirty = false;
 		}
 		else
+		{
 			// ZOID
 			DeathmatchScoreboardMessage(ent, ent->enemy);
-		gi.unicast(ent, false);
+			gi.unicast(ent, false);
+		}
 		ent->client->menutime = level.time + 3_sec;
 	}
 
@@ -561,6 +561,8 @@ void Think_Weapon(edict_t* ent)
 	if (ent->client->resp.spectator)
 		return;
 
+	const rng_scope_t rng_scope(rng_stream_t::weapons);
+
 	// if just died, put the weapon away
 	if (ent->health < 1)
 	{
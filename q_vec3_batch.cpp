@@ -0,0 +1,298 @@
+// Copyright (c) ZeniMax Media Inc.
+// Licensed under the GNU General Public License 2.0.
+
+// q_vec3_batch.cpp -- vec3_t tests over many points at once
+
+#include "g_local.h"
+#include "q_vec3_batch.h"
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define VEC3_BATCH_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VEC3_BATCH_SSE2
+#endif
+
+static_assert(sizeof(vec3_t) == sizeof(float) * 3, "batch loads read vec3_t arrays as packed floats");
+
+//====================================================================================
+
+// one point at a time; the vector bodies do the same operations in the same order
+
+static inline float batch_dist_sq(const vec3_t& point, const vec3_t& center)
+{
+	const float dx = point.x - center.x, dy = point.y - center.y, dz = point.z - center.z;
+	return (dx * dx) + (dy * dy) + (dz * dz);
+}
+
+static inline bool batch_cone(const vec3_t& point, const vec3_t& apex, const vec3_t& dir, float min_dot, float min_dot_sq, float range_squared)
+{
+	const float dx = point.x - apex.x, dy = point.y - apex.y, dz = point.z - apex.z;
+	const float dist_sq = (dx * dx) + (dy * dy) + (dz * dz);
+
+	if (!(dist_sq <= range_squared))
+		return false;
+
+	// dot(d / |d|, dir) > min_dot, squared to lose the root; the sign of both sides decides first
+	const float along = (dx * dir.x) + (dy * dir.y) + (dz * dir.z);
+	const float along_sq = along * along, bound = min_dot_sq * dist_sq;
+
+	if (min_dot >= 0)
+		return along > 0 && along_sq > bound;
+	return along >= 0 || along_sq < bound;
+}
+
+static inline bool batch_box(const vec3_t& mins, const vec3_t& maxs, const vec3_t& box_mins, const vec3_t& box_maxs)
+{
+	return boxes_intersect(mins, maxs, box_mins, box_maxs);
+}
+
+void batch_distance_squared_scalar(std::span<const vec3_t> points, const vec3_t& center, float* out)
+{
+	for (size_t i = 0; i < points.size(); i++)
+		out[i] = batch_dist_sq(points[i], center);
+}
+
+size_t batch_in_sphere_scalar(std::span<const vec3_t> points, const vec3_t& center, float radius_squared, uint32_t* out)
+{
+	size_t n = 0;
+	for (size_t i = 0; i < points.size(); i++)
+		if (batch_dist_sq(points[i], center) <= radius_squared)
+			out[n++] = static_cast<uint32_t>(i);
+	return n;
+}
+
+size_t batch_in_cone_scalar(std::span<const vec3_t> points, const vec3_t& apex, const vec3_t& dir, float min_dot, float range_squared, uint32_t* out)
+{
+	const float min_dot_sq = min_dot * min_dot;
+	size_t n = 0;
+	for (size_t i = 0; i < points.size(); i++)
+		if (batch_cone(points[i], apex, dir, min_dot, min_dot_sq, range_squared))
+			out[n++] = static_cast<uint32_t>(i);
+	return n;
+}
+
+size_t batch_boxes_intersect_scalar(std::span<const vec3_t> mins, std::span<const vec3_t> maxs, const vec3_t& box_mins, const vec3_t& box_maxs, uint32_t* out)
+{
+	size_t n = 0;
+	for (size_t i = 0; i < mins.size(); i++)
+		if (batch_box(mins[i], maxs[i], box_mins, box_maxs))
+			out[n++] = static_cast<uint32_t>(i);
+	return n;
+}
+
+//====================================================================================
+
+#if defined(VEC3_BATCH_AVX2)
+
+struct batch_lanes_t
+{
+	using reg = __m256;
+	static constexpr size_t WIDTH = 8;
+
+	static inline reg set1(float f) { return _mm256_set1_ps(f); }
+	static inline reg add(reg a, reg b) { return _mm256_add_ps(a, b); }
+	static inline reg sub(reg a, reg b) { return _mm256_sub_ps(a, b); }
+	static inline reg mul(reg a, reg b) { return _mm256_mul_ps(a, b); }
+	static inline reg lt(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+	static inline reg le(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+	static inline reg gt(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+	static inline reg ge(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+	static inline reg and_(reg a, reg b) { return _mm256_and_ps(a, b); }
+	static inline reg or_(reg a, reg b) { return _mm256_or_ps(a, b); }
+	static inline uint32_t mask(reg a) { return static_cast<uint32_t>(_mm256_movemask_ps(a)); }
+	static inline void store(float* out, reg a) { _mm256_storeu_ps(out, a); }
+
+	// 8 packed vec3_t into x, y and z lanes
+	static inline void load(const vec3_t* p, reg& x, reg& y, reg& z)
+	{
+		const __m256i stride = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+		const float* f = &p->x;
+		x = _mm256_i32gather_ps(f, stride, 4);
+		y = _mm256_i32gather_ps(f + 1, stride, 4);
+		z = _mm256_i32gather_ps(f + 2, stride, 4);
+	}
+};
+
+#elif defined(VEC3_BATCH_SSE2)
+
+struct batch_lanes_t
+{
+	using reg = __m128;
+	static constexpr size_t WIDTH = 4;
+
+	static inline reg set1(float f) { return _mm_set1_ps(f); }
+	static inline reg add(reg a, reg b) { return _mm_add_ps(a, b); }
+	static inline reg sub(reg a, reg b) { return _mm_sub_ps(a, b); }
+	static inline reg mul(reg a, reg b) { return _mm_mul_ps(a, b); }
+	static inline reg lt(reg a, reg b) { return _mm_cmplt_ps(a, b); }
+	static inline reg le(reg a, reg b) { return _mm_cmple_ps(a, b); }
+	static inline reg gt(reg a, reg b) { return _mm_cmpgt_ps(a, b); }
+	static inline reg ge(reg a, reg b) { return _mm_cmpge_ps(a, b); }
+	static inline reg and_(reg a, reg b) { return _mm_and_ps(a, b); }
+	static inline reg or_(reg a, reg b) { return _mm_or_ps(a, b); }
+	static inline uint32_t mask(reg a) { return static_cast<uint32_t>(_mm_movemask_ps(a)); }
+	static inline void store(float* out, reg a) { _mm_storeu_ps(out, a); }
+
+	// 4 packed vec3_t (x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3) into x, y and z lanes
+	static inline void load(const vec3_t* p, reg& x, reg& y, reg& z)
+	{
+		const float* f = &p->x;
+		const reg a = _mm_loadu_ps(f), b = _mm_loadu_ps(f + 4), c = _mm_loadu_ps(f + 8);
+
+		const reg b2c1 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));	// b2 b2 c1 c1
+		x = _mm_shuffle_ps(a, b2c1, _MM_SHUFFLE(2, 0, 3, 0));			// a0 a3 b2 c1
+
+		const reg a1b0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));	// a1 a1 b0 b0
+		const reg b3c2 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));	// b3 b3 c2 c2
+		y = _mm_shuffle_ps(a1b0, b3c2, _MM_SHUFFLE(2, 0, 2, 0));		// a1 b0 b3 c2
+
+		const reg a2b1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));	// a2 a2 b1 b1
+		const reg c0c3 = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0));	// c0 c0 c3 c3
+		z = _mm_shuffle_ps(a2b1, c0c3, _MM_SHUFFLE(2, 0, 2, 0));		// a2 b1 c0 c3
+	}
+};
+
+#endif
+
+#if defined(VEC3_BATCH_AVX2) || defined(VEC3_BATCH_SSE2)
+
+using L = batch_lanes_t;
+
+// indices of the set bits of `mask`, offset by `base`
+static inline size_t batch_emit(uint32_t* out, size_t n, size_t base, uint32_t mask)
+{
+	while (mask)
+	{
+		out[n++] = static_cast<uint32_t>(base + std::countr_zero(mask));
+		mask &= mask - 1;
+	}
+	return n;
+}
+
+static inline L::reg batch_dist_sq(const vec3_t* p, L::reg cx, L::reg cy, L::reg cz)
+{
+	L::reg x, y, z;
+	L::load(p, x, y, z);
+	const L::reg dx = L::sub(x, cx), dy = L::sub(y, cy), dz = L::sub(z, cz);
+	return L::add(L::add(L::mul(dx, dx), L::mul(dy, dy)), L::mul(dz, dz));
+}
+
+void batch_distance_squared(std::span<const vec3_t> points, const vec3_t& center, float* out)
+{
+	const L::reg cx = L::set1(center.x), cy = L::set1(center.y), cz = L::set1(center.z);
+	size_t i = 0;
+
+	for (; i + L::WIDTH <= points.size(); i += L::WIDTH)
+		L::store(out + i, batch_dist_sq(&points[i], cx, cy, cz));
+
+	for (; i < points.size(); i++)
+		out[i] = batch_dist_sq(points[i], center);
+}
+
+size_t batch_in_sphere(std::span<const vec3_t> points, const vec3_t& center, float radius_squared, uint32_t* out)
+{
+	const L::reg cx = L::set1(center.x), cy = L::set1(center.y), cz = L::set1(center.z), r = L::set1(radius_squared);
+	size_t i = 0, n = 0;
+
+	for (; i + L::WIDTH <= points.size(); i += L::WIDTH)
+		n = batch_emit(out, n, i, L::mask(L::le(batch_dist_sq(&points[i], cx, cy, cz), r)));
+
+	for (; i < points.size(); i++)
+		if (batch_dist_sq(points[i], center) <= radius_squared)
+			out[n++] = static_cast<uint32_t>(i);
+	return n;
+}
+
+size_t batch_in_cone(std::span<const vec3_t> points, const vec3_t& apex, const vec3_t& dir, float min_dot, float range_squared, uint32_t* out)
+{
+	const float min_dot_sq = min_dot * min_dot;
+	const L::reg ax = L::set1(apex.x), ay = L::set1(apex.y), az = L::set1(apex.z);
+	const L::reg fx = L::set1(dir.x), fy = L::set1(dir.y), fz = L::set1(dir.z);
+	const L::reg range = L::set1(range_squared), cos_sq = L::set1(min_dot_sq), zero = L::set1(0.f);
+	const bool narrow = min_dot >= 0;
+	size_t i = 0, n = 0;
+
+	for (; i + L::WIDTH <= points.size(); i += L::WIDTH)
+	{
+		L::reg x, y, z;
+		L::load(&points[i], x, y, z);
+		const L::reg dx = L::sub(x, ax), dy = L::sub(y, ay), dz = L::sub(z, az);
+		const L::reg dist_sq = L::add(L::add(L::mul(dx, dx), L::mul(dy, dy)), L::mul(dz, dz));
+		const L::reg along = L::add(L::add(L::mul(dx, fx), L::mul(dy, fy)), L::mul(dz, fz));
+		const L::reg along_sq = L::mul(along, along), bound = L::mul(cos_sq, dist_sq);
+
+		const L::reg in_cone = narrow ?
+			L::and_(L::gt(along, zero), L::gt(along_sq, bound)) :
+			L::or_(L::ge(along, zero), L::lt(along_sq, bound));
+
+		n = batch_emit(out, n, i, L::mask(L::and_(L::le(dist_sq, range), in_cone)));
+	}
+
+	for (; i < points.size(); i++)
+		if (batch_cone(points[i], apex, dir, min_dot, min_dot_sq, range_squared))
+			out[n++] = static_cast<uint32_t>(i);
+	return n;
+}
+
+size_t batch_boxes_intersect(std::span<const vec3_t> mins, std::span<const vec3_t> maxs, const vec3_t& box_mins, const vec3_t& box_maxs, uint32_t* out)
+{
+	const L::reg min_x = L::set1(box_mins.x), min_y = L::set1(box_mins.y), min_z = L::set1(box_mins.z);
+	const L::reg max_x = L::set1(box_maxs.x), max_y = L::set1(box_maxs.y), max_z = L::set1(box_maxs.z);
+	size_t i = 0, n = 0;
+
+	for (; i + L::WIDTH <= mins.size(); i += L::WIDTH)
+	{
+		L::reg lx, ly, lz, hx, hy, hz;
+		L::load(&mins[i], lx, ly, lz);
+		L::load(&maxs[i], hx, hy, hz);
+
+		const L::reg overlap = L::and_(
+			L::and_(L::and_(L::le(lx, max_x), L::ge(hx, min_x)), L::and_(L::le(ly, max_y), L::ge(hy, min_y))),
+			L::and_(L::le(lz, max_z), L::ge(hz, min_z)));
+
+		n = batch_emit(out, n, i, L::mask(overlap));
+	}
+
+	for (; i < mins.size(); i++)
+		if (batch_box(mins[i], maxs[i], box_mins, box_maxs))
+			out[n++] = static_cast<uint32_t>(i);
+	return n;
+}
+
+#else
+
+void batch_distance_squared(std::span<const vec3_t> points, const vec3_t& center, float* out)
+{
+	batch_distance_squared_scalar(points, center, out);
+}
+
+size_t batch_in_sphere(std::span<const vec3_t> points, const vec3_t& center, float radius_squared, uint32_t* out)
+{
+	return batch_in_sphere_scalar(points, center, radius_squared, out);
+}
+
+size_t batch_in_cone(std::span<const vec3_t> points, const vec3_t& apex, const vec3_t& dir, float min_dot, float range_squared, uint32_t* out)
+{
+	return batch_in_cone_scalar(points, apex, dir, min_dot, range_squared, out);
+}
+
+size_t batch_boxes_intersect(std::span<const vec3_t> mins, std::span<const vec3_t> maxs, const vec3_t& box_mins, const vec3_t& box_maxs, uint32_t* out)
+{
+	return batch_boxes_intersect_scalar(mins, maxs, box_mins, box_maxs, out);
+}
+
+#endif
+
+const char* batch_vec3_path()
+{
+#if defined(VEC3_BATCH_AVX2)
+	return "avx2";
+#elif defined(VEC3_BATCH_SSE2)
+	return "sse2";
+#else
+	return "scalar";
+#endif
+}
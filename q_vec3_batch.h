@@ -0,0 +1,42 @@
+// Copyright (c) ZeniMax Media Inc.
+// Licensed under the GNU General Public License 2.0.
+
+#pragma once
+
+// q_vec3_batch.h -- vec3_t tests over many points at once
+//
+// The culling loops that run one entity at a time (radius damage, summon
+// and tesla targeting, id view, monster repulsion) gather their candidates'
+// points into an array and test them together here. batch_boxes_intersect
+// has no game caller yet; only sv vecbench drives it. The
+// filters write the indices of the points that pass to `out`, in ascending
+// order, and return how many passed; `out` needs room for every point.
+// Each has an SSE2 or AVX2 body when the compiler targets it, and a
+// scalar one otherwise. The _scalar versions always run the scalar body and
+// return the same results bit for bit; sv vecbench checks and times both.
+
+#include "q_std.h"
+#include <span>
+
+// out[i] = (points[i] - center).lengthSquared()
+void batch_distance_squared(std::span<const vec3_t> points, const vec3_t& center, float* out);
+
+// points with (point - center).lengthSquared() <= radius_squared
+size_t batch_in_sphere(std::span<const vec3_t> points, const vec3_t& center, float radius_squared, uint32_t* out);
+
+// points within range_squared of `apex` whose direction from it is within
+// the cone around unit `dir`, i.e. dot(normalized(point - apex), dir) > min_dot.
+// Tested without a square root, so right on the edge it can disagree with a
+// normalized dot; loops that go on to the exact test widen min_dot a little.
+size_t batch_in_cone(std::span<const vec3_t> points, const vec3_t& apex, const vec3_t& dir, float min_dot, float range_squared, uint32_t* out);
+
+// boxes for which boxes_intersect(mins[i], maxs[i], box_mins, box_maxs)
+size_t batch_boxes_intersect(std::span<const vec3_t> mins, std::span<const vec3_t> maxs, const vec3_t& box_mins, const vec3_t& box_maxs, uint32_t* out);
+
+void batch_distance_squared_scalar(std::span<const vec3_t> points, const vec3_t& center, float* out);
+size_t batch_in_sphere_scalar(std::span<const vec3_t> points, const vec3_t& center, float radius_squared, uint32_t* out);
+size_t batch_in_cone_scalar(std::span<const vec3_t> points, const vec3_t& apex, const vec3_t& dir, float min_dot, float range_squared, uint32_t* out);
+size_t batch_boxes_intersect_scalar(std::span<const vec3_t> mins, std::span<const vec3_t> maxs, const vec3_t& box_mins, const vec3_t& box_maxs, uint32_t* out);
+
+// "avx2", "sse2" or "scalar"
+const char* batch_vec3_path();
@@ -75,7 +75,6 @@ void T_RadiusNukeDamage(edict_t *inflictor, edict_t *attacker, float damage_fall
         return;
     }
 
-    edict_t *ent = nullptr;
     vec3_t   v_diff_to_center;
     vec3_t   ent_aabb_center;
     vec3_t   dir_to_ent;
@@ -87,8 +86,7 @@ void T_RadiusNukeDamage(edict_t *inflictor, edict_t *attacker, float damage_fall
     const vec3_t& inflictor_origin = inflictor->s.origin; // s.origin is vec3_t
 
     // --- First Pass: Apply Damage to entities within killzone2_radius ---
-    // findradius takes: edict_t* from, const vec3_t& org, float rad
-    while ((ent = findradius(ent, inflictor_origin, killzone2_radius)) != nullptr)
+    for (edict_t* ent : radius_edicts(inflictor_origin, killzone2_radius))
     {
         if (ent == ignore)
             continue;
@@ -221,7 +219,6 @@ void T_RadiusClassDamage(edict_t *inflictor, edict_t *attacker, float damage,
         return;
     }
 
-    edict_t *ent = nullptr;
     vec3_t   v_diff;
     vec3_t   ent_center_pos;
     vec3_t   dir_to_ent;
@@ -230,7 +227,7 @@ void T_RadiusClassDamage(edict_t *inflictor, edict_t *attacker, float damage,
 
     const vec3_t& inflictor_origin = inflictor->s.origin;
 
-    while ((ent = findradius(ent, inflictor_origin, radius)) != nullptr)
+    for (edict_t* ent : radius_edicts(inflictor_origin, radius))
     {
         if (!ent->inuse || !ent->takedamage) {
             continue;
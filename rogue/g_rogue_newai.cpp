@@ -3,6 +3,7 @@
 
 #include "../g_local.h"
 #include "../shared.h"
+#include "../horde/g_effect_queue.h"
 
 //===============================
 // BLOCKED Logic
@@ -1631,6 +1632,9 @@ THINK(BossExplode_think) (edict_t* self) -> void
 	org.y += frandom() * self->owner->size.y;
 	org.z += frandom() * self->owner->size.z;
 
+	// the boss going up in flames shouldn't lose out to the fight around it
+	EffectQueue::PriorityScope priority;
+
 	gi.WriteByte(svc_temp_entity);
 	gi.WriteByte(!(self->viewheight % 3) ? TE_EXPLOSION1 : TE_EXPLOSION1_NL);
 	gi.WritePosition(org);
@@ -164,9 +164,8 @@ edict_t *FindNearestVisibleEnemy(edict_t *from, const vec3_t &origin, float sear
 {
 	edict_t *nearest = nullptr;
 	float nearest_dist_squared = search_radius * search_radius;
-	edict_t *current = nullptr;
 
-	while ((current = findradius(current, origin, search_radius)) != nullptr)
+	for (edict_t* current : radius_edicts(origin, search_radius))
 	{
 		if (!current->inuse || current->health <= 0)
 			continue;
@@ -459,10 +458,9 @@ THINK(prox_open)(edict_t *ent)->void
 			ent->teamchain->touch = Prox_Field_Touch;
 
 		// --- SMARTER AMBUSH: Scan a larger radius for enemies upon arming ---
-		edict_t *search = nullptr;
 		const float ambush_radius = PROX_DAMAGE_RADIUS() * 1.2f; // Increased scan radius
 
-		while ((search = findradius(search, ent->s.origin, ambush_radius)) != nullptr)
+		for (edict_t* search : radius_edicts(ent->s.origin, ambush_radius))
 		{
 			if (!search->inuse || search == ent || OnSameTeam(search, ent->teammaster))
 				continue;
@@ -874,10 +872,9 @@ static void Nuke_Explode(edict_t *ent)
 
 	T_RadiusNukeDamage(ent, ent->teammaster, (float)ent->dmg, ent, ent->dmg_radius, MOD_NUKE);
 
-	edict_t *check = nullptr;
 	float radius = ent->dmg_radius * 1.5f; // Un poco más de radio que el daño para estar seguros
 
-	while ((check = findradius(check, ent->s.origin, radius)) != nullptr)
+	for (edict_t* check : radius_edicts(ent->s.origin, radius))
 	{
 		if (!check->client || !check->inuse)
 			continue;
@@ -155,7 +155,7 @@ MONSTERINFO_SIGHT(carrier_sight) (edict_t *self, edict_t *other) -> void
 void CarrierCoopCheck(edict_t *self)
 {
 	uint32_t num_targets = 0;
-	edict_t *original_enemy, *candidate, *chosen_target = nullptr;
+	edict_t *original_enemy, *chosen_target = nullptr;
 	trace_t	 tr;
 
 	// if we're not in coop, this is a noop
@@ -170,10 +170,9 @@ void CarrierCoopCheck(edict_t *self)
 	// Summoned carriers should only pick hostile targets, not coop players.
 	if (self->monsterinfo.issummoned)
 	{
-		// Use findradius to avoid scanning every entity each frame.
+		// Use the radius index to avoid scanning every entity each frame.
 		constexpr float SEARCH_RADIUS = 2048.0f;
-		candidate = nullptr;
-		while ((candidate = findradius(candidate, self->s.origin, SEARCH_RADIUS)) != nullptr)
+		for (edict_t* candidate : radius_edicts(self->s.origin, SEARCH_RADIUS))
 		{
 			if (!candidate->inuse || !candidate->takedamage || candidate->health <= 0)
 				continue;
@@ -202,7 +201,7 @@ void CarrierCoopCheck(edict_t *self)
 		// Legacy behavior for non-summoned carriers: prefer players in coop/SP behind/below.
 		for (uint32_t player = 1; player <= game.maxclients; player++)
 		{
-			candidate = &g_edicts[player];
+			edict_t *candidate = &g_edicts[player];
 			if (!candidate->inuse)
 				continue;
 			if (!candidate->client)
@@ -798,8 +798,7 @@ THINK(heat_turret_think) (edict_t* self) -> void
 		vec3_t const fwd = AngleVectors(self->s.angles).forward;
 
 		// The findradius loop now runs much less frequently.
-		edict_t* target = nullptr;
-		while ((target = findradius(target, self->s.origin, 1024)) != nullptr)
+		for (edict_t* target : radius_edicts(self->s.origin, 1024))
 		{
 			// Skip: the sentry that fired us, non-clients, invalid/dead targets, invisible targets
 			// Also skip: the sentry's owner (player) and teammates
@@ -731,13 +731,8 @@ void ApplyMonsterBonusFlags(edict_t* monster)
 	// Cache MonsterStatsConfig pointer (eliminates GetMonsterConfig() calls)
 	monster->monsterinfo.cached_monster_config = GetMonsterConfig(monster->monsterinfo.monster_type_id);
 
-	// Cache MonsterLevelScaling pointer (eliminates GetMonsterLevelScaling() + string parsing)
-	const char* classname = horde::MonsterTypeRegistry::GetClassname(static_cast<horde::MonsterTypeID>(monster->monsterinfo.monster_type_id));
-	if (classname && strncmp(classname, "monster_", 8) == 0)
-	{
-		const char* monster_name = classname + 8; // Skip "monster_" prefix
-		monster->monsterinfo.cached_level_scaling = GetMonsterLevelScaling(monster_name);
-	}
+	// Cache MonsterLevelScaling pointer (eliminates GetMonsterLevelScaling() calls)
+	monster->monsterinfo.cached_level_scaling = GetMonsterLevelScaling(monster->monsterinfo.monster_type_id);
 
 	// Apply centralized PvM level scaling for ALL monsters
 	// This ensures monsters get level-scaled health/armor even if their spawn functions haven't been updated
@@ -877,7 +872,7 @@ void ApplyPvMLevelScaling(edict_t* monster)
 	if (monster->monsterinfo.IS_BOSS)
 		return;
 
-	// Get monster type and classname
+	// Get monster type
 	uint8_t type_id = monster->monsterinfo.monster_type_id;
 
 	// g_horde_original_m_health already set monster->health/armor to the sourced original value
@@ -886,16 +881,8 @@ void ApplyPvMLevelScaling(edict_t* monster)
 	if (g_horde_original_m_health && g_horde_original_m_health->integer && HasOriginalMonsterHealth(type_id))
 		return;
 
-	const char* classname = horde::MonsterTypeRegistry::GetClassname(static_cast<horde::MonsterTypeID>(type_id));
-	
-	if (!classname || strncmp(classname, "monster_", 8) != 0)
-		return;
-
-	// Extract monster name without "monster_" prefix
-	const char* monster_name = classname + 8;
-
 	// Try to get level-based scaling config
-	const MonsterLevelScaling* level_scaling = GetMonsterLevelScaling(monster_name);
+	const MonsterLevelScaling* level_scaling = GetMonsterLevelScaling(type_id);
 	if (!level_scaling)
 		return; // No level scaling config for this monster
 
@@ -1367,7 +1354,7 @@ void PushEntitiesAway(const vec3_t& center, int num_waves, float push_radius, fl
 	size_t removable_count = 0;
 
 	// First, check for removable special entities (traps, mines, bases, etc.)
-	for (edict_t* ent = nullptr; (ent = findradius(ent, center, search_radius)) != nullptr;) {
+	for (edict_t* ent : radius_edicts(center, search_radius)) {
 		if (!ent || !ent->inuse ||
 			gi.traceline(center, ent->s.origin, nullptr, MASK_SOLID).fraction < 1.0f) {
 			continue;
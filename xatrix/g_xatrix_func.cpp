@@ -2,6 +2,7 @@
 // Licensed under the GNU General Public License 2.0.
 
 #include "../g_local.h"
+#include "../horde/g_heal_registry.h"
 
 /*QUAKED rotating_light (0 .5 .8) (-8 -8 -8) (8 8 8) START_OFF ALARM
 "health"	if set, the light may be killed.
@@ -181,4 +182,6 @@ void SP_object_repair(edict_t* ent)
 	ent->health = 100;
 	if (!ent->delay)
 		ent->delay = 1.0;
+
+	HealRegistry::Add(ent, HealRegistry::KIND_REPAIR);
 }
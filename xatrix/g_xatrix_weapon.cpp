@@ -165,10 +165,9 @@ THINK(heat_think) (edict_t* self) -> void
 
 	if (!acquire)
 	{
-		edict_t* target = nullptr;
 
 		// acquire new target
-		while ((target = findradius(target, self->s.origin, 1024)) != nullptr)
+		for (edict_t* target : radius_edicts(self->s.origin, 1024))
 		{
 			if (self->owner == target)
 				continue;
@@ -15,6 +15,7 @@
 #include "../horde/g_horde.h"
 #include "../horde/horde_ids.h"
 #include "../monster_constants.h"
+#include "../horde/g_heal_registry.h"
 // End Horde includes
 
 
@@ -796,13 +797,13 @@ void ED_CallSpawn(edict_t* ent);
 
 edict_t* fixbot_FindDeadMonster(edict_t* self)
 {
-	edict_t* ent = nullptr;
 	edict_t* best = nullptr;
 
-	while ((ent = findradius(ent, self->s.origin, 1024)) != nullptr)
+	for (edict_t* ent : HealRegistry::Query(self->s.origin, 1024, HealRegistry::KIND_CORPSE))
 	{
 		if (ent == self)
 			continue;
+		// the registry also holds player bodies
 		if (!(ent->svflags & SVF_MONSTER))
 			continue;
 		if (ent->monsterinfo.aiflags & AI_GOOD_GUY)
@@ -979,41 +980,36 @@ void use_scanner(edict_t* self)
 	if (self->enemy)
 		return;
 
-	edict_t* ent = nullptr;
-
 	float  radius = 1024;
 	vec3_t vec;
 
 	float len;
 
-	while ((ent = findradius(ent, self->s.origin, radius)) != nullptr)
+	for (edict_t* ent : HealRegistry::Query(self->s.origin, radius, HealRegistry::KIND_REPAIR))
 	{
 		if (ent->health >= 100)
 		{
-			if (strcmp(ent->classname, "object_repair") == 0)
+			if (visible(self, ent))
 			{
-				if (visible(self, ent))
+				// remove the old one
+				if (strcmp(self->goalentity->classname, "bot_goal") == 0)
 				{
-					// remove the old one
-					if (strcmp(self->goalentity->classname, "bot_goal") == 0)
-					{
-						FreeBotGoal(self);
-					}
+					FreeBotGoal(self);
+				}
 
-					self->goalentity = self->enemy = ent;
+				self->goalentity = self->enemy = ent;
 
-					vec = self->s.origin - self->goalentity->s.origin;
-					len = vec.normalize();
+				vec = self->s.origin - self->goalentity->s.origin;
+				len = vec.normalize();
 
-					fixbot_set_attack_fly_parameters(self);
+				fixbot_set_attack_fly_parameters(self);
 
-					if (len < 32)
-					{
-						M_SetAnimation(self, &fixbot_move_weld_start);
-						return;
-					}
+				if (len < 32)
+				{
+					M_SetAnimation(self, &fixbot_move_weld_start);
 					return;
 				}
+				return;
 			}
 		}
 	}
@@ -1347,9 +1343,8 @@ THINK(heat_fixbot_think) (edict_t* self) -> void
 		if (!acquire)
 		{
 			// acquire new target
-			edict_t* target = nullptr;
 
-			while ((target = findradius(target, self->s.origin, 1024)) != nullptr)
+			for (edict_t* target : radius_edicts(self->s.origin, 1024))
 			{
 				// Skip owner
 				if (self->owner == target)
@@ -1513,9 +1508,8 @@ THINK(plasma_fixbot_think) (edict_t* self) -> void
 		if (!acquire)
 		{
 			// Acquire new target
-			edict_t* target = nullptr;
 
-			while ((target = findradius(target, self->s.origin, 1024)) != nullptr)
+			for (edict_t* target : radius_edicts(self->s.origin, 1024))
 			{
 				// Skip owner
 				if (self->owner == target)
@@ -2229,8 +2229,7 @@ void gekkkl_check_landing(edict_t* self)
 			T_SlamRadiusDamage(tr.endpos, self, self, damage, 600.f, self, 165, MOD_UNKNOWN);
 
 			// HIGH UPWARD PUSH: Launch enemies into the air
-			edict_t* ent = nullptr;
-			while ((ent = findradius(ent, tr.endpos, 165)) != nullptr)
+			for (edict_t* ent : radius_edicts(tr.endpos, 165))
 			{
 				if (!ent->takedamage)
 					continue;